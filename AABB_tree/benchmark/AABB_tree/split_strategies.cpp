@@ -0,0 +1,104 @@
+// Compares the query throughput of AABB trees built with the median split
+// along the longest axis (AABB_traits_3) and with the binned SAH split (AABB_SAH_traits_3).
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_SAH_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/Timer.h>
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Vector_3 Vector_3;
+typedef K::Ray_3 Ray_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+
+template <class Traits>
+void run(const std::string& name,
+         const Mesh& tm,
+         const std::vector<Ray_3>& rays,
+         const std::vector<Point_3>& points)
+{
+  typedef CGAL::AABB_tree<Traits> Tree;
+
+  CGAL::Timer time;
+  time.start();
+  Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+  tree.build();
+  time.stop();
+  std::cout << name << "\n";
+  std::cout << "  build() time: " << time.time() << " s\n";
+
+  tree.accelerate_distance_queries();
+
+  std::size_t nb_hits = 0;
+  time.reset();
+  time.start();
+  for(const Ray_3& r : rays)
+    if(tree.first_intersected_primitive(r))
+      ++nb_hits;
+  time.stop();
+  std::cout << "  first_intersected_primitive(): " << rays.size() / time.time() << " queries/s"
+            << " (" << nb_hits << " hits)\n";
+
+  double sum = 0;
+  time.reset();
+  time.start();
+  for(const Point_3& p : points)
+    sum += CGAL::to_double(squared_distance(p, tree.closest_point(p)));
+  time.stop();
+  std::cout << "  closest_point(): " << points.size() / time.time() << " queries/s"
+            << " (checksum " << sum << ")\n";
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::size_t nb_queries = (argc > 2) ? std::stoul(argv[2]) : 100000;
+
+  Mesh tm;
+  if(!CGAL::IO::read_polygon_mesh(filename, tm))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(tm) << " faces\n";
+
+  // queries are generated in a box slightly larger than the mesh
+  const CGAL::Bbox_3 bb = CGAL::Polygon_mesh_processing::bbox(tm);
+  const double r = 0.6 * std::sqrt(CGAL::square(bb.xmax() - bb.xmin()) +
+                                   CGAL::square(bb.ymax() - bb.ymin()) +
+                                   CGAL::square(bb.zmax() - bb.zmin()));
+  const Vector_3 center((bb.xmin() + bb.xmax()) / 2, (bb.ymin() + bb.ymax()) / 2, (bb.zmin() + bb.zmax()) / 2);
+
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point_3> gen(r, rng);
+  std::vector<Ray_3> rays;
+  std::vector<Point_3> points;
+  rays.reserve(nb_queries);
+  points.reserve(nb_queries);
+  for(std::size_t i=0; i<nb_queries; ++i)
+  {
+    const Point_3 p = *gen++ + center;
+    const Point_3 q = *gen++ + center;
+    rays.emplace_back(p, q);
+    points.push_back(p);
+  }
+
+  run<CGAL::AABB_traits_3<K, Primitive> >("Median split (AABB_traits_3)", tm, rays, points);
+  run<CGAL::AABB_SAH_traits_3<K, Primitive> >("Binned SAH split (AABB_SAH_traits_3)", tm, rays, points);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,205 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : GeometryFactory
+//
+
+#ifndef CGAL_AABB_SAH_TRAITS_3_H
+#define CGAL_AABB_SAH_TRAITS_3_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/AABB_traits_3.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+/// \file AABB_SAH_traits_3.h
+
+namespace CGAL {
+
+/// \addtogroup PkgAABBTreeRef
+/// @{
+
+/// This traits class is identical to `AABB_traits_3`, except for the functor
+/// `Split_primitives` used during the construction of the tree.
+///
+/// Instead of always cutting along the longest axis of the bounding box of a node,
+/// the cutting axis is the one minimizing a binned surface area heuristic (SAH):
+/// the reference points of the primitives are distributed in `NbBins` bins along each axis,
+/// and the cost of the median cut along an axis is estimated using the number of primitives
+/// and the surface area of the bounding boxes of the bins on each side of the cut.
+/// As for `AABB_traits_3`, the primitives are split in two halves of equal size
+/// (the structure of the tree is unchanged), but the tree obtained is usually better suited for
+/// ray shooting and distance queries when the sizes of the primitives are very uneven.
+///
+/// \cgalModels{AABBTraits,AABBRayIntersectionTraits}
+///
+/// \tparam GeomTraits, AABBPrimitive, BboxMap see `AABB_traits_3`
+/// \tparam NbBins the number of bins used along each axis to evaluate the surface area heuristic
+///
+/// \sa `AABB_traits_3`
+/// \sa `AABB_tree`
+template<typename GeomTraits, typename AABBPrimitive, typename BboxMap = Default, int NbBins = 16>
+class AABB_SAH_traits_3
+  : public AABB_traits_3<GeomTraits, AABBPrimitive, BboxMap>
+{
+  static_assert(NbBins >= 2, "At least two bins are needed");
+
+  typedef AABB_traits_3<GeomTraits, AABBPrimitive, BboxMap> Base;
+  typedef AABB_SAH_traits_3<GeomTraits, AABBPrimitive, BboxMap, NbBins> Self;
+
+public:
+  typedef typename Base::Primitive Primitive;
+  typedef typename Base::Bounding_box Bounding_box;
+
+  /// Default constructor.
+  AABB_SAH_traits_3() { }
+
+  AABB_SAH_traits_3(BboxMap bbm)
+    : Base(bbm)
+  {}
+
+  /**
+   * @internal
+   * @brief Sorts [first,beyond[ so that the first half of the range is
+   * made of the primitives with the smallest reference points along the
+   * axis minimizing the binned SAH cost.
+   * @param first iterator on first element
+   * @param beyond iterator on beyond element
+   * @param bbox the bounding box of [first,beyond[
+   */
+  class Split_primitives
+  {
+    const Self& m_traits;
+
+  public:
+    Split_primitives(const Self& traits)
+      : m_traits(traits) {}
+
+    typedef void result_type;
+    template<typename PrimitiveIterator>
+    void operator()(PrimitiveIterator first,
+                    PrimitiveIterator beyond,
+                    const Bounding_box& bbox) const
+    {
+      PrimitiveIterator middle = first + (beyond - first)/2;
+      switch(best_axis(first, beyond, bbox))
+      {
+      case Base::CGAL_AXIS_X: // sort along x
+        std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Base::less_x(p1, p2, this->m_traits); });
+        break;
+      case Base::CGAL_AXIS_Y: // sort along y
+        std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Base::less_y(p1, p2, this->m_traits); });
+        break;
+      case Base::CGAL_AXIS_Z: // sort along z
+        std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Base::less_z(p1, p2, this->m_traits); });
+        break;
+      default:
+        CGAL_error();
+      }
+    }
+
+  private:
+    struct Bin
+    {
+      std::size_t size = 0;
+      Bounding_box bbox;
+    };
+
+    static double half_area(const Bounding_box& b)
+    {
+      if(b.xmin() > b.xmax()) // empty box
+        return 0.;
+      const double dx = b.xmax() - b.xmin();
+      const double dy = b.ymax() - b.ymin();
+      const double dz = b.zmax() - b.zmin();
+      return dx*dy + dy*dz + dz*dx;
+    }
+
+    template<typename PrimitiveIterator>
+    typename Base::Axis best_axis(PrimitiveIterator first,
+                                  PrimitiveIterator beyond,
+                                  const Bounding_box& bbox) const
+    {
+      const std::size_t n = static_cast<std::size_t>(beyond - first);
+      if(n < 4)
+        return Base::longest_axis(bbox);
+
+      // distribute the primitives in bins along each axis, according to their reference point
+      std::array<std::array<Bin, NbBins>, 3> bins;
+      for(; first != beyond; ++first)
+      {
+        const Bounding_box pbox = m_traits.compute_bbox(*first, m_traits.bbm);
+        const auto rp = internal::Primitive_helper<Base>::get_reference_point(*first, m_traits);
+        const double coords[3] = { CGAL::to_double(rp.x()), CGAL::to_double(rp.y()), CGAL::to_double(rp.z()) };
+        for(int axis=0; axis<3; ++axis)
+        {
+          Bin& bin = bins[axis][bin_index(coords[axis], (bbox.min)(axis), (bbox.max)(axis))];
+          ++bin.size;
+          bin.bbox += pbox;
+        }
+      }
+
+      // For each axis, the cost of the median cut is estimated using the bins on each
+      // side of the bin containing the median. The latter is accounted on both sides.
+      const std::size_t left_size = n / 2;
+      typename Base::Axis best = Base::longest_axis(bbox);
+      double best_cost = (std::numeric_limits<double>::max)();
+      for(int axis=0; axis<3; ++axis)
+      {
+        if((bbox.max)(axis) == (bbox.min)(axis))
+          continue;
+
+        std::size_t median_bin = 0, acc = bins[axis][0].size;
+        while(acc <= left_size && median_bin + 1 < NbBins)
+          acc += bins[axis][++median_bin].size;
+
+        Bounding_box left_bbox, right_bbox;
+        for(int i=0; i<=int(median_bin); ++i)
+          left_bbox += bins[axis][i].bbox;
+        for(int i=int(median_bin); i<NbBins; ++i)
+          right_bbox += bins[axis][i].bbox;
+
+        const double cost = half_area(left_bbox) * double(left_size) +
+                            half_area(right_bbox) * double(n - left_size);
+        if(cost < best_cost)
+        {
+          best_cost = cost;
+          best = static_cast<typename Base::Axis>(axis);
+        }
+      }
+      return best;
+    }
+
+    static std::size_t bin_index(const double c, const double cmin, const double cmax)
+    {
+      if(cmax <= cmin)
+        return 0;
+      const double t = (c - cmin) / (cmax - cmin) * NbBins;
+      if(!(t > 0.)) // also handles NaN
+        return 0;
+      return (std::min)(static_cast<std::size_t>(t), std::size_t(NbBins - 1));
+    }
+  };
+
+  Split_primitives split_primitives_object() const { return Split_primitives(*this); }
+};
+
+/// @}
+
+} // end namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_AABB_SAH_TRAITS_3_H
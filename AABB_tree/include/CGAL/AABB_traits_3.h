@@ -451,7 +451,7 @@ public:
 
   static Axis longest_axis(const Bounding_box& bbox);
 
-private:
+protected:
   /**
    * @brief Computes bounding box of one primitive
    * @param pr the primitive
@@ -21,17 +21,28 @@
 
 #include <vector>
 #include <iterator>
+#include <istream>
+#include <ostream>
+#include <cstdint>
 #include <CGAL/AABB_tree/internal/AABB_traversal_traits.h>
 #include <CGAL/AABB_tree/internal/AABB_node.h>
 #include <CGAL/AABB_tree/internal/AABB_search_tree.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
+#include <CGAL/AABB_tree/internal/hilbert_ordering.h>
+#include <CGAL/tags.h>
 #include <optional>
 
 #ifdef CGAL_HAS_THREADS
 #include <CGAL/mutex.h>
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 /// \file AABB_tree.h
 
 namespace CGAL {
@@ -145,6 +156,19 @@ namespace CGAL {
     /// primitives of the tree.
     template<typename ... T>
     void build(T&& ...);
+
+    /// triggers the (re)construction of the internal tree structure, similarly to `build()`.
+    /// If `ConcurrencyTag` is `CGAL::Parallel_tag`, the subtrees are constructed
+    /// concurrently. The tree obtained, and therefore the result of any query,
+    /// is identical to the one obtained with a sequential construction.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel construction.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \note The functors `AABBTraits::Compute_bbox` and `AABBTraits::Split_primitives`
+    /// are called concurrently on disjoint ranges of primitives in the parallel case.
+    template<typename ConcurrencyTag>
+    void build();
 #ifndef DOXYGEN_RUNNING
     void build();
 
@@ -154,12 +178,43 @@ namespace CGAL {
     template <class ComputeBbox, class SplitPrimitives>
     void custom_build(const ComputeBbox& compute_bbox,
                       const SplitPrimitives& split_primitives);
+
+    /// same as above, with the possibility to construct the tree in parallel
+    template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+    void custom_build(const ComputeBbox& compute_bbox,
+                      const SplitPrimitives& split_primitives);
 #endif
     ///@}
 
     /// \name Operations
     ///@{
 
+    /// updates the bounding boxes of the nodes of the tree after the geometry of
+    /// the primitives has changed (for example after some vertices of the mesh
+    /// the primitives are built from have been moved), without changing the structure
+    /// of the tree. The boxes are recomputed bottom-up in linear time.
+    ///
+    /// As the structure of the tree is kept, its efficiency degrades if the primitives
+    /// move too much. A subtree is built again from scratch if the overlap of the
+    /// bounding boxes of the two children of its root is larger than
+    /// `rebuild_threshold` times the size of their union, where the size of a box
+    /// is the measure used by the surface area heuristic (half the surface area in 3D,
+    /// half the perimeter in 2D). The default value `1` disables the rebuilding of subtrees.
+    ///
+    /// If the tree has not been built yet, or if primitives have been inserted
+    /// since the last construction, this function is equivalent to `build<ConcurrencyTag>()`.
+    /// If the internal KD-tree used to accelerate distance queries was built from
+    /// the reference points of the primitives, it is cleared and will be rebuilt by
+    /// the next distance query.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel update.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \pre The primitives do not cache their datum, and the set of primitives is unchanged.
+    /// \pre `0 < rebuild_threshold <= 1`
+    template <typename ConcurrencyTag = Sequential_tag>
+    void refit(const double rebuild_threshold = 1.);
+
     /// is equivalent to calling `clear()`, `insert(first,last,t...)`, and `build()`
     template<typename ConstPrimitiveIterator,typename ... T>
     void rebuild(ConstPrimitiveIterator first, ConstPrimitiveIterator beyond,T&& ...);
@@ -377,6 +432,47 @@ public:
     Point_and_primitive_id closest_point_and_primitive(const Point& query) const;
 
 
+    ///@}
+
+    /// \name Batched Queries
+    ///
+    /// The following functions answer a whole range of queries at once.
+    /// The queries are first sorted along a Hilbert curve so that consecutive
+    /// queries are spatially close: the parts of the tree visited by a query
+    /// are then likely to be in cache for the next one and, for distance queries,
+    /// the result of a query is used as hint for the next one.
+    /// The results are reported in the order of the input queries.
+    ///@{
+
+    /// puts in `out` the `Point_and_primitive_id` realizing the smallest distance
+    /// between each point of `queries` and all input primitives, in the same order
+    /// as the points of `queries`.
+    /// The result is the same as calling `closest_point_and_primitive()` for each query,
+    /// except that in case there are several closest points, a different one might be reported.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel computation.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`
+    /// \tparam OutputIterator an output iterator accepting `Point_and_primitive_id`
+    ///
+    /// \pre `!empty()`
+    template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator closest_points_and_primitives(const PointRange& queries, OutputIterator out) const;
+
+    /// puts in `out`, for each ray of `queries` and in the same order, the result
+    /// of `first_intersected_primitive()` called on that ray, that is
+    /// an object of type `std::optional<Primitive_id>`.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel computation.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam RayRange a model of `ConstRange` with value type `AABBTraits::Ray`
+    /// \tparam OutputIterator an output iterator accepting `std::optional<Primitive_id>`
+    ///
+    /// `AABBTraits` must be a model of `AABBRayIntersectionTraits` to
+    /// call this member function.
+    template <typename ConcurrencyTag = Sequential_tag, typename RayRange, typename OutputIterator>
+    OutputIterator first_intersected_primitives(const RayRange& queries, OutputIterator out) const;
+
     ///@}
 
     /// \name Accelerating the Distance Queries
@@ -478,10 +574,67 @@ public:
 
     ///@}
 
+    /// \name Serialization
+    ///
+    /// A built tree can be saved in a binary format and loaded later, possibly by
+    /// another process, without recomputing the hierarchy of bounding boxes: loading
+    /// a tree only consists in creating the primitives and copying the node boxes,
+    /// in linear time. The format stores the order of the primitives in the tree as
+    /// indices in the input range of primitives, together with the bounding boxes of the nodes.
+    /// It is a raw binary format and is not portable across platforms having different endianness.
+    ///
+    /// The internal KD-tree used to accelerate distance queries is not saved. For a process that only
+    /// answers a few distance queries, calling `do_not_accelerate_distance_queries()` avoids its construction.
+    ///@{
+
+    /// writes the tree to `os`. The tree is built first if needed.
+    ///
+    /// \tparam IdIndexMap a model of `ReadablePropertyMap` with `Primitive_id` as key type
+    ///                    and `std::size_t` as value type
+    ///
+    /// \param os the output stream, that must be opened in binary mode
+    /// \param id_index a property map associating to the id of each primitive its position
+    ///                 in the range used to create the primitives, for example `get(CGAL::face_index, tm)`
+    ///                 for a tree of `AABB_face_graph_triangle_primitive` over a `Surface_mesh` `tm`.
+    ///
+    /// \returns `true` if the writing was successful.
+    template <typename IdIndexMap>
+    bool save(std::ostream& os, IdIndexMap id_index) const;
+
+    /// clears the tree and loads a tree from `is`, that was written by `save()`.
+    /// The primitives are created from the range `[first, beyond)` and the extra
+    /// parameters `t...` as done by `insert(first, beyond, t...)`.
+    /// This range must be the one that was used to create the primitives of the saved tree,
+    /// and be consistent with the property map `id_index` passed to `save()`.
+    ///
+    /// \param is the input stream, that must be opened in binary mode
+    ///
+    /// \returns `true` if the reading was successful. Otherwise, the tree is empty.
+    template <typename InputIterator, typename ... T>
+    bool load(std::istream& is, InputIterator first, InputIterator beyond, T&& ... t);
+
+    ///@}
+
   private:
     template<typename AABBTree, typename SkipFunctor>
     friend class AABB_ray_intersection;
 
+    // calls `f(begin, end)` on subranges of [0, n[ covering it, concurrently in the parallel case
+    template <typename F>
+    static void for_each_batch(const std::size_t n, const F& f, const Sequential_tag&)
+    {
+      f(std::size_t(0), n);
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template <typename F>
+    static void for_each_batch(const std::size_t n, const F& f, const Parallel_tag&)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, 256),
+                        [&f](const tbb::blocked_range<std::size_t>& r){ f(r.begin(), r.end()); });
+    }
+#endif
+
     // clear nodes
     void clear_nodes()
     {
@@ -564,18 +717,98 @@ public:
      * @param first the first primitive to insert
      * @param beyond the last primitive to insert
      * @param range the number of primitive of the range
+     * @param children the first node available for the descendants of `node`
      * @param compute_bbox a functor
      * @param split_primitives a functor
+     * @param tag the concurrency tag
      *
      * [first,beyond[ is the range of primitives to be added to the tree.
+     * A subtree built over `range` primitives uses exactly `range-1` nodes:
+     * `node` itself and the `range-2` nodes starting at `children`. The
+     * position of each node in `m_nodes` thus only depends on the size of the
+     * subtrees, which makes it possible to construct disjoint subtrees concurrently.
      */
-    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives, typename ConcurrencyTag>
     void expand(Node& node,
                 ConstPrimitiveIterator first,
                 ConstPrimitiveIterator beyond,
                 const std::size_t range,
+                Node* children,
                 const ComputeBbox& compute_bbox,
-                const SplitPrimitives& split_primitives);
+                const SplitPrimitives& split_primitives,
+                const ConcurrencyTag& tag);
+
+    /**
+     * @brief Recomputes the bounding boxes of the nodes of a subtree.
+     * @param node the root node of the subtree
+     * @param first the first primitive of the subtree
+     * @param range the number of primitives of the subtree
+     * @param compute_bbox a functor
+     * @param tag the concurrency tag
+     * @return the bounding box of the primitives of the subtree
+     */
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename ConcurrencyTag>
+    Bounding_box refit_node(Node& node,
+                            ConstPrimitiveIterator first,
+                            const std::size_t range,
+                            const ComputeBbox& compute_bbox,
+                            const ConcurrencyTag& tag);
+
+    /**
+     * @brief Rebuilds from scratch the subtrees in which the bounding boxes of the two
+     * children of a node overlap too much, the node bounding boxes being up-to-date.
+     */
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives, typename ConcurrencyTag>
+    void rebuild_degraded_subtrees(Node& node,
+                                   ConstPrimitiveIterator first,
+                                   const std::size_t range,
+                                   const double rebuild_threshold,
+                                   const ComputeBbox& compute_bbox,
+                                   const SplitPrimitives& split_primitives,
+                                   const ConcurrencyTag& tag);
+
+    // magic number and version of the binary format used by save() and load()
+    static constexpr std::uint32_t serialization_magic = 0x41414254; // "AABT"
+    static constexpr std::uint32_t serialization_version = 1;
+
+    /**
+     * @brief Sets the children of the nodes of a subtree, following the same
+     * layout as `expand()`, the bounding boxes of the nodes being already set.
+     */
+    template<typename PrimitiveIterator>
+    void link_nodes(Node& node,
+                    PrimitiveIterator first,
+                    const std::size_t range,
+                    Node* children);
+
+    // the two children of a node are processed concurrently if and only if the
+    // number of primitives is sufficiently high to be worth the cost of launching new tasks
+    static bool is_worth_parallel_processing(const std::size_t range)
+    {
+      return range >= 1024;
+    }
+
+    // calls `f1()` and `f2()`, concurrently if `parallel` is `true`
+    template<typename F1, typename F2>
+    static void invoke_pair(const bool, const F1& f1, const F2& f2, const Sequential_tag&)
+    {
+      f1();
+      f2();
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename F1, typename F2>
+    static void invoke_pair(const bool parallel, const F1& f1, const F2& f2, const Parallel_tag&)
+    {
+      if(parallel)
+        tbb::parallel_invoke(f1, f2);
+      else
+      {
+        f1();
+        f2();
+      }
+    }
+#endif
 
   public:
     // returns a point which must be on one primitive
@@ -651,11 +884,6 @@ public:
       return std::addressof(m_nodes[0]);
     }
 
-    Node& new_node()
-    {
-      m_nodes.emplace_back();
-      return m_nodes.back();
-    }
   private:
     const Primitive& singleton_data() const {
       CGAL_assertion(size() == 1);
@@ -784,19 +1012,22 @@ public:
   }
 
   template<typename Tr>
-  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives, typename ConcurrencyTag>
   void
   AABB_tree<Tr>::expand(Node& node,
                         ConstPrimitiveIterator first,
                         ConstPrimitiveIterator beyond,
                         const std::size_t range,
+                        Node* children,
                         const ComputeBbox& compute_bbox,
-                        const SplitPrimitives& split_primitives)
+                        const SplitPrimitives& split_primitives,
+                        const ConcurrencyTag& tag)
   {
-    node.set_bbox(compute_bbox(first, beyond));
+    const Bounding_box bbox = compute_bbox(first, beyond);
+    node.set_bbox(bbox);
 
     // sort primitives along longest axis aabb
-    split_primitives(first, beyond, node.bbox());
+    split_primitives(first, beyond, bbox);
 
     switch(range)
     {
@@ -804,24 +1035,126 @@ public:
       node.set_children(*first, *(first+1));
       break;
     case 3:
-      node.set_children(*first, new_node());
-      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives);
+      node.set_children(*first, children[0]);
+      expand(node.right_child(), first+1, beyond, 2, children + 1, compute_bbox, split_primitives, tag);
       break;
     default:
       const std::size_t new_range = range/2;
-      node.set_children(new_node(), new_node());
-      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
-      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
+      node.set_children(children[0], children[1]);
+      invoke_pair(is_worth_parallel_processing(range),
+        [&]{ expand(node.left_child(), first, first + new_range, new_range, children + 2,
+                    compute_bbox, split_primitives, tag); },
+        [&]{ expand(node.right_child(), first + new_range, beyond, range - new_range, children + new_range,
+                    compute_bbox, split_primitives, tag); },
+        tag);
     }
   }
 
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename ConcurrencyTag>
+  typename AABB_tree<Tr>::Bounding_box
+  AABB_tree<Tr>::refit_node(Node& node,
+                            ConstPrimitiveIterator first,
+                            const std::size_t range,
+                            const ComputeBbox& compute_bbox,
+                            const ConcurrencyTag& tag)
+  {
+    Bounding_box bbox;
+    switch(range)
+    {
+    case 2:
+      bbox = compute_bbox(first, first + 2);
+      break;
+    case 3:
+      bbox = compute_bbox(first, first + 1) +
+             refit_node(node.right_child(), first + 1, 2, compute_bbox, tag);
+      break;
+    default:
+      const std::size_t new_range = range/2;
+      Bounding_box left_bbox, right_bbox;
+      invoke_pair(is_worth_parallel_processing(range),
+        [&]{ left_bbox = refit_node(node.left_child(), first, new_range, compute_bbox, tag); },
+        [&]{ right_bbox = refit_node(node.right_child(), first + new_range, range - new_range, compute_bbox, tag); },
+        tag);
+      bbox = left_bbox + right_bbox;
+    }
+    node.set_bbox(bbox);
+    return bbox;
+  }
+
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives, typename ConcurrencyTag>
+  void
+  AABB_tree<Tr>::rebuild_degraded_subtrees(Node& node,
+                                           ConstPrimitiveIterator first,
+                                           const std::size_t range,
+                                           const double rebuild_threshold,
+                                           const ComputeBbox& compute_bbox,
+                                           const SplitPrimitives& split_primitives,
+                                           const ConcurrencyTag& tag)
+  {
+    // subtrees with less than 4 primitives have a single possible structure
+    if(range < 4)
+      return;
+
+    const Bounding_box left_bbox = node.left_child().bbox();
+    const Bounding_box right_bbox = node.right_child().bbox();
+
+    // The quality of a node is measured by the overlap of the boxes of its children, using
+    // the same measure as the surface area heuristic: sum_i prod_{j!=i} extent_j,
+    // that is the half surface area in 3D and the half perimeter in 2D.
+    const int dim = Bounding_box::Ambient_dimension::value;
+    double extent[3] = {0, 0, 0}, overlap_extent[3] = {0, 0, 0};
+    for(int i=0; i<dim; ++i)
+    {
+      extent[i] = (std::max)((left_bbox.max)(i), (right_bbox.max)(i)) - (std::min)((left_bbox.min)(i), (right_bbox.min)(i));
+      overlap_extent[i] = (std::max)(0., (std::min)((left_bbox.max)(i), (right_bbox.max)(i)) - (std::max)((left_bbox.min)(i), (right_bbox.min)(i)));
+    }
+    double measure = 0, overlap_measure = 0;
+    for(int i=0; i<dim; ++i)
+    {
+      double m = 1, om = 1;
+      for(int j=0; j<dim; ++j)
+        if(j != i)
+        {
+          m *= extent[j];
+          om *= overlap_extent[j];
+        }
+      measure += m;
+      overlap_measure += om;
+    }
+
+    if(overlap_measure > rebuild_threshold * measure)
+    {
+      // the children of `node` are the first nodes used by the subtree
+      expand(node, first, first + range, range, std::addressof(node.left_child()),
+             compute_bbox, split_primitives, tag);
+      return;
+    }
+
+    const std::size_t new_range = range/2;
+    invoke_pair(is_worth_parallel_processing(range),
+      [&]{ rebuild_degraded_subtrees(node.left_child(), first, new_range, rebuild_threshold,
+                                     compute_bbox, split_primitives, tag); },
+      [&]{ rebuild_degraded_subtrees(node.right_child(), first + new_range, range - new_range, rebuild_threshold,
+                                     compute_bbox, split_primitives, tag); },
+      tag);
+  }
+
 
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
   void AABB_tree<Tr>::build()
   {
-    custom_build(m_traits.compute_bbox_object(),
-                 m_traits.split_primitives_object());
+    build<Sequential_tag>();
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::build()
+  {
+    custom_build<ConcurrencyTag>(m_traits.compute_bbox_object(),
+                                 m_traits.split_primitives_object());
   }
 #ifndef DOXYGEN_RUNNING
   // Build the data structure, after calls to insert(..)
@@ -831,19 +1164,35 @@ public:
     const ComputeBbox& compute_bbox,
     const SplitPrimitives& split_primitives)
   {
+    custom_build<Sequential_tag>(compute_bbox, split_primitives);
+  }
+
+  template<typename Tr>
+  template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+  void AABB_tree<Tr>::custom_build(
+    const ComputeBbox& compute_bbox,
+    const SplitPrimitives& split_primitives)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     clear_nodes();
 
     if(m_primitives.size() > 1) {
 
       // allocates tree nodes
-      m_nodes.reserve(m_primitives.size()-1);
+      m_nodes.resize(m_primitives.size()-1);
 
       // constructs the tree
-      expand(new_node(),
+      expand(m_nodes[0],
              m_primitives.begin(), m_primitives.end(),
              m_primitives.size(),
+             m_nodes.data() + 1,
              compute_bbox,
-             split_primitives);
+             split_primitives,
+             ConcurrencyTag());
     }
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build.store(false, std::memory_order_release); // in case build() is triggered by a call to root_node()
@@ -852,6 +1201,182 @@ public:
 #endif
   }
 #endif
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::refit(const double rebuild_threshold)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    CGAL_precondition(rebuild_threshold > 0 && rebuild_threshold <= 1);
+
+    // reference points have moved
+    if(m_use_default_search_tree)
+      clear_search_tree();
+
+#ifdef CGAL_HAS_THREADS
+    bool m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+#endif
+    if(m_need_build || m_nodes.size() + 1 != m_primitives.size())
+    {
+      build<ConcurrencyTag>();
+      return;
+    }
+
+    if(m_primitives.size() < 2)
+      return;
+
+    refit_node(m_nodes[0], m_primitives.begin(), m_primitives.size(),
+               m_traits.compute_bbox_object(), ConcurrencyTag());
+
+    if(rebuild_threshold < 1)
+      rebuild_degraded_subtrees(m_nodes[0], m_primitives.begin(), m_primitives.size(), rebuild_threshold,
+                                m_traits.compute_bbox_object(), m_traits.split_primitives_object(),
+                                ConcurrencyTag());
+  }
+
+  template<typename Tr>
+  template<typename PrimitiveIterator>
+  void
+  AABB_tree<Tr>::link_nodes(Node& node,
+                            PrimitiveIterator first,
+                            const std::size_t range,
+                            Node* children)
+  {
+    switch(range)
+    {
+    case 2:
+      node.set_children(*first, *(first+1));
+      break;
+    case 3:
+      node.set_children(*first, children[0]);
+      link_nodes(node.right_child(), first+1, 2, children + 1);
+      break;
+    default:
+      const std::size_t new_range = range/2;
+      node.set_children(children[0], children[1]);
+      link_nodes(node.left_child(), first, new_range, children + 2);
+      link_nodes(node.right_child(), first + new_range, range - new_range, children + new_range);
+    }
+  }
+
+  template<typename Tr>
+  template<typename IdIndexMap>
+  bool AABB_tree<Tr>::save(std::ostream& os, IdIndexMap id_index) const
+  {
+    if(m_primitives.size() > 1)
+      root_node(); // triggers the construction if needed, which reorders the primitives
+
+    const int dim = Bounding_box::Ambient_dimension::value;
+    const std::uint64_t nb_primitives = m_primitives.size();
+    const std::uint32_t header[4] = { serialization_magic, serialization_version,
+                                      std::uint32_t(dim), std::uint32_t(sizeof(double)) };
+    os.write(reinterpret_cast<const char*>(header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(&nb_primitives), sizeof(nb_primitives));
+
+    // order of the primitives in the tree
+    std::vector<std::uint64_t> indices;
+    indices.reserve(m_primitives.size());
+    for(const Primitive& p : m_primitives)
+      indices.push_back(std::uint64_t(get(id_index, p.id())));
+    os.write(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(std::uint64_t));
+
+    // node boxes, in the order of the nodes
+    if(m_primitives.size() > 1)
+    {
+      std::vector<double> coords;
+      coords.reserve(2 * dim * m_nodes.size());
+      for(const Node& node : m_nodes)
+      {
+        const Bounding_box bbox = node.bbox();
+        for(int i=0; i<dim; ++i)
+          coords.push_back((bbox.min)(i));
+        for(int i=0; i<dim; ++i)
+          coords.push_back((bbox.max)(i));
+      }
+      os.write(reinterpret_cast<const char*>(coords.data()), coords.size() * sizeof(double));
+    }
+
+    return bool(os);
+  }
+
+  template<typename Tr>
+  template<typename InputIterator, typename ... T>
+  bool AABB_tree<Tr>::load(std::istream& is, InputIterator first, InputIterator beyond, T&& ... t)
+  {
+    clear();
+
+    const int dim = Bounding_box::Ambient_dimension::value;
+    std::uint32_t header[4];
+    std::uint64_t nb_primitives = 0;
+    if(!is.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+       header[0] != serialization_magic || header[1] != serialization_version ||
+       header[2] != std::uint32_t(dim) || header[3] != std::uint32_t(sizeof(double)) ||
+       !is.read(reinterpret_cast<char*>(&nb_primitives), sizeof(nb_primitives)))
+      return false;
+
+    insert(first, beyond, std::forward<T>(t)...);
+    if(nb_primitives != m_primitives.size())
+    {
+      clear();
+      return false;
+    }
+
+    std::vector<std::uint64_t> indices(m_primitives.size());
+    if(!is.read(reinterpret_cast<char*>(indices.data()), indices.size() * sizeof(std::uint64_t)))
+    {
+      clear();
+      return false;
+    }
+
+    // reorder the primitives as in the saved tree
+    Primitives primitives;
+    primitives.reserve(m_primitives.size());
+    std::vector<bool> used(m_primitives.size(), false);
+    for(std::uint64_t i : indices)
+    {
+      if(i >= m_primitives.size() || used[i])
+      {
+        clear();
+        return false;
+      }
+      used[i] = true;
+      primitives.push_back(m_primitives[i]);
+    }
+    m_primitives.swap(primitives);
+
+    if(m_primitives.size() > 1)
+    {
+      std::vector<double> coords(2 * dim * (m_primitives.size() - 1));
+      if(!is.read(reinterpret_cast<char*>(coords.data()), coords.size() * sizeof(double)))
+      {
+        clear();
+        return false;
+      }
+
+      m_nodes.resize(m_primitives.size() - 1);
+      for(std::size_t n=0; n<m_nodes.size(); ++n)
+      {
+        const double* c = coords.data() + 2 * dim * n;
+        Bounding_box bbox;
+        if constexpr(dim == 2)
+          bbox = Bounding_box(c[0], c[1], c[2], c[3]);
+        else
+          bbox = Bounding_box(c[0], c[1], c[2], c[3], c[4], c[5]);
+        m_nodes[n].set_bbox(bbox);
+      }
+      link_nodes(m_nodes[0], m_primitives.begin(), m_primitives.size(), m_nodes.data() + 1);
+    }
+
+#ifdef CGAL_HAS_THREADS
+    m_atomic_need_build.store(false, std::memory_order_release);
+#else
+    m_need_build = false;
+#endif
+    return true;
+  }
+
   // constructs the search KD tree from given points
   // to accelerate the distance queries
   template<typename Tr>
@@ -1054,6 +1579,82 @@ public:
     return projection_traits.closest_point_and_primitive();
   }
 
+  template<typename Tr>
+  template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  OutputIterator
+    AABB_tree<Tr>::closest_points_and_primitives(const PointRange& queries,
+                                                 OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const std::vector<Point> points(std::begin(queries), std::end(queries));
+    if(points.empty())
+      return out;
+
+    CGAL_precondition(!empty());
+    const std::vector<std::size_t> order = internal::AABB_tree::hilbert_ordering(points);
+
+    // make sure the trees are built before a possible concurrent access
+    if(size() > 1)
+      root_node();
+    best_hint(points[order[0]]);
+
+    std::vector<Point_and_primitive_id> results(points.size());
+    for_each_batch(points.size(), [&](const std::size_t begin, const std::size_t end)
+    {
+      // the result of a query is a good hint for the next one, which is close by
+      Point_and_primitive_id hint = best_hint(points[order[begin]]);
+      for(std::size_t i=begin; i<end; ++i)
+      {
+        hint = closest_point_and_primitive(points[order[i]], hint);
+        results[order[i]] = hint;
+      }
+    }, ConcurrencyTag());
+
+    return std::copy(results.begin(), results.end(), out);
+  }
+
+  template<typename Tr>
+  template <typename ConcurrencyTag, typename RayRange, typename OutputIterator>
+  OutputIterator
+    AABB_tree<Tr>::first_intersected_primitives(const RayRange& queries,
+                                                OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef typename std::iterator_traits<decltype(std::begin(queries))>::value_type Ray;
+
+    const std::vector<Ray> rays(std::begin(queries), std::end(queries));
+    if(rays.empty())
+      return out;
+
+    // rays are ordered according to their source
+    std::vector<Point> sources;
+    sources.reserve(rays.size());
+    for(const Ray& r : rays)
+      sources.push_back(r.source());
+    const std::vector<std::size_t> order = internal::AABB_tree::hilbert_ordering(sources);
+
+    // make sure the tree is built before a possible concurrent access
+    if(size() > 1)
+      root_node();
+
+    std::vector<std::optional<Primitive_id> > results(rays.size());
+    for_each_batch(rays.size(), [&](const std::size_t begin, const std::size_t end)
+    {
+      for(std::size_t i=begin; i<end; ++i)
+        results[order[i]] = first_intersected_primitive(rays[order[i]]);
+    }, ConcurrencyTag());
+
+    return std::copy(results.begin(), results.end(), out);
+  }
+
 } // end namespace CGAL
 
 #include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
@@ -19,11 +19,101 @@
 #include <CGAL/Profile_counter.h>
 #include <CGAL/Cartesian_converter.h>
 #include <CGAL/intersections.h>
+#include <CGAL/Bbox_2.h>
 #include <CGAL/Bbox_3.h>
+#include <CGAL/tags.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace CGAL {
 
+namespace internal {
+namespace AABB_tree {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Use_float_bbox, Use_float_bbox, false)
+
+// stores the bounding box of a node as is
+template <class Bounding_box>
+class Node_bbox
+{
+  Bounding_box m_bbox;
+
+public:
+  void set(const Bounding_box& bbox) { m_bbox = bbox; }
+  const Bounding_box& get() const { return m_bbox; }
+};
+
+// stores the bounding box of a node with float coordinates,
+// rounded outward so that the box stored contains the input box.
+template <class Bounding_box>
+class Float_node_bbox
+{
+  static constexpr int dim = Bounding_box::Ambient_dimension::value;
+  std::array<float, 2*dim> m_coords;
+
+  static float round_down(const double d)
+  {
+    float f = static_cast<float>(d);
+    if(static_cast<double>(f) > d)
+      f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+    return f;
+  }
+
+  static float round_up(const double d)
+  {
+    float f = static_cast<float>(d);
+    if(static_cast<double>(f) < d)
+      f = std::nextafter(f, std::numeric_limits<float>::infinity());
+    return f;
+  }
+
+  template <std::size_t ... I>
+  Bounding_box make_bbox(std::index_sequence<I...>) const
+  {
+    return Bounding_box(static_cast<double>(m_coords[I])...);
+  }
+
+public:
+  Float_node_bbox() { set(Bounding_box()); }
+
+  void set(const Bounding_box& bbox)
+  {
+    for(int i=0; i<dim; ++i)
+    {
+      m_coords[i] = round_down((bbox.min)(i));
+      m_coords[dim+i] = round_up((bbox.max)(i));
+    }
+  }
+
+  // the float to double conversion is exact
+  Bounding_box get() const
+  {
+    return make_bbox(std::make_index_sequence<2*dim>());
+  }
+};
+
+template <class AABBTraits, bool use_float_bbox = Has_nested_type_Use_float_bbox<AABBTraits>::value>
+struct Node_bbox_storage
+{
+  typedef Node_bbox<typename AABBTraits::Bounding_box> type;
+};
+
+template <class AABBTraits>
+struct Node_bbox_storage<AABBTraits, true>
+{
+  typedef std::conditional_t<AABBTraits::Use_float_bbox::value,
+                             Float_node_bbox<typename AABBTraits::Bounding_box>,
+                             Node_bbox<typename AABBTraits::Bounding_box> > type;
+};
+
+} // namespace AABB_tree
+} // namespace internal
+
 /**
  * @class AABB_node
  *
@@ -40,8 +130,7 @@ public:
 
   /// Constructor
   AABB_node()
-    : m_bbox()
-    , m_p_left_child(nullptr)
+    : m_p_left_child(nullptr)
     , m_p_right_child(nullptr)      { };
 
   AABB_node(Self&& node) = default;
@@ -50,8 +139,9 @@ public:
   AABB_node(const Self& src) = delete;
   Self& operator=(const Self& src) = delete;
 
-  /// Returns the bounding box of the node
-  const Bounding_box& bbox() const { return m_bbox; }
+  /// Returns the bounding box of the node. If the nodes of the tree store float
+  /// bounding boxes, it is a copy of a box containing the box of the primitives of the node.
+  decltype(auto) bbox() const { return m_bbox.get(); }
 
   /**
    * @brief General traversal query
@@ -106,7 +196,7 @@ public:
   }
   void set_bbox(const Bounding_box& bbox)
   {
-    m_bbox = bbox;
+    m_bbox.set(bbox);
   }
 
   Node& left_child() { return *static_cast<Node*>(m_p_left_child); }
@@ -116,7 +206,7 @@ public:
 
 private:
   /// node bounding box
-  Bounding_box m_bbox;
+  typename internal::AABB_tree::Node_bbox_storage<AABBTraits>::type m_bbox;
 
   /// children nodes, either pointing towards children (if children are not leaves),
   /// or pointing toward input primitives (if children are leaves).
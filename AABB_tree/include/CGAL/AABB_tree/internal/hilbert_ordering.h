@@ -0,0 +1,73 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : GeometryFactory
+//
+
+#ifndef CGAL_AABB_TREE_INTERNAL_HILBERT_ORDERING_H
+#define CGAL_AABB_TREE_INTERNAL_HILBERT_ORDERING_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Dimension.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+
+#include <numeric>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+template <typename Point, int dim = Ambient_dimension<Point>::value>
+struct Hilbert_ordering;
+
+template <typename Point>
+struct Hilbert_ordering<Point, 2>
+{
+  template <typename PointMap>
+  static void sort(std::vector<std::size_t>& indices, PointMap pm)
+  {
+    typedef typename Kernel_traits<Point>::Kernel Kernel;
+    hilbert_sort(indices.begin(), indices.end(),
+                 Spatial_sort_traits_adapter_2<Kernel, PointMap>(pm));
+  }
+};
+
+template <typename Point>
+struct Hilbert_ordering<Point, 3>
+{
+  template <typename PointMap>
+  static void sort(std::vector<std::size_t>& indices, PointMap pm)
+  {
+    typedef typename Kernel_traits<Point>::Kernel Kernel;
+    hilbert_sort(indices.begin(), indices.end(),
+                 Spatial_sort_traits_adapter_3<Kernel, PointMap>(pm));
+  }
+};
+
+// returns the indices of `points` sorted along a Hilbert curve,
+// so that consecutive queries are close to each other.
+template <typename Point>
+std::vector<std::size_t> hilbert_ordering(const std::vector<Point>& points)
+{
+  std::vector<std::size_t> indices(points.size());
+  std::iota(indices.begin(), indices.end(), std::size_t(0));
+  Hilbert_ordering<Point>::sort(indices, make_property_map(points));
+  return indices;
+}
+
+} } } // end of namespace CGAL::internal::AABB_tree
+
+#endif // CGAL_AABB_TREE_INTERNAL_HILBERT_ORDERING_H
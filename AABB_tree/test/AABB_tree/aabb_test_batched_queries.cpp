@@ -0,0 +1,106 @@
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_segment_primitive_2.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <cassert>
+#include <fstream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+
+typedef K::Point_3 Point_3;
+typedef K::Ray_3 Ray_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive_3;
+typedef CGAL::AABB_traits_3<K, Primitive_3> Traits_3;
+typedef CGAL::AABB_tree<Traits_3> Tree_3;
+
+typedef CGAL::Simple_cartesian<double> K2;
+typedef K2::Point_2 Point_2;
+typedef K2::Segment_2 Segment_2;
+typedef std::vector<Segment_2>::const_iterator Iterator;
+typedef CGAL::AABB_segment_primitive_2<K2, Iterator> Primitive_2;
+typedef CGAL::AABB_traits_2<K2, Primitive_2> Traits_2;
+typedef CGAL::AABB_tree<Traits_2> Tree_2;
+
+template <typename ConcurrencyTag>
+void test_3(const Tree_3& tree)
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point_3> gen(1., rng);
+  std::vector<Point_3> points;
+  std::vector<Ray_3> rays;
+  for(int i=0; i<2000; ++i)
+  {
+    points.push_back(*gen++);
+    rays.emplace_back(points.back(), *gen++);
+  }
+
+  std::vector<Tree_3::Point_and_primitive_id> closest;
+  tree.closest_points_and_primitives<ConcurrencyTag>(points, std::back_inserter(closest));
+  assert(closest.size() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(CGAL::squared_distance(points[i], closest[i].first) == tree.squared_distance(points[i]));
+
+  std::vector<std::optional<Tree_3::Primitive_id> > hits;
+  tree.first_intersected_primitives<ConcurrencyTag>(rays, std::back_inserter(hits));
+  assert(hits.size() == rays.size());
+  for(std::size_t i=0; i<rays.size(); ++i)
+    assert(hits[i] == tree.first_intersected_primitive(rays[i]));
+}
+
+void test_2()
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_square_2<Point_2> gen(1., rng);
+  std::vector<Segment_2> segments;
+  for(int i=0; i<500; ++i)
+    segments.emplace_back(*gen++, *gen++);
+
+  Tree_2 tree(segments.begin(), segments.end());
+  std::vector<Point_2> points;
+  for(int i=0; i<500; ++i)
+    points.push_back(*gen++);
+
+  std::vector<Tree_2::Point_and_primitive_id> closest;
+  tree.closest_points_and_primitives(points, std::back_inserter(closest));
+  assert(closest.size() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(CGAL::squared_distance(points[i], closest[i].first) == tree.squared_distance(points[i]));
+
+  // empty query range
+  std::vector<Point_2> no_points;
+  closest.clear();
+  tree.closest_points_and_primitives(no_points, std::back_inserter(closest));
+  assert(closest.empty());
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  input >> mesh;
+  assert(!is_empty(mesh));
+
+  Tree_3 tree(faces(mesh).first, faces(mesh).second, mesh);
+  test_3<CGAL::Sequential_tag>(tree);
+
+  Tree_3 other_tree(faces(mesh).first, faces(mesh).second, mesh);
+  test_3<CGAL::Parallel_if_available_tag>(other_tree);
+
+  test_2();
+
+  std::cout << "Batched queries test OK" << std::endl;
+  return EXIT_SUCCESS;
+}
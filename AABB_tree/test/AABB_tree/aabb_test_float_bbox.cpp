@@ -0,0 +1,104 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_SAH_traits_3.h>
+#include <CGAL/AABB_float_bbox_traits.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_segment_primitive_2.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <cassert>
+#include <fstream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Ray_3 Ray_3;
+typedef K::Segment_3 Segment_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive_3;
+
+template <class Traits, class Float_traits>
+void test_3(const Mesh& mesh)
+{
+  typedef CGAL::AABB_tree<Traits> Tree;
+  typedef CGAL::AABB_tree<Float_traits> Float_tree;
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  Float_tree float_tree(faces(mesh).first, faces(mesh).second, mesh);
+  float_tree.build();
+
+  const CGAL::Bbox_3 bb = tree.bbox(), fbb = float_tree.bbox();
+  assert(fbb.xmin() <= bb.xmin() && fbb.ymin() <= bb.ymin() && fbb.zmin() <= bb.zmin());
+  assert(fbb.xmax() >= bb.xmax() && fbb.ymax() >= bb.ymax() && fbb.zmax() >= bb.zmax());
+
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point_3> gen(1., rng);
+  for(int i=0; i<500; ++i)
+  {
+    const Point_3 q = *gen++;
+    const Point_3 r = *gen++;
+
+    assert(tree.squared_distance(q) == float_tree.squared_distance(q));
+
+    const Segment_3 segment_query(q, r);
+    assert(tree.number_of_intersected_primitives(segment_query) ==
+           float_tree.number_of_intersected_primitives(segment_query));
+
+    const Ray_3 ray_query(q, r);
+    assert(tree.first_intersected_primitive(ray_query) ==
+           float_tree.first_intersected_primitive(ray_query));
+  }
+}
+
+void test_2()
+{
+  typedef CGAL::Simple_cartesian<double> K2;
+  typedef K2::Point_2 Point_2;
+  typedef K2::Segment_2 Segment_2;
+  typedef std::vector<Segment_2>::const_iterator Iterator;
+  typedef CGAL::AABB_segment_primitive_2<K2, Iterator> Primitive;
+  typedef CGAL::AABB_traits_2<K2, Primitive> Traits;
+  typedef CGAL::AABB_tree<Traits> Tree;
+  typedef CGAL::AABB_tree<CGAL::AABB_float_bbox_traits<Traits> > Float_tree;
+
+  CGAL::Random rng(1);
+  CGAL::Random_points_in_square_2<Point_2> gen(1., rng);
+  std::vector<Segment_2> segments;
+  for(int i=0; i<500; ++i)
+    segments.emplace_back(*gen++, *gen++);
+
+  Tree tree(segments.begin(), segments.end());
+  Float_tree float_tree(segments.begin(), segments.end());
+  for(int i=0; i<500; ++i)
+  {
+    const Point_2 q = *gen++;
+    assert(tree.squared_distance(q) == float_tree.squared_distance(q));
+    const Segment_2 s(q, *gen++);
+    assert(tree.number_of_intersected_primitives(s) == float_tree.number_of_intersected_primitives(s));
+  }
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  input >> mesh;
+  assert(!is_empty(mesh));
+
+  typedef CGAL::AABB_traits_3<K, Primitive_3> Traits;
+  typedef CGAL::AABB_SAH_traits_3<K, Primitive_3> SAH_traits;
+  test_3<Traits, CGAL::AABB_float_bbox_traits<Traits> >(mesh);
+  test_3<SAH_traits, CGAL::AABB_float_bbox_traits<SAH_traits> >(mesh);
+
+  test_2();
+
+  std::cout << "Float bbox test OK" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_triangle_primitive_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive_3<K, Iterator> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+int main()
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rng);
+
+  // small triangles spread in the unit cube
+  std::vector<Triangle> triangles;
+  const std::size_t nb_triangles = 20000;
+  triangles.reserve(nb_triangles);
+  for(std::size_t i=0; i<nb_triangles; ++i)
+  {
+    const Point p = *gen++;
+    const Vector u(rng.get_double(0, 0.05), rng.get_double(0, 0.05), rng.get_double(0, 0.05));
+    const Vector v(rng.get_double(0, 0.05), rng.get_double(0, 0.05), rng.get_double(0, 0.05));
+    triangles.emplace_back(p, p + u, p + v);
+  }
+
+  Tree sequential_tree(triangles.begin(), triangles.end());
+  sequential_tree.build<CGAL::Sequential_tag>();
+
+  Tree parallel_tree(triangles.begin(), triangles.end());
+  parallel_tree.build<CGAL::Parallel_if_available_tag>();
+
+  assert(sequential_tree.size() == parallel_tree.size());
+  assert(sequential_tree.bbox() == parallel_tree.bbox());
+
+  // both trees must provide the same answers
+  sequential_tree.do_not_accelerate_distance_queries();
+  parallel_tree.do_not_accelerate_distance_queries();
+  for(int i=0; i<200; ++i)
+  {
+    const Point q = *gen++;
+    const Point r = *gen++;
+
+    const Tree::Point_and_primitive_id s_pp = sequential_tree.closest_point_and_primitive(q);
+    const Tree::Point_and_primitive_id p_pp = parallel_tree.closest_point_and_primitive(q);
+    assert(s_pp.first == p_pp.first);
+    assert(s_pp.second == p_pp.second);
+
+    const Segment segment_query(q, r);
+    assert(sequential_tree.number_of_intersected_primitives(segment_query) ==
+           parallel_tree.number_of_intersected_primitives(segment_query));
+
+    const Ray ray_query(q, r);
+    assert(sequential_tree.first_intersected_primitive(ray_query) ==
+           parallel_tree.first_intersected_primitive(ray_query));
+  }
+
+  // rebuilding a tree in parallel after new insertions
+  std::vector<Triangle> more_triangles(triangles.begin(), triangles.begin() + 1000);
+  parallel_tree.insert(more_triangles.begin(), more_triangles.end());
+  parallel_tree.build<CGAL::Parallel_if_available_tag>();
+  assert(parallel_tree.size() == nb_triangles + 1000);
+  assert(parallel_tree.bbox() == sequential_tree.bbox());
+
+  std::cout << "Parallel build test OK" << std::endl;
+  return EXIT_SUCCESS;
+}
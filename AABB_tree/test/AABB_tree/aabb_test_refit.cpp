@@ -0,0 +1,88 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_float_bbox_traits.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <cassert>
+#include <fstream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Vector_3 Vector_3;
+typedef K::Ray_3 Ray_3;
+typedef K::Segment_3 Segment_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+
+template <class Tree>
+void compare(const Tree& tree, const Mesh& mesh, CGAL::Random& rng)
+{
+  Tree reference(faces(mesh).first, faces(mesh).second, mesh);
+  assert(tree.bbox() == reference.bbox());
+
+  CGAL::Random_points_in_cube_3<Point_3> gen(1., rng);
+  for(int i=0; i<300; ++i)
+  {
+    const Point_3 q = *gen++;
+    const Point_3 r = *gen++;
+    assert(tree.squared_distance(q) == reference.squared_distance(q));
+    const Segment_3 segment_query(q, r);
+    assert(tree.number_of_intersected_primitives(segment_query) ==
+           reference.number_of_intersected_primitives(segment_query));
+    const Ray_3 ray_query(q, r);
+    assert(tree.first_intersected_primitive(ray_query) ==
+           reference.first_intersected_primitive(ray_query));
+  }
+}
+
+template <class Tree, class ConcurrencyTag>
+void test(Mesh mesh)
+{
+  CGAL::Random rng(0);
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  tree.accelerate_distance_queries();
+
+  // small perturbation of all the vertices
+  for(Mesh::Vertex_index v : vertices(mesh))
+    mesh.point(v) = mesh.point(v) + Vector_3(rng.get_double(-0.01, 0.01),
+                                             rng.get_double(-0.01, 0.01),
+                                             rng.get_double(-0.01, 0.01));
+  tree.template refit<ConcurrencyTag>();
+  compare(tree, mesh, rng);
+
+  // large deformation, with the rebuilding of degraded subtrees
+  for(Mesh::Vertex_index v : vertices(mesh))
+    if(mesh.point(v).x() > 0)
+      mesh.point(v) = mesh.point(v) + Vector_3(-0.3, 0.2, 0);
+  tree.template refit<ConcurrencyTag>(0.5);
+  compare(tree, mesh, rng);
+
+  // refit() builds the tree if needed
+  Tree other_tree(faces(mesh).first, faces(mesh).second, mesh);
+  other_tree.template refit<ConcurrencyTag>();
+  compare(other_tree, mesh, rng);
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  input >> mesh;
+  assert(!is_empty(mesh));
+
+  test<CGAL::AABB_tree<Traits>, CGAL::Sequential_tag>(mesh);
+  test<CGAL::AABB_tree<Traits>, CGAL::Parallel_if_available_tag>(mesh);
+  test<CGAL::AABB_tree<CGAL::AABB_float_bbox_traits<Traits> >, CGAL::Sequential_tag>(mesh);
+
+  std::cout << "Refit test OK" << std::endl;
+  return EXIT_SUCCESS;
+}
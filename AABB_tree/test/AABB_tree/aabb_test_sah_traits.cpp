@@ -0,0 +1,83 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_SAH_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+
+typedef K::Point_3 Point;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef CGAL::Surface_mesh<Point> Mesh;
+
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_SAH_traits_3<K, Primitive> SAH_traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_tree<SAH_traits> SAH_tree;
+
+int main()
+{
+  // a grid of small triangles with a few very large ones
+  Mesh mesh;
+  CGAL::Random rng(0);
+  for(int i=0; i<60; ++i)
+    for(int j=0; j<60; ++j)
+    {
+      Mesh::Vertex_index v0 = mesh.add_vertex(Point(i, j, rng.get_double(0, 0.1)));
+      Mesh::Vertex_index v1 = mesh.add_vertex(Point(i+1, j, rng.get_double(0, 0.1)));
+      Mesh::Vertex_index v2 = mesh.add_vertex(Point(i, j+1, rng.get_double(0, 0.1)));
+      mesh.add_face(v0, v1, v2);
+    }
+  for(int i=0; i<10; ++i)
+  {
+    Mesh::Vertex_index v0 = mesh.add_vertex(Point(-10, -10, i));
+    Mesh::Vertex_index v1 = mesh.add_vertex(Point(70, -10, i + 0.5));
+    Mesh::Vertex_index v2 = mesh.add_vertex(Point(-10, 70, i + 1));
+    mesh.add_face(v0, v1, v2);
+  }
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  SAH_tree sah_tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  sah_tree.build();
+
+  assert(tree.size() == sah_tree.size());
+  assert(tree.bbox() == sah_tree.bbox());
+
+  CGAL::Random_points_in_cube_3<Point> gen(80., rng);
+  for(int i=0; i<500; ++i)
+  {
+    const Point q = *gen++;
+    const Point r = *gen++;
+
+    assert(tree.squared_distance(q) == sah_tree.squared_distance(q));
+
+    const Segment segment_query(q, r);
+    assert(tree.number_of_intersected_primitives(segment_query) ==
+           sah_tree.number_of_intersected_primitives(segment_query));
+
+    const Ray ray_query(q, r);
+    auto inter = tree.first_intersection(ray_query);
+    auto sah_inter = sah_tree.first_intersection(ray_query);
+    assert(bool(inter) == bool(sah_inter));
+    if(inter)
+    {
+      const Point* p = std::get_if<Point>(&(inter->first));
+      const Point* sah_p = std::get_if<Point>(&(sah_inter->first));
+      if(p != nullptr && sah_p != nullptr)
+        assert(CGAL::squared_distance(q, *p) == CGAL::squared_distance(q, *sah_p));
+    }
+  }
+
+  std::cout << "SAH traits test OK" << std::endl;
+  return EXIT_SUCCESS;
+}
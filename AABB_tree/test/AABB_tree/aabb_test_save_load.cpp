@@ -0,0 +1,132 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_float_bbox_traits.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_segment_primitive_2.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <boost/property_map/function_property_map.hpp>
+#include <cassert>
+#include <fstream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Ray_3 Ray_3;
+typedef K::Segment_3 Segment_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+
+template <class Tree>
+void test_3(const Mesh& mesh)
+{
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+
+  std::stringstream buffer(std::ios::in | std::ios::out | std::ios::binary);
+  const bool saved = tree.save(buffer, get(CGAL::face_index, mesh));
+  assert(saved);
+  CGAL_USE(saved);
+
+  Tree loaded;
+  const bool is_loaded = loaded.load(buffer, faces(mesh).first, faces(mesh).second, mesh);
+  assert(is_loaded);
+  CGAL_USE(is_loaded);
+  assert(loaded.size() == tree.size());
+  assert(loaded.bbox() == tree.bbox());
+
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point_3> gen(1., rng);
+  for(int i=0; i<300; ++i)
+  {
+    const Point_3 q = *gen++;
+    const Point_3 r = *gen++;
+    assert(loaded.squared_distance(q) == tree.squared_distance(q));
+    const Segment_3 segment_query(q, r);
+    assert(loaded.number_of_intersected_primitives(segment_query) ==
+           tree.number_of_intersected_primitives(segment_query));
+    const Ray_3 ray_query(q, r);
+    assert(loaded.first_intersected_primitive(ray_query) ==
+           tree.first_intersected_primitive(ray_query));
+  }
+
+  // wrong input range
+  std::stringstream other_buffer(std::ios::in | std::ios::out | std::ios::binary);
+  const bool saved_again = tree.save(other_buffer, get(CGAL::face_index, mesh));
+  assert(saved_again);
+  CGAL_USE(saved_again);
+  Tree wrong;
+  const bool wrong_loaded = wrong.load(other_buffer, faces(mesh).first, std::next(faces(mesh).first), mesh);
+  assert(!wrong_loaded);
+  CGAL_USE(wrong_loaded);
+  assert(wrong.empty());
+
+  // truncated stream
+  std::stringstream truncated(buffer.str().substr(0, 100), std::ios::in | std::ios::binary);
+  Tree incomplete;
+  const bool incomplete_loaded = incomplete.load(truncated, faces(mesh).first, faces(mesh).second, mesh);
+  assert(!incomplete_loaded);
+  CGAL_USE(incomplete_loaded);
+  assert(incomplete.empty());
+}
+
+void test_2()
+{
+  typedef CGAL::Simple_cartesian<double> K2;
+  typedef K2::Point_2 Point_2;
+  typedef K2::Segment_2 Segment_2;
+  typedef std::vector<Segment_2>::const_iterator Iterator;
+  typedef CGAL::AABB_segment_primitive_2<K2, Iterator> Primitive_2;
+  typedef CGAL::AABB_tree<CGAL::AABB_traits_2<K2, Primitive_2> > Tree_2;
+
+  CGAL::Random rng(1);
+  CGAL::Random_points_in_square_2<Point_2> gen(1., rng);
+  std::vector<Segment_2> segments;
+  for(int i=0; i<1000; ++i)
+  {
+    const Point_2 p = *gen++;
+    segments.emplace_back(p, p + 0.05 * (*gen++ - CGAL::ORIGIN));
+  }
+
+  Tree_2 tree(segments.cbegin(), segments.cend());
+  std::stringstream buffer(std::ios::in | std::ios::out | std::ios::binary);
+  auto id_index = boost::make_function_property_map<Iterator>(
+                    [&segments](const Iterator& it){ return std::size_t(it - segments.cbegin()); });
+  const bool saved = tree.save(buffer, id_index);
+  assert(saved);
+  CGAL_USE(saved);
+
+  Tree_2 loaded;
+  const bool is_loaded = loaded.load(buffer, segments.cbegin(), segments.cend());
+  assert(is_loaded);
+  CGAL_USE(is_loaded);
+  for(int i=0; i<100; ++i)
+  {
+    const Segment_2 query(*gen++, *gen++);
+    assert(loaded.number_of_intersected_primitives(query) ==
+           tree.number_of_intersected_primitives(query));
+  }
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  input >> mesh;
+  assert(!is_empty(mesh));
+
+  test_3<CGAL::AABB_tree<Traits> >(mesh);
+  test_3<CGAL::AABB_tree<CGAL::AABB_float_bbox_traits<Traits> > >(mesh);
+  test_2();
+
+  std::cout << "Save/load test OK" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+// Compares the sequential and the parallel versions of convex_hull_3() on one large
+// point set, and a loop of calls to convex_hull_3() with convex_hulls_3() on many small ones.
+//
+// Usage: bench_parallel_convex_hull_3 [number of points] [number of clusters] [cluster size]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   K;
+typedef K::Point_3                                            Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Mesh;
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 10000000;
+  const std::size_t nb_clusters = (argc > 2) ? std::atoi(argv[2]) : 100000;
+  const int cluster_size = (argc > 3) ? std::atoi(argv[3]) : 50;
+
+  CGAL::Random rnd(0);
+  std::vector<Point_3> points;
+  points.reserve(n);
+  CGAL::Random_points_in_sphere_3<Point_3> g(1., rnd);
+  std::copy_n(g, n, std::back_inserter(points));
+
+  CGAL::Real_timer timer;
+  Mesh hull;
+  timer.start();
+  CGAL::convex_hull_3(points.begin(), points.end(), hull);
+  timer.stop();
+  std::cout << "convex_hull_3 of " << n << " points: " << timer.time() << " sec ("
+            << hull.number_of_vertices() << " vertices)" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  timer.reset();
+  timer.start();
+  CGAL::convex_hull_3<CGAL::Parallel_tag>(points.begin(), points.end(), hull);
+  timer.stop();
+  std::cout << "convex_hull_3<Parallel_tag>: " << timer.time() << " sec ("
+            << hull.number_of_vertices() << " vertices)" << std::endl;
+#endif
+
+  std::vector<std::vector<Point_3> > clusters(nb_clusters);
+  for(std::vector<Point_3>& cluster : clusters)
+    std::copy_n(g, cluster_size, std::back_inserter(cluster));
+
+  std::vector<Mesh> hulls(nb_clusters);
+  timer.reset();
+  timer.start();
+  for(std::size_t i=0; i<nb_clusters; ++i)
+    CGAL::convex_hull_3(clusters[i].begin(), clusters[i].end(), hulls[i]);
+  timer.stop();
+  std::cout << "convex_hull_3 of " << nb_clusters << " clusters of " << cluster_size
+            << " points: " << timer.time() << " sec" << std::endl;
+
+  timer.reset();
+  timer.start();
+  CGAL::convex_hulls_3(clusters, hulls);
+  timer.stop();
+  std::cout << "convex_hulls_3: " << timer.time() << " sec" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  timer.reset();
+  timer.start();
+  CGAL::convex_hulls_3<CGAL::Parallel_tag>(clusters, hulls);
+  timer.stop();
+  std::cout << "convex_hulls_3<Parallel_tag>: " << timer.time() << " sec" << std::endl;
+#endif
+
+  return EXIT_SUCCESS;
+}
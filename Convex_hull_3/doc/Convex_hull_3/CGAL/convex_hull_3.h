@@ -35,6 +35,56 @@ template <class InputIterator, class PolygonMesh, class Traits>
 void convex_hull_3(InputIterator first, InputIterator last, PolygonMesh& pm, const Traits& ch_traits = Default_traits);
 
 
+/*!
+\ingroup PkgConvexHull3Functions
+
+\brief computes the convex hull of the set of points in the range
+[`first`, `last`), as `convex_hull_3(first, last, pm, ch_traits)` does, possibly in parallel.
+
+With `Parallel_tag`, the range is split into chunks whose extreme points are
+computed concurrently, and the convex hull of the union of these extreme points
+is then computed sequentially. The polygon mesh `pm` is the same as the one
+computed by the sequential version. Small ranges are handled sequentially.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` and `Parallel_tag`.
+\tparam InputIterator must be an input iterator with a value type  equivalent to `Traits::Point_3`.
+\tparam PolygonMesh must be a model of `MutableFaceGraph`.
+\tparam Traits must be a model of the concept `ConvexHullTraits_3`.
+
+\attention The user must include the header file of the `PolygonMesh` type.
+*/
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh, class Traits>
+void convex_hull_3(InputIterator first, InputIterator last, PolygonMesh& pm, const Traits& ch_traits = Default_traits);
+
+/*!
+\ingroup PkgConvexHull3Functions
+
+\brief computes the convex hulls of many point sets: the convex hull of the `i`-th range
+of `point_ranges` is stored in the `i`-th polygon mesh of `polyhedra`,
+as `convex_hull_3()` does.
+
+The memory used by the algorithm is reused from one convex hull to the next,
+which makes this function faster than a loop of calls to `convex_hull_3()` on small point sets.
+With `Parallel_tag`, the convex hulls are computed concurrently.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+\tparam PointRanges must be a model of `ConstRange` whose value type is
+a model of `ConstRange` with a value type equivalent to `Traits::Point_3`.
+\tparam PolygonMeshRange must be a model of `Range` whose value type is a model of `MutableFaceGraph`.
+\tparam Traits must be a model of the concept `ConvexHullTraits_3`.
+
+\pre `point_ranges` and `polyhedra` have the same size.
+
+\attention The user must include the header file of the `PolygonMesh` type.
+*/
+template <class ConcurrencyTag, class PointRanges, class PolygonMeshRange, class Traits>
+void convex_hulls_3(const PointRanges& point_ranges,
+                    PolygonMeshRange& polyhedra,
+                    const Traits& ch_traits = Default_traits);
+
+
 /*!
 \ingroup PkgConvexHull3Functions
  * \brief computes the convex hull of the points associated to the vertices of `g`.
@@ -42,6 +42,7 @@
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/type_traits/is_iterator.h>
+#include <CGAL/tags.h>
 
 #include <boost/mpl/has_xxx.hpp>
 #include <boost/graph/graph_traits.hpp>
@@ -54,12 +55,20 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <vector>
 #include <type_traits>
 #include <utility>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_arena.h>
+#endif
+
 // first some internal stuff to avoid using a true Face_graph model for extreme_points_3
 namespace CGAL {
 
@@ -625,10 +634,13 @@ partition_outside_sets(const std::list<Face_handle>& new_facets,
 
 
 
+// The points that are processed (inside the hull, or vertices of the hull) are
+// moved to `discarded`, so that their nodes can be reused by the caller.
 template <class TDS_2, class Traits>
 void
 ch_quickhull_3_scan(TDS_2& tds,
                     std::list<typename TDS_2::Face_handle>& pending_facets,
+                    std::list<typename Traits::Point_3>& discarded,
                     const Traits& traits)
 {
   typedef typename TDS_2::Edge                            Edge;
@@ -646,13 +658,13 @@ ch_quickhull_3_scan(TDS_2& tds,
 
   while (!pending_facets.empty())
   {
-     vis_outside_set.clear();
+     discarded.splice(discarded.end(), vis_outside_set);
 
      Face_handle f_handle = pending_facets.front();
 
      Outside_set_iterator farthest_pt_it = farthest_outside_point(f_handle, f_handle->points, traits);
      Point_3 farthest_pt = *farthest_pt_it;
-     f_handle->points.erase(farthest_pt_it);
+     discarded.splice(discarded.end(), f_handle->points, farthest_pt_it);
      find_visible_set(tds, farthest_pt, f_handle, visible_set, border, traits);
 
      // for each visible facet
@@ -710,6 +722,7 @@ ch_quickhull_3_scan(TDS_2& tds,
                             pending_facets, traits);
 
   }
+  discarded.splice(discarded.end(), vis_outside_set);
 }
 
 template <class TDS_2, class Traits>
@@ -754,7 +767,7 @@ void non_coplanar_quickhull_3(std::list<typename Traits::Point_3>& points,
   }
 
 
-  ch_quickhull_3_scan(tds, pending_facets, traits);
+  ch_quickhull_3_scan(tds, pending_facets, points, traits);
 
   //std::cout << "|V(tds)| = " << tds.number_of_vertices() << std::endl;
 //  CGAL_expensive_postcondition(all_points_inside(points.begin(),
@@ -835,10 +848,12 @@ ch_quickhull_face_graph(std::list<typename Traits::Point_3>& points,
     f2->set_neighbors(f0, f1, f3);
     f3->set_neighbors(f0, f2, f1);
 
-    points.erase(point1_it);
-    points.erase(point2_it);
-    points.erase(point3_it);
-    points.erase(max_it);
+    // the points of the tetrahedron are put back at the end, so that no node of `points` is freed
+    std::list<Point_3> tetrahedron_points;
+    tetrahedron_points.splice(tetrahedron_points.end(), points, point1_it);
+    tetrahedron_points.splice(tetrahedron_points.end(), points, point2_it);
+    tetrahedron_points.splice(tetrahedron_points.end(), points, point3_it);
+    tetrahedron_points.splice(tetrahedron_points.end(), points, max_it);
     if (!points.empty()){
       non_coplanar_quickhull_3(points, tds, traits);
       copy_face_graph(tds,P);
@@ -849,6 +864,7 @@ ch_quickhull_face_graph(std::list<typename Traits::Point_3>& points,
             v3->point()) );
       make_tetrahedron(v0->point(),v1->point(),v3->point(),v2->point(),P);
     }
+    points.splice(points.end(), tetrahedron_points);
   }
 
 }
@@ -990,8 +1006,13 @@ void convex_hull_3(InputIterator first, InputIterator beyond,
    convex_hull_3(first, beyond, ch_object, Traits());
 }
 
-template <class InputIterator, class PolygonMesh, class Traits>
-void convex_hull_3(InputIterator first, InputIterator beyond,
+namespace Convex_hull_3 {
+namespace internal {
+
+// Computes the convex hull of `points`, which is not empty. When the function returns,
+// `points` contains the same number of elements as before, so its nodes can be reused.
+template <class PolygonMesh, class Traits>
+void convex_hull_3(std::list<typename Traits::Point_3>& points,
                    PolygonMesh& polyhedron,
                    const Traits& traits)
 {
@@ -1000,10 +1021,6 @@ void convex_hull_3(InputIterator first, InputIterator beyond,
   typedef typename Point_3_list::iterator         P3_iterator;
   typedef std::pair<P3_iterator,P3_iterator>      P3_iterator_pair;
 
-  if(first == beyond)
-    return;
-
-  Point_3_list points(first, beyond);
   clear(polyhedron);
 
   typename Traits::Collinear_3 collinear = traits.collinear_3_object();
@@ -1048,6 +1065,23 @@ void convex_hull_3(InputIterator first, InputIterator beyond,
     polyhedron, traits);
 }
 
+} // namespace internal
+} // namespace Convex_hull_3
+
+template <class InputIterator, class PolygonMesh, class Traits>
+void convex_hull_3(InputIterator first, InputIterator beyond,
+                   PolygonMesh& polyhedron,
+                   const Traits& traits)
+{
+  typedef typename Traits::Point_3                Point_3;
+
+  if(first == beyond)
+    return;
+
+  std::list<Point_3> points(first, beyond);
+  Convex_hull_3::internal::convex_hull_3(points, polyhedron, traits);
+}
+
 template <class InputIterator, class PolygonMesh>
 void convex_hull_3(InputIterator first, InputIterator beyond,
                    PolygonMesh& polyhedron,
@@ -1131,6 +1165,200 @@ extreme_points_3(const InputRange& range, OutputIterator out)
   return extreme_points_3(range, out, Traits());
 }
 
+namespace Convex_hull_3 {
+namespace internal {
+
+template <class Tag>
+struct Is_concurrency_tag
+  : std::integral_constant<bool, std::is_same<Tag, Sequential_tag>::value ||
+                                 std::is_same<Tag, Parallel_tag>::value>
+{};
+
+// Below this number of points per chunk, the input of the parallel version is not split.
+constexpr std::size_t parallel_convex_hull_3_min_chunk_size = 50000;
+
+// Number of threads that can compute the extreme points of the chunks concurrently.
+template <class ConcurrencyTag>
+std::size_t parallel_convex_hull_3_concurrency()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_same<ConcurrencyTag, Parallel_tag>::value)
+    return static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+#endif
+  return 1;
+}
+
+// The input is split in chunks, whose extreme points are computed concurrently.
+// The convex hull of the input is the convex hull of these extreme points,
+// which is computed sequentially: the points inside the hulls of the chunks
+// are thus discarded in parallel. Since computing the hull of the extreme points
+// is extra work, there is one chunk per thread, and the input is not split
+// when a single thread is available.
+template <class ConcurrencyTag, class RandomAccessIterator, class PolygonMesh, class Traits>
+void parallel_convex_hull_3(RandomAccessIterator first, RandomAccessIterator beyond,
+                            PolygonMesh& polyhedron,
+                            const Traits& traits)
+{
+  typedef typename Traits::Point_3                Point_3;
+
+  const std::size_t n = static_cast<std::size_t>(std::distance(first, beyond));
+  const std::size_t nb_chunks = (std::min)(n / parallel_convex_hull_3_min_chunk_size,
+                                           parallel_convex_hull_3_concurrency<ConcurrencyTag>());
+  if(nb_chunks < 2)
+  {
+    CGAL::convex_hull_3(first, beyond, polyhedron, traits);
+    return;
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::vector<std::vector<Point_3> > extreme_points(nb_chunks);
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_chunks, 1),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+  {
+    for(std::size_t i = r.begin(); i != r.end(); ++i)
+    {
+      Output_iterator_wrapper<std::back_insert_iterator<std::vector<Point_3> > >
+        wrapper(std::back_inserter(extreme_points[i]));
+      CGAL::convex_hull_3(first + (n * i) / nb_chunks, first + (n * (i + 1)) / nb_chunks,
+                          wrapper, traits);
+    }
+  });
+
+  std::list<Point_3> points;
+  for(const std::vector<Point_3>& chunk_points : extreme_points)
+    points.insert(points.end(), chunk_points.begin(), chunk_points.end());
+  Convex_hull_3::internal::convex_hull_3(points, polyhedron, traits);
+#endif
+}
+
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh, class Traits>
+void parallel_convex_hull_3(InputIterator first, InputIterator beyond,
+                            PolygonMesh& polyhedron,
+                            const Traits& traits,
+                            std::input_iterator_tag)
+{
+  typedef typename Traits::Point_3                Point_3;
+
+  std::vector<Point_3> points(first, beyond);
+  parallel_convex_hull_3<ConcurrencyTag>(points.begin(), points.end(), polyhedron, traits);
+}
+
+template <class ConcurrencyTag, class RandomAccessIterator, class PolygonMesh, class Traits>
+void parallel_convex_hull_3(RandomAccessIterator first, RandomAccessIterator beyond,
+                            PolygonMesh& polyhedron,
+                            const Traits& traits,
+                            std::random_access_iterator_tag)
+{
+  parallel_convex_hull_3<ConcurrencyTag>(first, beyond, polyhedron, traits);
+}
+
+} // namespace internal
+} // namespace Convex_hull_3
+
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh, class Traits>
+void convex_hull_3(InputIterator first, InputIterator beyond,
+                   PolygonMesh& polyhedron,
+                   const Traits& traits,
+                   std::enable_if_t<Convex_hull_3::internal::Is_concurrency_tag<ConcurrencyTag>::value>* = 0)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if(first == beyond)
+    return;
+
+  // avoid the copy of the input made for input iterators when there is nothing to parallelize
+  if(Convex_hull_3::internal::parallel_convex_hull_3_concurrency<ConcurrencyTag>() < 2)
+  {
+    CGAL::convex_hull_3(first, beyond, polyhedron, traits);
+    return;
+  }
+
+  Convex_hull_3::internal::parallel_convex_hull_3<ConcurrencyTag>(
+    first, beyond, polyhedron, traits,
+    typename std::iterator_traits<InputIterator>::iterator_category());
+}
+
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh>
+void convex_hull_3(InputIterator first, InputIterator beyond,
+                   PolygonMesh& polyhedron,
+                   std::enable_if_t<Convex_hull_3::internal::Is_concurrency_tag<ConcurrencyTag>::value &&
+                                    CGAL::is_iterator<InputIterator>::value>* = 0)
+{
+  typedef typename std::iterator_traits<InputIterator>::value_type Point_3;
+  typedef typename Convex_hull_3::internal::Default_traits_for_Chull_3<Point_3, PolygonMesh>::type Traits;
+  convex_hull_3<ConcurrencyTag>(first, beyond, polyhedron, Traits());
+}
+
+template <class ConcurrencyTag = Sequential_tag, class PointRanges, class PolygonMeshRange, class Traits>
+void convex_hulls_3(const PointRanges& point_ranges,
+                    PolygonMeshRange& polyhedra,
+                    const Traits& traits)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  typedef typename Traits::Point_3                                 Point_3;
+  typedef typename PointRanges::const_iterator                     Range_iterator;
+  typedef typename PolygonMeshRange::iterator                      Mesh_iterator;
+
+  const std::size_t n = static_cast<std::size_t>(std::distance(point_ranges.begin(), point_ranges.end()));
+  CGAL_precondition(static_cast<std::size_t>(std::distance(polyhedra.begin(), polyhedra.end())) == n);
+
+  std::vector<std::pair<Range_iterator, Mesh_iterator> > tasks;
+  tasks.reserve(n);
+  Mesh_iterator mesh_it = polyhedra.begin();
+  for(Range_iterator it = point_ranges.begin(); it != point_ranges.end(); ++it, ++mesh_it)
+    tasks.emplace_back(it, mesh_it);
+
+  // The nodes of `points` are reused from one hull to the next.
+  auto compute_hull = [&traits](const std::pair<Range_iterator, Mesh_iterator>& task,
+                                std::list<Point_3>& points)
+  {
+    if(task.first->begin() == task.first->end())
+    {
+      clear(*task.second);
+      return;
+    }
+    points.assign(task.first->begin(), task.first->end());
+    Convex_hull_3::internal::convex_hull_3(points, *task.second, traits);
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_same<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::enumerable_thread_specific<std::list<Point_3> > scratch;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      std::list<Point_3>& points = scratch.local();
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+        compute_hull(tasks[i], points);
+    });
+    return;
+  }
+#endif
+
+  std::list<Point_3> points;
+  for(const std::pair<Range_iterator, Mesh_iterator>& task : tasks)
+    compute_hull(task, points);
+}
+
+template <class ConcurrencyTag = Sequential_tag, class PointRanges, class PolygonMeshRange>
+void convex_hulls_3(const PointRanges& point_ranges,
+                    PolygonMeshRange& polyhedra)
+{
+  typedef typename PointRanges::value_type                         Point_range;
+  typedef typename Point_range::value_type                         Point_3;
+  typedef typename PolygonMeshRange::value_type                    PolygonMesh;
+  typedef typename Convex_hull_3::internal::Default_traits_for_Chull_3<Point_3, PolygonMesh>::type Traits;
+  convex_hulls_3<ConcurrencyTag>(point_ranges, polyhedra, Traits());
+}
+
 } // namespace CGAL
 
 #endif // CGAL_CONVEX_HULL_3_H
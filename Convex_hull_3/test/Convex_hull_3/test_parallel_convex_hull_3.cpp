@@ -0,0 +1,146 @@
+// The parallel version of convex_hull_3() and convex_hulls_3() must give
+// the same convex hulls as the sequential convex_hull_3().
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/task_arena.h>
+#endif
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   K;
+typedef K::Point_3                                            Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Mesh;
+
+std::vector<Point_3> sorted_points(const Mesh& m)
+{
+  std::vector<Point_3> points(m.points().begin(), m.points().end());
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+template <class Tag, class InputIterator>
+void test_hull(InputIterator first, InputIterator beyond, const char* name)
+{
+  Mesh sequential, hull;
+  CGAL::convex_hull_3(first, beyond, sequential);
+  CGAL::convex_hull_3<Tag>(first, beyond, hull);
+
+  assert(hull.number_of_faces() == sequential.number_of_faces());
+  assert(sorted_points(hull) == sorted_points(sequential));
+  // the check of convexity is quadratic
+  if(hull.number_of_faces() > 0 && CGAL::is_closed(hull) && hull.number_of_vertices() < 1000)
+    assert(CGAL::is_strongly_convex_3(hull));
+  std::cout << name << ": " << hull.number_of_vertices() << " vertices" << std::endl;
+}
+
+template <class Tag>
+void test_single_hulls()
+{
+  CGAL::Random rnd(0);
+  const std::size_t n = 400000;
+
+  std::vector<Point_3> in_cube;
+  in_cube.reserve(n);
+  CGAL::Random_points_in_cube_3<Point_3> g(1., rnd);
+  std::copy_n(g, n, std::back_inserter(in_cube));
+  test_hull<Tag>(in_cube.begin(), in_cube.end(), "in cube");
+
+  // points on a grid: many coplanar faces
+  std::vector<Point_3> grid;
+  for(std::size_t i=0; i<n; ++i)
+    grid.emplace_back(rnd.get_int(0, 10), rnd.get_int(0, 10), rnd.get_int(0, 10));
+  test_hull<Tag>(grid.begin(), grid.end(), "grid");
+
+  // all the points are extreme
+  std::vector<Point_3> on_sphere;
+  CGAL::Random_points_on_sphere_3<Point_3> gs(1., rnd);
+  std::copy_n(gs, 120000, std::back_inserter(on_sphere));
+  test_hull<Tag>(on_sphere.begin(), on_sphere.end(), "on sphere");
+
+  // degenerate inputs
+  std::vector<Point_3> coplanar, collinear, equal(n, Point_3(1, 2, 3));
+  for(std::size_t i=0; i<n; ++i)
+  {
+    coplanar.emplace_back(rnd.get_double(), rnd.get_double(), 1);
+    collinear.emplace_back(i % 1000, 2 * (i % 1000), 0);
+  }
+  test_hull<Tag>(coplanar.begin(), coplanar.end(), "coplanar");
+  test_hull<Tag>(collinear.begin(), collinear.end(), "collinear");
+  test_hull<Tag>(equal.begin(), equal.end(), "equal");
+
+  // an input iterator that is not random access
+  std::list<Point_3> in_cube_list(in_cube.begin(), in_cube.end());
+  test_hull<Tag>(in_cube_list.begin(), in_cube_list.end(), "in cube (list)");
+}
+
+template <class Tag>
+void test_batched_hulls()
+{
+  CGAL::Random rnd(1);
+  std::vector<std::vector<Point_3> > clusters(2000);
+  for(std::size_t i=0; i<clusters.size(); ++i)
+  {
+    const int size = rnd.get_int(0, 60);
+    const double cx = rnd.get_double(-100, 100);
+    for(int j=0; j<size; ++j)
+    {
+      switch(i % 4)
+      {
+        case 0: clusters[i].emplace_back(cx + rnd.get_double(), rnd.get_double(), rnd.get_double()); break;
+        case 1: clusters[i].emplace_back(cx + rnd.get_int(0, 3), rnd.get_int(0, 3), rnd.get_int(0, 3)); break;
+        case 2: clusters[i].emplace_back(cx + rnd.get_double(), rnd.get_double(), 0); break;
+        default: clusters[i].emplace_back(cx + j % 3, 0, 0); break;
+      }
+    }
+  }
+
+  std::vector<Mesh> hulls(clusters.size());
+  CGAL::convex_hulls_3<Tag>(clusters, hulls);
+  std::size_t nb_faces = 0;
+  for(std::size_t i=0; i<clusters.size(); ++i)
+  {
+    Mesh sequential;
+    CGAL::convex_hull_3(clusters[i].begin(), clusters[i].end(), sequential);
+    assert(hulls[i].number_of_faces() == sequential.number_of_faces());
+    assert(sorted_points(hulls[i]) == sorted_points(sequential));
+    nb_faces += hulls[i].number_of_faces();
+  }
+
+  // the meshes are cleared
+  CGAL::convex_hulls_3<Tag>(clusters, hulls);
+  std::size_t nb_faces_again = 0;
+  for(const Mesh& m : hulls)
+    nb_faces_again += m.number_of_faces();
+  assert(nb_faces_again == nb_faces);
+  std::cout << clusters.size() << " hulls, " << nb_faces << " faces" << std::endl;
+}
+
+int main()
+{
+  test_single_hulls<CGAL::Sequential_tag>();
+  test_batched_hulls<CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  // the input is only split when several threads are available
+  tbb::task_arena arena(4);
+  arena.execute([]
+  {
+    test_single_hulls<CGAL::Parallel_tag>();
+    test_batched_hulls<CGAL::Parallel_tag>();
+  });
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
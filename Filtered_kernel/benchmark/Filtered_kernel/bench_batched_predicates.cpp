@@ -0,0 +1,78 @@
+// Compares the evaluation of the orientation and in-sphere predicates of
+// `Exact_predicates_inexact_constructions_kernel` one query at a time
+// and with `CGAL::batched_orientation()` and `CGAL::batched_side_of_oriented_sphere()`.
+//
+// Usage: bench_batched_predicates [number of queries]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/batched_predicates_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   K;
+typedef K::Point_3                                             Point_3;
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+  std::vector<Point_3> points;
+  points.reserve(n + 4);
+  CGAL::Random_points_in_sphere_3<Point_3> g(100.0);
+  std::copy_n(g, n + 4, std::back_inserter(points));
+
+  std::vector<std::array<Point_3, 4> > quadruples(n);
+  std::vector<std::array<Point_3, 5> > quintuples(n);
+  for(std::size_t i=0; i<n; ++i)
+  {
+    quadruples[i] = { { points[i], points[i + 1], points[i + 2], points[i + 3] } };
+    quintuples[i] = { { points[i], points[i + 1], points[i + 2], points[i + 3], points[i + 4] } };
+  }
+
+  CGAL::Real_timer timer;
+  std::vector<CGAL::Orientation> orientations;
+  orientations.reserve(n);
+  timer.start();
+  for(const auto& q : quadruples)
+    orientations.push_back(CGAL::orientation(q[0], q[1], q[2], q[3]));
+  timer.stop();
+  std::cout << "orientation: " << timer.time() << " sec" << std::endl;
+
+  std::vector<CGAL::Orientation> batched_orientations;
+  batched_orientations.reserve(n);
+  timer.reset();
+  timer.start();
+  CGAL::batched_orientation(quadruples.begin(), quadruples.end(), std::back_inserter(batched_orientations));
+  timer.stop();
+  std::cout << "batched_orientation: " << timer.time() << " sec" << std::endl;
+
+  std::vector<CGAL::Oriented_side> sides;
+  sides.reserve(n);
+  timer.reset();
+  timer.start();
+  for(const auto& q : quintuples)
+    sides.push_back(CGAL::side_of_oriented_sphere(q[0], q[1], q[2], q[3], q[4]));
+  timer.stop();
+  std::cout << "side_of_oriented_sphere: " << timer.time() << " sec" << std::endl;
+
+  std::vector<CGAL::Oriented_side> batched_sides;
+  batched_sides.reserve(n);
+  timer.reset();
+  timer.start();
+  CGAL::batched_side_of_oriented_sphere(quintuples.begin(), quintuples.end(), std::back_inserter(batched_sides));
+  timer.stop();
+  std::cout << "batched_side_of_oriented_sphere: " << timer.time() << " sec" << std::endl;
+
+  if(orientations != batched_orientations || sides != batched_sides)
+  {
+    std::cerr << "Error: different results" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
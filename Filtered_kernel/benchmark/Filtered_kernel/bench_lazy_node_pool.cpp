@@ -0,0 +1,104 @@
+// Compares the allocation of the nodes of the lazy kernel with the global operator new
+// and with `Lazy_node_pool` (built with `CGAL_LAZY_KERNEL_USE_NODE_POOL`)
+// on Boolean operations with `Exact_predicates_exact_constructions_kernel`.
+//
+// Usage: bench_lazy_node_pool [mesh] [number of repetitions] [run Nef_polyhedron_3 (0/1)]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/Lazy_node_pool.h>
+#include <CGAL/Memory_sizer.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   K;
+typedef CGAL::Surface_mesh<K::Point_3>                       Mesh;
+typedef CGAL::Nef_polyhedron_3<K>                            Nef_polyhedron;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+void report(const std::string& name, const CGAL::Real_timer& timer)
+{
+  CGAL::Memory_sizer memory;
+  std::cout << "  " << name << ": " << timer.time() << " s, resident size "
+            << memory.resident_size() / (1 << 20) << " MiB";
+#ifdef CGAL_LAZY_KERNEL_USE_NODE_POOL
+  std::cout << ", pool " << CGAL::Lazy_node_pool::memory_size() / (1 << 20) << " MiB";
+#endif
+  std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const int nb_repetitions = (argc > 2) ? std::atoi(argv[2]) : 3;
+  const bool run_nef = (argc > 3) ? (std::atoi(argv[3]) != 0) : true;
+
+  Mesh input;
+  if(!PMP::IO::read_polygon_mesh(filename, input))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+#ifdef CGAL_LAZY_KERNEL_USE_NODE_POOL
+  std::cout << "Lazy_node_pool" << std::endl;
+#else
+  std::cout << "operator new" << std::endl;
+#endif
+
+  const K::Aff_transformation_3 translation(CGAL::TRANSLATION, K::Vector_3(0.013, 0.027, 0.019));
+
+  CGAL::Real_timer timer;
+  for(int r=0; r<nb_repetitions; ++r)
+  {
+    // corefinement: a long chain of constructions whose intermediate nodes are released with the meshes
+    timer.reset();
+    timer.start();
+    {
+#ifdef CGAL_LAZY_KERNEL_USE_NODE_POOL
+      CGAL::Lazy_node_pool_scope scope;
+#endif
+      Mesh a = input, b = input, out;
+      PMP::transform(translation, b);
+      PMP::corefine_and_compute_union(a, b, out);
+      Mesh c = out;
+      PMP::transform(translation, c);
+      PMP::corefine_and_compute_difference(out, c, out);
+      std::cout << "  " << num_faces(out) << " faces, ";
+    }
+    timer.stop();
+    report("corefinement", timer);
+  }
+
+  if(run_nef)
+  {
+    for(int r=0; r<nb_repetitions; ++r)
+    {
+      timer.reset();
+      timer.start();
+      {
+#ifdef CGAL_LAZY_KERNEL_USE_NODE_POOL
+        CGAL::Lazy_node_pool_scope scope;
+#endif
+        Mesh b = input;
+        PMP::transform(translation, b);
+        Nef_polyhedron na(input), nb(b);
+        const Nef_polyhedron u = na + nb, d = na - nb;
+        std::cout << "  " << u.number_of_vertices() << " and " << d.number_of_vertices() << " vertices, ";
+      }
+      timer.stop();
+      report("Nef_polyhedron_3", timer);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+// Benchmarks the concurrent materialization of the exact values of shared lazy nodes
+// with `Exact_predicates_exact_constructions_kernel`.
+//
+// Usage: bench_lazy_parallel [number of pairs of triangles] [max number of threads]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/intersections.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   K;
+typedef K::FT                                                FT;
+typedef K::Point_3                                           Point_3;
+typedef K::Segment_3                                         Segment_3;
+typedef K::Triangle_3                                        Triangle_3;
+
+template <typename F>
+void for_each_index(const std::size_t n, const F& f, const bool parallel)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  if(parallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          f(i);
+                      });
+    return;
+  }
+#else
+  CGAL_USE(parallel);
+#endif
+  for(std::size_t i=0; i<n; ++i)
+    f(i);
+}
+
+// segments crossing triangles, sharing their vertices: the intersection points are constructed lazily,
+// and the predicates on them need the exact values of the shared nodes
+void intersections(const std::vector<Point_3>& points, const std::size_t n, const bool parallel)
+{
+  std::vector<Triangle_3> triangles;
+  std::vector<Segment_3> segments;
+  for(std::size_t i=0; i<n; ++i)
+  {
+    const Point_3& a = points[i % points.size()];
+    const Point_3& b = points[(i + 1) % points.size()];
+    const Point_3& c = points[(i + 2) % points.size()];
+    triangles.emplace_back(a, b, c);
+    const Point_3 g = CGAL::centroid(a, b, c);
+    segments.emplace_back(g + K::Vector_3(0, 0, 1), g - K::Vector_3(0, 0, 1));
+  }
+
+  std::vector<Point_3> results(n);
+  std::vector<char> on_plane(n, 0);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  for_each_index(n, [&](const std::size_t i)
+                    {
+                      const auto res = CGAL::intersection(triangles[i], segments[i]);
+                      if(!res)
+                        return;
+                      if(const Point_3* p = std::get_if<Point_3>(&*res))
+                      {
+                        results[i] = *p;
+                        // degenerate predicate: requires the exact value of the intersection point
+                        on_plane[i] = (CGAL::orientation(triangles[i][0], triangles[i][1], triangles[i][2], *p)
+                                       == CGAL::COPLANAR);
+                      }
+                    }, parallel);
+  const double t_intersections = timer.time();
+
+  timer.reset();
+  // the centroids are shared by several threads
+  std::vector<Point_3> centroids;
+  for(std::size_t i=0; i+2<n; ++i)
+    centroids.push_back(CGAL::midpoint(results[i], results[i + 1]));
+  for_each_index(centroids.size(), [&](const std::size_t i)
+                                   {
+                                     const std::size_t j = (i * 7919) % centroids.size();
+                                     CGAL::exact(centroids[j]);
+                                     CGAL::exact(centroids[i]);
+                                   }, parallel);
+  const double t_shared = timer.time();
+
+  std::size_t nb_on_plane = 0;
+  for(char c : on_plane)
+    nb_on_plane += c;
+  std::cout << "  intersections: " << t_intersections << " s (" << nb_on_plane << " exact coplanarity tests), "
+            << "shared materialization: " << t_shared << " s" << std::endl;
+}
+
+// calls exact() on nodes whose exact value is already known
+void materialized(const std::vector<Point_3>& points, const bool parallel)
+{
+  std::vector<FT> numbers;
+  for(const Point_3& p : points)
+    numbers.push_back(p.x() * p.y() + p.z());
+  for(const FT& x : numbers)
+    x.exact();
+
+  const std::size_t nb_rounds = 20000;
+  CGAL::Real_timer timer;
+  timer.start();
+  for_each_index(nb_rounds, [&](const std::size_t)
+                            {
+                              std::size_t sum = 0;
+                              for(const FT& x : numbers)
+                                sum += reinterpret_cast<std::size_t>(&x.exact());
+                              CGAL_USE(sum);
+                            }, parallel);
+  std::cout << "  exact() on materialized nodes: "
+            << 1e9 * timer.time() / double(nb_rounds * numbers.size()) << " ns per call" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 100000;
+  const int max_threads = (argc > 2) ? std::atoi(argv[2]) : 8;
+
+  CGAL::Random rnd(0);
+  std::vector<Point_3> points;
+  for(std::size_t i=0; i<1000; ++i)
+    points.emplace_back(rnd.get_double(), rnd.get_double(), rnd.get_double());
+
+  std::cout << "sequential" << std::endl;
+  intersections(points, n, false);
+  materialized(points, false);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  for(int nb_threads=1; nb_threads<=max_threads; nb_threads*=2)
+  {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+    std::cout << "parallel, " << nb_threads << " thread(s)" << std::endl;
+    intersections(points, n, true);
+    materialized(points, true);
+  }
+#else
+  CGAL_USE(max_threads);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+// Compares `Exact_predicates_inexact_constructions_kernel`, whose filtered predicates
+// change the rounding mode around their interval arithmetic stage, and
+// `Round_to_nearest_epick`, whose interval arithmetic works in round-to-nearest,
+// on a 3D Delaunay triangulation of random and degenerate points, and on a corefinement.
+//
+// Usage: bench_round_to_nearest_epick [number of points] [mesh]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Round_to_nearest_epick.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <typename K>
+void bench(const char* name, std::size_t n, const std::string& filename)
+{
+  typedef typename K::Point_3                                   Point_3;
+  typedef CGAL::Surface_mesh<Point_3>                           Mesh;
+
+  CGAL::Random rnd(0);
+  std::vector<Point_3> random_points, grid_points;
+  random_points.reserve(n);
+  CGAL::Random_points_in_sphere_3<Point_3> g(1.0, rnd);
+  std::copy_n(g, n, std::back_inserter(random_points));
+  // many cospherical configurations: most filters fail
+  for(std::size_t i=0; i<n/4; ++i)
+    grid_points.emplace_back(rnd.get_int(0, 40), rnd.get_int(0, 40), rnd.get_int(0, 40));
+
+  CGAL::Real_timer timer;
+  timer.start();
+  CGAL::Delaunay_triangulation_3<K> dt(random_points.begin(), random_points.end());
+  timer.stop();
+  std::cout << name << ": Delaunay_triangulation_3 of " << n << " random points: "
+            << timer.time() << " sec (" << dt.number_of_cells() << " cells)" << std::endl;
+
+  timer.reset();
+  timer.start();
+  CGAL::Delaunay_triangulation_3<K> dt_grid(grid_points.begin(), grid_points.end());
+  timer.stop();
+  std::cout << name << ": Delaunay_triangulation_3 of " << grid_points.size() << " grid points: "
+            << timer.time() << " sec (" << dt_grid.number_of_cells() << " cells)" << std::endl;
+
+  Mesh tm1, tm2;
+  if(!PMP::IO::read_polygon_mesh(filename, tm1) || !CGAL::is_triangle_mesh(tm1))
+  {
+    std::cerr << "Invalid input: " << filename << std::endl;
+    return;
+  }
+  tm2 = tm1;
+  // rotation around the z axis and translation
+  PMP::transform(CGAL::Aff_transformation_3<K>(0.8, -0.6, 0, 0.01,
+                                               0.6,  0.8, 0, 0.02,
+                                               0,    0,   1, 0.015), tm2);
+
+  timer.reset();
+  timer.start();
+  PMP::corefine(tm1, tm2);
+  timer.stop();
+  std::cout << name << ": corefinement: " << timer.time() << " sec ("
+            << num_faces(tm1) + num_faces(tm2) << " faces)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const std::string filename = (argc > 2) ? argv[2] : CGAL::data_file_path("meshes/elephant.off");
+
+  bench<CGAL::Epick>("Epick", n, filename);
+  bench<CGAL::Round_to_nearest_epick>("Round_to_nearest_epick", n, filename);
+
+  return EXIT_SUCCESS;
+}
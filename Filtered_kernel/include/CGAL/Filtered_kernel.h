@@ -37,6 +37,15 @@
 
 namespace CGAL {
 
+// Selects the interval arithmetic used by the first stage of the filtered
+// predicates of `Kernel`. It can be specialized for a kernel class, e.g. to use
+// `Interval_nt_round_to_nearest`, which does not change the rounding mode.
+template < typename Kernel >
+struct Filtered_kernel_interval_selector
+{
+    typedef Interval_nt_advanced                          Type;
+};
+
 // CK = eventually rebound construction kernel (gets Point_2 from).
 // Exact_kernel = exact kernel called when needed by the filter.
 // Approximate_kernel = filtering "interval" kernel
@@ -51,9 +60,16 @@ struct Filtered_kernel_base
     typedef typename Exact_kernel_selector<CK>::C2E             C2E;
     typedef typename Exact_kernel_selector<CK>::C2E_rt          C2E_rt;
 
-    typedef Simple_cartesian<Interval_nt_advanced>        Approximate_kernel;
+    typedef typename Filtered_kernel_interval_selector<
+                       typename CK::Kernel>::Type         Approximate_nt;
+    typedef Simple_cartesian<Approximate_nt>              Approximate_kernel;
     typedef Cartesian_converter<CK, Approximate_kernel>   C2F;
 
+    // The rounding mode only has to be changed around the approximate
+    // stage if the interval arithmetic requires it.
+    static constexpr bool Protection =
+      std::is_same<typename Approximate_nt::Protector, Protect_FPU_rounding<true> >::value;
+
     enum { Has_filtered_predicates = true };
     typedef Boolean_tag<Has_filtered_predicates> Has_filtered_predicates_tag;
 
@@ -83,7 +99,8 @@ struct Filtered_kernel_base
                                      typename Approximate_kernel::P, \
                                     C2E_rt, \
                                     C2E, \
-                                    C2F> P; \
+                                    C2F, \
+                                    Protection> P; \
     P Pf() const { return P(); }
 
 #define CGAL_Kernel_pred(P, Pf) CGAL_Kernel_pred_RT_or_FT(P, Pf)
@@ -0,0 +1,229 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_INTERNAL_STATIC_FILTERS_BATCHED_STATIC_FILTERS_H
+#define CGAL_INTERNAL_STATIC_FILTERS_BATCHED_STATIC_FILTERS_H
+
+#include <CGAL/config.h>
+#include <CGAL/FPU.h>
+#include <CGAL/determinant.h>
+
+#if defined __AVX__ || defined __AVX512F__
+#  include <immintrin.h>
+#endif
+
+#include <cmath>
+#include <cstddef>
+
+/*
+ * The semi-static filters of Orientation_3 and Side_of_oriented_sphere_3
+ * (see Orientation_3.h and Side_of_oriented_sphere_3.h in this directory),
+ * evaluated on several lanes at once.
+ *
+ * The coordinates are given as a structure of arrays. The operations are
+ * the same as in the scalar filters, in the same order, so that the same
+ * error bounds apply. The result of each lane is the sign of the predicate,
+ * or `batched_filter_failure` if the filter cannot decide it.
+ */
+
+namespace CGAL { namespace internal { namespace Static_filters_predicates {
+
+const signed char batched_filter_failure = 2;
+
+// Packs of doubles. The masks are bit fields, one bit per lane.
+
+struct Double_pack_1
+{
+  static constexpr std::size_t size = 1;
+  double v;
+
+  static Double_pack_1 load(const double* p) { return { *p }; }
+  static Double_pack_1 set1(double x) { return { x }; }
+
+  friend Double_pack_1 operator+(Double_pack_1 a, Double_pack_1 b) { return { a.v + b.v }; }
+  friend Double_pack_1 operator-(Double_pack_1 a, Double_pack_1 b) { return { a.v - b.v }; }
+  friend Double_pack_1 operator*(Double_pack_1 a, Double_pack_1 b) { return { a.v * b.v }; }
+  friend Double_pack_1 abs(Double_pack_1 a) { return { std::fabs(a.v) }; }
+  friend Double_pack_1 max(Double_pack_1 a, Double_pack_1 b) { return { (a.v < b.v) ? b.v : a.v }; }
+  friend Double_pack_1 min(Double_pack_1 a, Double_pack_1 b) { return { (b.v < a.v) ? b.v : a.v }; }
+  friend unsigned less(Double_pack_1 a, Double_pack_1 b) { return a.v < b.v; }
+  friend unsigned equal(Double_pack_1 a, Double_pack_1 b) { return a.v == b.v; }
+};
+
+#ifdef CGAL_HAS_SSE2
+struct Double_pack_2
+{
+  static constexpr std::size_t size = 2;
+  __m128d v;
+
+  static Double_pack_2 load(const double* p) { return { _mm_loadu_pd(p) }; }
+  static Double_pack_2 set1(double x) { return { _mm_set1_pd(x) }; }
+
+  friend Double_pack_2 operator+(Double_pack_2 a, Double_pack_2 b) { return { _mm_add_pd(a.v, b.v) }; }
+  friend Double_pack_2 operator-(Double_pack_2 a, Double_pack_2 b) { return { _mm_sub_pd(a.v, b.v) }; }
+  friend Double_pack_2 operator*(Double_pack_2 a, Double_pack_2 b) { return { _mm_mul_pd(a.v, b.v) }; }
+  friend Double_pack_2 abs(Double_pack_2 a) { return { _mm_andnot_pd(_mm_set1_pd(-0.), a.v) }; }
+  friend Double_pack_2 max(Double_pack_2 a, Double_pack_2 b) { return { _mm_max_pd(a.v, b.v) }; }
+  friend Double_pack_2 min(Double_pack_2 a, Double_pack_2 b) { return { _mm_min_pd(a.v, b.v) }; }
+  friend unsigned less(Double_pack_2 a, Double_pack_2 b) { return unsigned(_mm_movemask_pd(_mm_cmplt_pd(a.v, b.v))); }
+  friend unsigned equal(Double_pack_2 a, Double_pack_2 b) { return unsigned(_mm_movemask_pd(_mm_cmpeq_pd(a.v, b.v))); }
+};
+#endif
+
+#ifdef __AVX__
+struct Double_pack_4
+{
+  static constexpr std::size_t size = 4;
+  __m256d v;
+
+  static Double_pack_4 load(const double* p) { return { _mm256_loadu_pd(p) }; }
+  static Double_pack_4 set1(double x) { return { _mm256_set1_pd(x) }; }
+
+  friend Double_pack_4 operator+(Double_pack_4 a, Double_pack_4 b) { return { _mm256_add_pd(a.v, b.v) }; }
+  friend Double_pack_4 operator-(Double_pack_4 a, Double_pack_4 b) { return { _mm256_sub_pd(a.v, b.v) }; }
+  friend Double_pack_4 operator*(Double_pack_4 a, Double_pack_4 b) { return { _mm256_mul_pd(a.v, b.v) }; }
+  friend Double_pack_4 abs(Double_pack_4 a) { return { _mm256_andnot_pd(_mm256_set1_pd(-0.), a.v) }; }
+  friend Double_pack_4 max(Double_pack_4 a, Double_pack_4 b) { return { _mm256_max_pd(a.v, b.v) }; }
+  friend Double_pack_4 min(Double_pack_4 a, Double_pack_4 b) { return { _mm256_min_pd(a.v, b.v) }; }
+  friend unsigned less(Double_pack_4 a, Double_pack_4 b)
+  { return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ))); }
+  friend unsigned equal(Double_pack_4 a, Double_pack_4 b)
+  { return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ))); }
+};
+#endif
+
+#ifdef __AVX512F__
+struct Double_pack_8
+{
+  static constexpr std::size_t size = 8;
+  __m512d v;
+
+  static Double_pack_8 load(const double* p) { return { _mm512_loadu_pd(p) }; }
+  static Double_pack_8 set1(double x) { return { _mm512_set1_pd(x) }; }
+
+  friend Double_pack_8 operator+(Double_pack_8 a, Double_pack_8 b) { return { _mm512_add_pd(a.v, b.v) }; }
+  friend Double_pack_8 operator-(Double_pack_8 a, Double_pack_8 b) { return { _mm512_sub_pd(a.v, b.v) }; }
+  friend Double_pack_8 operator*(Double_pack_8 a, Double_pack_8 b) { return { _mm512_mul_pd(a.v, b.v) }; }
+  friend Double_pack_8 abs(Double_pack_8 a) { return { _mm512_abs_pd(a.v) }; }
+  friend Double_pack_8 max(Double_pack_8 a, Double_pack_8 b) { return { _mm512_max_pd(a.v, b.v) }; }
+  friend Double_pack_8 min(Double_pack_8 a, Double_pack_8 b) { return { _mm512_min_pd(a.v, b.v) }; }
+  friend unsigned less(Double_pack_8 a, Double_pack_8 b) { return unsigned(_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)); }
+  friend unsigned equal(Double_pack_8 a, Double_pack_8 b) { return unsigned(_mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ)); }
+};
+typedef Double_pack_8 Double_pack;
+#elif defined __AVX__
+typedef Double_pack_4 Double_pack;
+#elif defined CGAL_HAS_SSE2
+typedef Double_pack_2 Double_pack;
+#else
+typedef Double_pack_1 Double_pack;
+#endif
+
+template <typename Pack>
+void store_batched_signs(unsigned positive, unsigned negative, unsigned zero, signed char* result)
+{
+  for(std::size_t j=0; j<Pack::size; ++j)
+  {
+    const unsigned bit = 1u << j;
+    result[j] = (positive & bit) ? 1 : (negative & bit) ? -1 : (zero & bit) ? 0 : batched_filter_failure;
+  }
+}
+
+// `c` holds the 12 arrays px, py, pz, qx, ..., sz; `n` must be a multiple of `Pack::size`.
+template <typename Pack>
+void batched_orientation_3(const double* const c[12], const std::size_t n, signed char* result)
+{
+  const Pack zero = Pack::set1(0.), underflow = Pack::set1(1e-97), overflow = Pack::set1(1e102);
+  const Pack bound = Pack::set1(5.1107127829973299e-15);
+
+  for(std::size_t i=0; i<n; i+=Pack::size)
+  {
+    const Pack px = Pack::load(c[0] + i), py = Pack::load(c[1] + i), pz = Pack::load(c[2] + i);
+
+    const Pack pqx = Pack::load(c[3] + i) - px;
+    const Pack pqy = Pack::load(c[4] + i) - py;
+    const Pack pqz = Pack::load(c[5] + i) - pz;
+    const Pack prx = Pack::load(c[6] + i) - px;
+    const Pack pry = Pack::load(c[7] + i) - py;
+    const Pack prz = Pack::load(c[8] + i) - pz;
+    const Pack psx = Pack::load(c[9] + i) - px;
+    const Pack psy = Pack::load(c[10] + i) - py;
+    const Pack psz = Pack::load(c[11] + i) - pz;
+
+    const Pack maxx = max(max(abs(pqx), abs(prx)), abs(psx));
+    const Pack maxy = max(max(abs(pqy), abs(pry)), abs(psy));
+    const Pack maxz = max(max(abs(pqz), abs(prz)), abs(psz));
+
+    const Pack det = CGAL::determinant(pqx, pqy, pqz,
+                                       prx, pry, prz,
+                                       psx, psy, psz);
+    const Pack eps = bound * maxx * maxy * maxz;
+
+    const Pack lo = min(min(maxx, maxy), maxz);
+    const Pack hi = max(max(maxx, maxy), maxz);
+
+    // Protect against underflow in the computation of eps, and against overflow in the computation of det.
+    const unsigned ok = ~less(lo, underflow) & less(hi, overflow);
+    store_batched_signs<Pack>(ok & less(eps, det), ok & less(det, zero - eps), equal(lo, zero), result + i);
+  }
+}
+
+// `c` holds the 15 arrays px, py, pz, qx, ..., tz; `n` must be a multiple of `Pack::size`.
+template <typename Pack>
+void batched_side_of_oriented_sphere_3(const double* const c[15], const std::size_t n, signed char* result)
+{
+  const Pack zero = Pack::set1(0.), underflow = Pack::set1(1e-58), overflow = Pack::set1(1e61);
+  const Pack bound = Pack::set1(1.2466136531027298e-13);
+
+  for(std::size_t i=0; i<n; i+=Pack::size)
+  {
+    const Pack tx = Pack::load(c[12] + i), ty = Pack::load(c[13] + i), tz = Pack::load(c[14] + i);
+
+    const Pack ptx = Pack::load(c[0] + i) - tx;
+    const Pack pty = Pack::load(c[1] + i) - ty;
+    const Pack ptz = Pack::load(c[2] + i) - tz;
+    const Pack pt2 = ptx * ptx + pty * pty + ptz * ptz;
+    const Pack qtx = Pack::load(c[3] + i) - tx;
+    const Pack qty = Pack::load(c[4] + i) - ty;
+    const Pack qtz = Pack::load(c[5] + i) - tz;
+    const Pack qt2 = qtx * qtx + qty * qty + qtz * qtz;
+    const Pack rtx = Pack::load(c[6] + i) - tx;
+    const Pack rty = Pack::load(c[7] + i) - ty;
+    const Pack rtz = Pack::load(c[8] + i) - tz;
+    const Pack rt2 = rtx * rtx + rty * rty + rtz * rtz;
+    const Pack stx = Pack::load(c[9] + i) - tx;
+    const Pack sty = Pack::load(c[10] + i) - ty;
+    const Pack stz = Pack::load(c[11] + i) - tz;
+    const Pack st2 = stx * stx + sty * sty + stz * stz;
+
+    const Pack maxx = max(max(max(abs(ptx), abs(qtx)), abs(rtx)), abs(stx));
+    const Pack maxy = max(max(max(abs(pty), abs(qty)), abs(rty)), abs(sty));
+    const Pack maxz = max(max(max(abs(ptz), abs(qtz)), abs(rtz)), abs(stz));
+
+    const Pack lo = min(min(maxx, maxy), maxz);
+    const Pack hi = max(max(maxx, maxy), maxz);
+    const Pack eps = (bound * maxx * maxy * maxz) * (hi * hi);
+
+    const Pack det = CGAL::determinant(ptx, pty, ptz, pt2,
+                                       rtx, rty, rtz, rt2,
+                                       qtx, qty, qtz, qt2,
+                                       stx, sty, stz, st2);
+
+    // Protect against underflow in the computation of eps, and against overflow in the computation of det.
+    const unsigned ok = ~less(lo, underflow) & less(hi, overflow);
+    store_batched_signs<Pack>(ok & less(eps, det), ok & less(det, zero - eps), equal(lo, zero), result + i);
+  }
+}
+
+} } } // namespace CGAL::internal::Static_filters_predicates
+
+#endif // CGAL_INTERNAL_STATIC_FILTERS_BATCHED_STATIC_FILTERS_H
@@ -39,10 +39,13 @@ namespace CGAL {
 //   not, or we let all this up to the compiler optimizer to figure out ?
 // - Some caching could be done at the Point_2 level.
 
-// Protection is undocumented and currently always true, meaning that it
-// assumes a default rounding mode of round-to-nearest. false would correspond
-// to a default of round-towards-infinity, so interval arithmetic does not
-// require protection but regular code may.
+// Protection is undocumented. true means that the default rounding mode is
+// round-to-nearest and that the interval arithmetic requires round-towards-infinity.
+// false would correspond to a default of round-towards-infinity, so interval
+// arithmetic does not require protection but regular code may. It is also used
+// with an interval arithmetic that works in round-to-nearest, such as
+// Interval_nt_round_to_nearest: the rounding mode is then only (redundantly)
+// set in the exact stage.
 
 template <class EP, class AP, class C2E, class C2A, bool Protection = true>
 class Filtered_predicate
@@ -17,6 +17,7 @@
 
 #include <CGAL/basic.h>
 #include <CGAL/Handle.h>
+#include <CGAL/Lazy_node_pool.h>
 #include <CGAL/Object.h>
 #include <CGAL/Kernel/Type_mapper.h>
 #include <CGAL/Profile_counter.h>
@@ -296,7 +297,7 @@ struct AT_ET_wrap : AT_wrap<AT> {
 
 // Abstract base class for lazy numbers and lazy objects
 template <typename AT_, typename ET, typename E2A, int=Lazy_rep_selector<AT_>::value /* 0 */>
-class Lazy_rep : public Rep, public Depth_base
+class Lazy_rep : public Rep, public Depth_base, public Lazy_node_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -322,7 +323,7 @@ public:
 
   template<class A, class E>
   Lazy_rep (A&& a, E&& e)
-      : ptr_(new AT_ET_wrap<AT,ET>(std::forward<A>(a), std::forward<E>(e))) {}
+      : ptr_(new_lazy_node<AT_ET_wrap<AT,ET> >(std::forward<A>(a), std::forward<E>(e))) {}
 
   AT const& approx() const
   {
@@ -337,8 +338,12 @@ public:
 
   const ET & exact() const
   {
-    // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
-    //if (is_lazy())
+    // Once update_exact() has published the exact value with set_ptr() (release),
+    // an acquire load is enough to read it: shared nodes that are already exact
+    // do not go through the once_flag.
+    auto* p = ptr_.load(std::memory_order_acquire);
+    if (p != &at_orig)
+      return static_cast<AT_ET_wrap<AT,ET>*>(p)->et();
     std::call_once(once, [this](){this->update_exact();});
     return exact_unsafe(); // call_once already synchronized memory
   }
@@ -395,11 +400,11 @@ public:
     auto* p = ptr_.load(std::memory_order_relaxed);
     if (p != &at_orig) {
       std::atomic_thread_fence(std::memory_order_acquire);
-      delete static_cast<Indirect*>(p);
+      delete_lazy_node(static_cast<Indirect*>(p));
     }
 #else
     auto* p = ptr_.load(std::memory_order_consume);
-    if (p != &at_orig) delete static_cast<Indirect*>(p);
+    if (p != &at_orig) delete_lazy_node(static_cast<Indirect*>(p));
 #endif
   }
 };
@@ -409,7 +414,7 @@ public:
  * For aggregate-like types (Simple_cartesian::Point_3), it should be ok for the same reason.
  * This is definitely NOT safe for a std::vector like a Point_d with Dynamic_dimension_tag, so it should only be enabled on a case by case basis, if at all. Storing a Point_3 piecewise with 6 atomic_double would be doable, but painful, and I didn't benchmark to check the performance. */
 template <typename AT_, typename ET, typename E2A>
-class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Depth_base
+class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Depth_base, public Lazy_node_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -437,7 +442,7 @@ public:
 
   template<class A, class E>
   Lazy_rep (A&& a, E&& e)
-      : at(std::forward<A>(a)), ptr_(new ET(std::forward<E>(e))) {}
+      : at(std::forward<A>(a)), ptr_(new_lazy_node<ET>(std::forward<E>(e))) {}
 
   AT const& approx() const
   {
@@ -462,8 +467,9 @@ public:
   const ET & exact() const
   {
 #ifdef CGAL_HAS_THREADS
-    // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
-    //if (is_lazy())
+    // See the generic Lazy_rep: no synchronization through the once_flag once the exact value is published.
+    if (ET* p = ptr_.load(std::memory_order_acquire))
+      return *p;
     std::call_once(once, [this](){this->update_exact();});
 #else
     if (is_lazy())
@@ -511,18 +517,18 @@ public:
     auto* p = ptr_.load(std::memory_order_relaxed);
     if (p != nullptr) {
       std::atomic_thread_fence(std::memory_order_acquire);
-      delete p;
+      delete_lazy_node(p);
     }
 #else
     auto* p = ptr_.load(std::memory_order_consume);
-    if (p != nullptr) delete p;
+    if (p != nullptr) delete_lazy_node(p);
 #endif
   }
 };
 
 // do we need to (forward) declare Interval_nt?
 template <bool b, typename ET, typename E2A>
-class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Depth_base
+class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Depth_base, public Lazy_node_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -541,7 +547,7 @@ public:
 
   template<class E>
   Lazy_rep (AT a, E&& e)
-      : x(-a.inf()), y(a.sup()), ptr_(new ET(std::forward<E>(e))) {}
+      : x(-a.inf()), y(a.sup()), ptr_(new_lazy_node<ET>(std::forward<E>(e))) {}
 
   AT approx() const
   {
@@ -571,8 +577,9 @@ public:
 
   const ET & exact() const
   {
-    // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
-    //if (is_lazy())
+    // See the generic Lazy_rep: no synchronization through the once_flag once the exact value is published.
+    if (ET* p = ptr_.load(std::memory_order_acquire))
+      return *p;
     std::call_once(once, [this](){this->update_exact();});
     return exact_unsafe(); // call_once already synchronized memory
   }
@@ -618,11 +625,11 @@ public:
     auto* p = ptr_.load(std::memory_order_relaxed);
     if (p != nullptr) {
       std::atomic_thread_fence(std::memory_order_acquire);
-      delete p;
+      delete_lazy_node(p);
     }
 #else
     auto* p = ptr_.load(std::memory_order_consume);
-    if (p != nullptr) delete p;
+    if (p != nullptr) delete_lazy_node(p);
 #endif
   }
 };
@@ -640,7 +647,7 @@ class Lazy_rep_n final :
   const EC& ec() const { return *this; }
   template<std::size_t...I>
   void update_exact_helper(std::index_sequence<I...>) const {
-    auto* p = new typename Base::Indirect(ec()( CGAL::exact( std::get<I>(l) ) ... ) );
+    auto* p = new_lazy_node<typename Base::Indirect>(ec()( CGAL::exact( std::get<I>(l) ) ... ) );
     this->set_at(p);
     this->set_ptr(p);
     if(!noprune || is_currently_single_threaded())
@@ -692,7 +699,7 @@ class Lazy_rep_optional_n :
   template<std::size_t...I>
   void update_exact_helper(std::index_sequence<I...>) const {
     typedef Lazy_rep< AT, ET, E2A > Base;
-    auto* p = new typename Base::Indirect( * ec()( CGAL::exact( std::get<I>(l) ) ... ) );
+    auto* p = new_lazy_node<typename Base::Indirect>( * ec()( CGAL::exact( std::get<I>(l) ) ... ) );
     this->set_at(p);
     this->set_ptr(p);
     lazy_reset_member(l);
@@ -755,14 +762,13 @@ public:
   update_exact() const
   {
 #ifdef CGAL_HAS_THREADS
-    // Unless we add is_lazy before call_once in Lazy_rep. This test is
-    // necessary because this class can be used either for default
+    // Lazy_rep::exact() only calls this function if no exact value has been
+    // published, but keep the test: this class can be used either for default
     // construction, or to store a non-lazy exact value, and only the first one
     // should have a non-empty update_exact.
-    // An alternative would be to add in the constructors taking an ET: std::call_once(this->once, [](){});
     if(!this->is_lazy()) return;
 #endif
-    auto* p = new typename Base::Indirect();
+    auto* p = new_lazy_node<typename Base::Indirect>();
     this->set_ptr(p);
   }
 
@@ -879,7 +885,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = new_lazy_node<typename Base::Indirect>();
     // TODO : This looks really unfinished...
     std::vector<Object> vec;
     //this->et->reserve(this->at.size());
@@ -931,7 +937,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = new_lazy_node<typename Base::Indirect>();
     p->et_.reserve(this->at_orig.at().size());
     ec()(CGAL::exact(l1_), CGAL::exact(l2_), std::back_inserter(p->et_));
     this->set_at(p);
@@ -982,7 +988,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = new_lazy_node<typename Base::Indirect>();
     ec()(CGAL::exact(l1_), CGAL::exact(l2_), p->et_);
     this->set_at(p);
     this->set_ptr(p);
@@ -1036,7 +1042,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = new_lazy_node<typename Base::Indirect>();
     ec()(CGAL::exact(l1_), CGAL::exact(l2_), p->et_.first, p->et_.second );
     this->set_at(p);
     this->set_ptr(p);
@@ -0,0 +1,399 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_LAZY_NODE_POOL_H
+#define CGAL_LAZY_NODE_POOL_H
+
+#include <CGAL/config.h>
+#include <CGAL/assertions.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+/*
+ * Allocation of the nodes of the DAGs of the lazy kernel (Lazy_rep and its
+ * derived classes) and of their exact values.
+ *
+ * All these allocations go through the class named by the macro
+ * CGAL_LAZY_NODE_ALLOCATOR, which must provide the two static functions
+ *   void* allocate(std::size_t n);
+ *   void deallocate(void* p, std::size_t n);
+ * (n being the same in both calls). By default, the global operator new is used.
+ * If CGAL_LAZY_KERNEL_USE_NODE_POOL is defined, Lazy_node_pool is used instead.
+ * The macros must have the same value in all translation units of a program.
+ */
+
+namespace CGAL {
+
+struct Lazy_node_default_allocator
+{
+  static void* allocate(std::size_t n) { return ::operator new(n); }
+  static void deallocate(void* p, std::size_t) noexcept { ::operator delete(p); }
+};
+
+namespace internal {
+
+struct Lazy_node_pool_block
+{
+  Lazy_node_pool_block* next;
+};
+
+// Singly linked list of free blocks of the same size
+struct Lazy_node_pool_free_list
+{
+  Lazy_node_pool_block* head;
+  std::size_t size;
+
+  void push(void* p)
+  {
+    Lazy_node_pool_block* b = static_cast<Lazy_node_pool_block*>(p);
+    b->next = head;
+    head = b;
+    ++size;
+  }
+
+  void* pop()
+  {
+    Lazy_node_pool_block* b = head;
+    head = b->next;
+    --size;
+    return b;
+  }
+
+  // moves the first `n` blocks of `other` to the front of `*this`
+  void splice(Lazy_node_pool_free_list& other, std::size_t n)
+  {
+    n = (std::min)(n, other.size);
+    if(n == 0)
+      return;
+    Lazy_node_pool_block* first = other.head;
+    Lazy_node_pool_block* last = first;
+    for(std::size_t i=1; i<n; ++i)
+      last = last->next;
+    other.head = last->next;
+    other.size -= n;
+    last->next = head;
+    head = first;
+    size += n;
+  }
+};
+
+// The memory is obtained from the system by chunks aligned on their size,
+// so that the header of the chunk of a block is found from the address of the block.
+struct Lazy_node_pool_chunk
+{
+  std::size_t nb_blocks;
+  std::size_t nb_free_blocks; // only used by Lazy_node_pool::release_memory()
+};
+
+} // namespace internal
+
+/*!
+ * Thread-safe pool of small blocks of memory, used for the nodes of the
+ * lazy kernel and their exact values when `CGAL_LAZY_KERNEL_USE_NODE_POOL`
+ * is defined.
+ *
+ * Each thread allocates from and deallocates to its own cache of free blocks,
+ * without synchronization. The caches are refilled from, and overflow to, a
+ * depot shared by all threads, which allocates the memory by chunks.
+ * Memory is given back to the system only by `release_memory()`, in particular
+ * at the end of the scope of a `Lazy_node_pool_scope`.
+ */
+class Lazy_node_pool
+{
+  typedef internal::Lazy_node_pool_block       Block;
+  typedef internal::Lazy_node_pool_free_list   Free_list;
+  typedef internal::Lazy_node_pool_chunk       Chunk;
+
+public:
+  // sizes are rounded up to a multiple of `granularity`, larger blocks are left to operator new
+  static constexpr std::size_t granularity = 16;
+  static constexpr std::size_t nb_size_classes = 32;
+  static constexpr std::size_t max_block_size = granularity * nb_size_classes;
+  static constexpr std::size_t chunk_size = std::size_t(1) << 16;
+
+private:
+  static constexpr std::size_t header_size = 64;
+  static_assert(sizeof(Chunk) <= header_size, "");
+  static_assert(granularity >= alignof(std::max_align_t), "");
+
+  struct Cache
+  {
+    Free_list lists[nb_size_classes];
+    bool registered;
+    bool destroyed;
+  };
+
+  struct Depot
+  {
+    std::mutex mutex;
+    Free_list lists[nb_size_classes];
+    std::size_t nb_chunks = 0;
+  };
+
+  // Gives the free blocks of the cache back to the depot when the thread exits.
+  struct Cache_guard
+  {
+    ~Cache_guard()
+    {
+      Cache& c = cache();
+      {
+        Depot& d = depot();
+        std::lock_guard<std::mutex> lock(d.mutex);
+        for(std::size_t i=0; i<nb_size_classes; ++i)
+          d.lists[i].splice(c.lists[i], c.lists[i].size);
+      }
+      c.destroyed = true;
+      release_memory();
+    }
+  };
+
+  // trivially destructible, so that it can still be used by the destructors of
+  // other thread local variables, once the guard has been destroyed
+  static Cache& cache()
+  {
+#ifdef CGAL_HAS_THREADS
+    static thread_local Cache c{};
+#else
+    static Cache c{};
+#endif
+    return c;
+  }
+
+  // never destroyed: nodes can be released by the destructors of static variables
+  static Depot& depot()
+  {
+    static Depot* d = new Depot();
+    return *d;
+  }
+
+  static std::size_t size_class(std::size_t n) { return (n + granularity - 1) / granularity - 1; }
+  static std::size_t block_size(std::size_t c) { return (c + 1) * granularity; }
+  static std::size_t nb_blocks_per_chunk(std::size_t c) { return (chunk_size - header_size) / block_size(c); }
+
+  // number of blocks exchanged at once between a cache and the depot
+  static std::size_t batch_size(std::size_t c) { return (std::max)(nb_blocks_per_chunk(c) / 4, std::size_t(1)); }
+
+  static Chunk* chunk_of(void* p)
+  {
+    return reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(p) & ~(std::uintptr_t(chunk_size) - 1));
+  }
+
+  // requires the lock of the depot
+  static void new_chunk(std::size_t c, Free_list& list)
+  {
+    char* mem = static_cast<char*>(::operator new(chunk_size, std::align_val_t(chunk_size)));
+    Chunk* chunk = ::new(mem) Chunk();
+    chunk->nb_blocks = nb_blocks_per_chunk(c);
+    // pushed backwards, so that the blocks are handed out in increasing addresses
+    for(std::size_t i=chunk->nb_blocks; i>0; --i)
+      list.push(mem + header_size + (i - 1) * block_size(c));
+    ++depot().nb_chunks;
+  }
+
+  static void* refill(std::size_t c)
+  {
+    Cache& ca = cache();
+#ifdef CGAL_HAS_THREADS
+    if(!ca.registered && !ca.destroyed)
+    {
+      static thread_local Cache_guard guard;
+      CGAL_USE(guard);
+      ca.registered = true;
+    }
+#endif
+    Depot& d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    if(d.lists[c].size == 0)
+      new_chunk(c, d.lists[c]);
+    // the thread is exiting: its cache is not used anymore
+    if(ca.destroyed)
+      return d.lists[c].pop();
+    ca.lists[c].splice(d.lists[c], batch_size(c));
+    return ca.lists[c].pop();
+  }
+
+  static void overflow(std::size_t c)
+  {
+    Cache& ca = cache();
+    Depot& d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    d.lists[c].splice(ca.lists[c], ca.destroyed ? ca.lists[c].size : ca.lists[c].size / 2);
+  }
+
+public:
+  static void* allocate(std::size_t n)
+  {
+    if(n > max_block_size)
+      return ::operator new(n);
+    const std::size_t c = size_class(n);
+    Free_list& list = cache().lists[c];
+    if(list.head == nullptr)
+      return refill(c);
+    return list.pop();
+  }
+
+  static void deallocate(void* p, std::size_t n) noexcept
+  {
+    if(n > max_block_size)
+    {
+      ::operator delete(p);
+      return;
+    }
+    const std::size_t c = size_class(n);
+    Cache& ca = cache();
+    ca.lists[c].push(p);
+    // keeps the cache bounded when a thread releases nodes allocated by other threads
+    if(ca.lists[c].size > 2 * nb_blocks_per_chunk(c) || ca.destroyed)
+      overflow(c);
+  }
+
+  /*!
+   * Gives back to the system the chunks of memory of which all the blocks are free
+   * and held either by the calling thread or by the depot. The free blocks of the calling
+   * thread are moved to the depot. Nodes that are still alive are not affected.
+   */
+  static void release_memory()
+  {
+    Cache& ca = cache();
+    Depot& d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+
+    for(std::size_t c=0; c<nb_size_classes; ++c)
+    {
+      Free_list& list = d.lists[c];
+      list.splice(ca.lists[c], ca.lists[c].size);
+      if(list.size < nb_blocks_per_chunk(c))
+        continue;
+
+      for(Block* b=list.head; b!=nullptr; b=b->next)
+        chunk_of(b)->nb_free_blocks = 0;
+      for(Block* b=list.head; b!=nullptr; b=b->next)
+        ++chunk_of(b)->nb_free_blocks;
+
+      std::vector<Chunk*> empty_chunks;
+      Free_list kept{nullptr, 0};
+      Block* b = list.head;
+      while(b != nullptr)
+      {
+        Block* next = b->next;
+        Chunk* chunk = chunk_of(b);
+        if(chunk->nb_free_blocks == chunk->nb_blocks)
+        {
+          // each chunk is recorded once, by its first block in the list
+          if(chunk->nb_free_blocks != 0)
+            empty_chunks.push_back(chunk);
+          chunk->nb_free_blocks = 0;
+          chunk->nb_blocks = 0;
+        }
+        else
+        {
+          kept.push(b);
+        }
+        b = next;
+      }
+
+      // `kept` is in reverse order, restore the order of the list
+      list = Free_list{nullptr, 0};
+      while(kept.head != nullptr)
+        list.push(kept.pop());
+
+      for(Chunk* chunk : empty_chunks)
+        ::operator delete(static_cast<void*>(chunk), std::align_val_t(chunk_size));
+      d.nb_chunks -= empty_chunks.size();
+    }
+  }
+
+  /// returns the number of bytes currently obtained from the system by chunks
+  static std::size_t memory_size()
+  {
+    Depot& d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    return d.nb_chunks * chunk_size;
+  }
+};
+
+/*!
+ * Calls `Lazy_node_pool::release_memory()` at the end of its scope, so that the memory
+ * of the nodes of the lazy kernel released by a computation is given back to the system,
+ * while the nodes that outlive the scope remain valid.
+ */
+class Lazy_node_pool_scope
+{
+public:
+  Lazy_node_pool_scope() {}
+  Lazy_node_pool_scope(const Lazy_node_pool_scope&) = delete;
+  Lazy_node_pool_scope& operator=(const Lazy_node_pool_scope&) = delete;
+  ~Lazy_node_pool_scope() { Lazy_node_pool::release_memory(); }
+};
+
+} // namespace CGAL
+
+#ifndef CGAL_LAZY_NODE_ALLOCATOR
+#  ifdef CGAL_LAZY_KERNEL_USE_NODE_POOL
+#    define CGAL_LAZY_NODE_ALLOCATOR CGAL::Lazy_node_pool
+#  else
+#    define CGAL_LAZY_NODE_ALLOCATOR CGAL::Lazy_node_default_allocator
+#  endif
+#endif
+
+namespace CGAL {
+
+typedef CGAL_LAZY_NODE_ALLOCATOR Lazy_node_allocator;
+
+// The nodes of the lazy DAGs derive from this class.
+struct Lazy_node_allocated
+{
+  static void* operator new(std::size_t n) { return Lazy_node_allocator::allocate(n); }
+  static void operator delete(void* p, std::size_t n) noexcept { Lazy_node_allocator::deallocate(p, n); }
+
+  // the class-specific operator new hides the placement form
+  static void* operator new(std::size_t, void* p) noexcept { return p; }
+  static void operator delete(void*, void*) noexcept {}
+};
+
+// for the exact values, which are not necessarily of a class type
+template <class T, class... A>
+T* new_lazy_node(A&&... a)
+{
+  if constexpr(alignof(T) > alignof(std::max_align_t)) {
+    return new T(std::forward<A>(a)...);
+  } else {
+    void* p = Lazy_node_allocator::allocate(sizeof(T));
+    try {
+      return ::new(p) T(std::forward<A>(a)...);
+    } catch(...) {
+      Lazy_node_allocator::deallocate(p, sizeof(T));
+      throw;
+    }
+  }
+}
+
+template <class T>
+void delete_lazy_node(T* p)
+{
+  if constexpr(alignof(T) > alignof(std::max_align_t)) {
+    delete p;
+  } else {
+    p->~T();
+    Lazy_node_allocator::deallocate(p, sizeof(T));
+  }
+}
+
+} // namespace CGAL
+
+#endif // CGAL_LAZY_NODE_POOL_H
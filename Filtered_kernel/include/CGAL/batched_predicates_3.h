@@ -0,0 +1,179 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_BATCHED_PREDICATES_3_H
+#define CGAL_BATCHED_PREDICATES_3_H
+
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/enum.h>
+#include <CGAL/Kernel_23/internal/Has_boolean_tags.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/tools.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Batched_static_filters.h>
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace CGAL {
+namespace internal {
+
+// Number of queries whose coordinates are gathered before running the vectorized filter.
+const std::size_t batched_predicates_block_size = 64;
+
+template <typename Point>
+bool gather_batched_coordinates(const Point& p, double* c[], const std::size_t i)
+{
+  typedef Static_filters_predicates::Get_approx<Point> Get_approx;
+  const auto& ap = Get_approx()(p);
+  return fit_in_double(ap.x(), c[0][i]) && std::isfinite(c[0][i]) &&
+         fit_in_double(ap.y(), c[1][i]) && std::isfinite(c[1][i]) &&
+         fit_in_double(ap.z(), c[2][i]) && std::isfinite(c[2][i]);
+}
+
+template <typename Query, std::size_t... I>
+bool gather_batched_query(const Query& q, double* c[], const std::size_t i, std::index_sequence<I...>)
+{
+  bool fit = true;
+  ((fit = fit && gather_batched_coordinates(std::get<I>(q), c + 3 * I, i)), ...);
+  return fit;
+}
+
+template <typename Predicate, typename Query, std::size_t... I>
+decltype(auto) call_batched_predicate(const Predicate& predicate, const Query& q, std::index_sequence<I...>)
+{
+  return predicate(std::get<I>(q)...);
+}
+
+// Evaluates `predicate` on the tuples of `N` points of the range, using the vectorized
+// static filter `filter` first, and `predicate` only for the queries it cannot decide.
+// The filter is only used if the predicates of the kernel are filtered: otherwise,
+// the results of the filter could differ from the ones of `predicate`.
+template <std::size_t N, typename Result, typename K, typename Filter,
+          typename InputIterator, typename OutputIterator, typename Predicate>
+OutputIterator
+batched_predicate(InputIterator first, InputIterator beyond, OutputIterator out,
+                  const Filter& filter, const Predicate& predicate)
+{
+  if constexpr(!Has_filtered_predicates<K>::value)
+  {
+    for(; first!=beyond; ++first)
+      *out++ = call_batched_predicate(predicate, *first, std::make_index_sequence<N>());
+    return out;
+  }
+
+  typedef Static_filters_predicates::Double_pack                   Pack;
+  const std::size_t block_size = batched_predicates_block_size;
+  static_assert(block_size % Pack::size == 0, "");
+
+  double coordinates[3 * N][block_size];
+  double* c[3 * N];
+  for(std::size_t k=0; k<3*N; ++k)
+    c[k] = coordinates[k];
+  signed char result[block_size];
+  bool fit[block_size];
+  InputIterator queries[block_size];
+
+  while(first != beyond)
+  {
+    std::size_t n = 0;
+    for(; n<block_size && first!=beyond; ++n, ++first)
+    {
+      queries[n] = first;
+      fit[n] = gather_batched_query(*first, c, n, std::make_index_sequence<N>());
+    }
+
+    // the lanes that do not hold a query, or whose coordinates are not doubles, are filled with zeros
+    const std::size_t m = ((n + Pack::size - 1) / Pack::size) * Pack::size;
+    for(std::size_t i=0; i<m; ++i)
+      if(i >= n || !fit[i])
+        for(std::size_t k=0; k<3*N; ++k)
+          coordinates[k][i] = 0;
+
+    filter(c, m, result);
+
+    for(std::size_t i=0; i<n; ++i)
+    {
+      if(fit[i] && result[i] != Static_filters_predicates::batched_filter_failure)
+        *out++ = static_cast<Result>(result[i]);
+      else
+        *out++ = call_batched_predicate(predicate, *queries[i], std::make_index_sequence<N>());
+    }
+  }
+  return out;
+}
+
+struct Batched_orientation_3_filter
+{
+  void operator()(const double* const c[], const std::size_t n, signed char* result) const
+  {
+    Static_filters_predicates::batched_orientation_3<Static_filters_predicates::Double_pack>(c, n, result);
+  }
+};
+
+struct Batched_side_of_oriented_sphere_3_filter
+{
+  void operator()(const double* const c[], const std::size_t n, signed char* result) const
+  {
+    Static_filters_predicates::batched_side_of_oriented_sphere_3<Static_filters_predicates::Double_pack>(c, n, result);
+  }
+};
+
+} // namespace internal
+
+// The semi-static filter of Orientation_3 is evaluated on blocks of quadruples of points,
+// with the SIMD instructions enabled at compile time (AVX-512, AVX, or SSE2), and the
+// predicate of the kernel is called only for the quadruples that the filter cannot decide,
+// or whose coordinates are not exactly representable by doubles.
+template <typename ForwardIterator, typename OutputIterator, typename K>
+OutputIterator
+batched_orientation(ForwardIterator first, ForwardIterator beyond, OutputIterator out, const K& k)
+{
+  return internal::batched_predicate<4, Orientation, K>(first, beyond, out,
+                                                        internal::Batched_orientation_3_filter(),
+                                                        k.orientation_3_object());
+}
+
+template <typename ForwardIterator, typename OutputIterator>
+OutputIterator
+batched_orientation(ForwardIterator first, ForwardIterator beyond, OutputIterator out)
+{
+  typedef typename std::iterator_traits<ForwardIterator>::value_type              Query;
+  typedef typename std::decay<decltype(std::get<0>(std::declval<const Query&>()))>::type  Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel                                 K;
+  return batched_orientation(first, beyond, out, K());
+}
+
+// Same as batched_orientation(), with the semi-static filter of Side_of_oriented_sphere_3.
+template <typename ForwardIterator, typename OutputIterator, typename K>
+OutputIterator
+batched_side_of_oriented_sphere(ForwardIterator first, ForwardIterator beyond, OutputIterator out, const K& k)
+{
+  return internal::batched_predicate<5, Oriented_side, K>(first, beyond, out,
+                                                          internal::Batched_side_of_oriented_sphere_3_filter(),
+                                                          k.side_of_oriented_sphere_3_object());
+}
+
+template <typename ForwardIterator, typename OutputIterator>
+OutputIterator
+batched_side_of_oriented_sphere(ForwardIterator first, ForwardIterator beyond, OutputIterator out)
+{
+  typedef typename std::iterator_traits<ForwardIterator>::value_type              Query;
+  typedef typename std::decay<decltype(std::get<0>(std::declval<const Query&>()))>::type  Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel                                 K;
+  return batched_side_of_oriented_sphere(first, beyond, out, K());
+}
+
+} // namespace CGAL
+
+#endif // CGAL_BATCHED_PREDICATES_3_H
@@ -0,0 +1,151 @@
+// The batched predicates must return the same results as the predicates of the kernel,
+// and the vectorized static filters the same results as their scalar version.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/batched_predicates_3.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Epick;
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Epeck;
+typedef CGAL::Simple_cartesian<double>                        SC;
+
+// random points, and points for which the filters fail or take the special branches
+template <typename K>
+std::vector<typename K::Point_3> points(CGAL::Random& rnd)
+{
+  typedef typename K::Point_3                                 Point_3;
+
+  std::vector<Point_3> pts;
+  for(int i=0; i<200; ++i)
+    pts.emplace_back(rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1));
+  // on a grid: many coplanar and cospherical configurations
+  for(int i=0; i<200; ++i)
+    pts.emplace_back(rnd.get_int(0, 3), rnd.get_int(0, 3), rnd.get_int(0, 3));
+  // almost on a grid
+  for(int i=0; i<50; ++i)
+    pts.emplace_back(rnd.get_int(0, 3) + 1e-16 * rnd.get_int(-2, 3), rnd.get_int(0, 3), rnd.get_int(0, 3));
+  // underflow and overflow of the bounds
+  for(int i=0; i<20; ++i)
+    pts.emplace_back(1e-100 * rnd.get_double(), 1e-100 * rnd.get_double(), rnd.get_double());
+  for(int i=0; i<20; ++i)
+    pts.emplace_back(1e120 * rnd.get_double(), rnd.get_double(), rnd.get_double());
+  return pts;
+}
+
+template <typename K>
+void test_kernel(const char* name)
+{
+  typedef typename K::Point_3                                 Point_3;
+
+  CGAL::Random rnd(0);
+  const std::vector<Point_3> pts = points<K>(rnd);
+  const int n = static_cast<int>(pts.size());
+
+  std::vector<std::array<Point_3, 4> > quadruples;
+  std::vector<std::tuple<Point_3, Point_3, Point_3, Point_3, Point_3> > quintuples;
+  for(int i=0; i<5000; ++i)
+  {
+    // the points of a query are taken in the same family most of the time
+    // random, grid, grid and almost on the grid, almost on the grid, underflow and overflow
+    const int families[5][2] = { { 0, 200 }, { 200, 200 }, { 200, 250 }, { 400, 50 }, { 450, 40 } };
+    const int family = rnd.get_int(0, 5);
+    const int first = families[family][0], size = families[family][1];
+    auto pick = [&]() { return pts[rnd.get_int(0, 10) == 0 ? rnd.get_int(0, n) : first + rnd.get_int(0, size)]; };
+
+    quadruples.push_back({ { pick(), pick(), pick(), pick() } });
+    quintuples.emplace_back(pick(), pick(), pick(), pick(), pick());
+  }
+  // repeated points
+  quadruples.push_back({ { pts[0], pts[0], pts[1], pts[2] } });
+  quadruples.push_back({ { pts[3], pts[3], pts[3], pts[3] } });
+  quintuples.emplace_back(pts[0], pts[1], pts[2], pts[3], pts[3]);
+  quintuples.emplace_back(pts[4], pts[4], pts[4], pts[4], pts[4]);
+
+  // all sizes of the last block
+  for(std::size_t size : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(64), std::size_t(65), quadruples.size() })
+  {
+    std::vector<CGAL::Orientation> orientations;
+    CGAL::batched_orientation(quadruples.begin(), quadruples.begin() + size, std::back_inserter(orientations));
+    assert(orientations.size() == size);
+    for(std::size_t i=0; i<size; ++i)
+    {
+      const auto& q = quadruples[i];
+      assert(orientations[i] == CGAL::orientation(q[0], q[1], q[2], q[3]));
+    }
+  }
+
+  std::vector<CGAL::Oriented_side> sides;
+  CGAL::batched_side_of_oriented_sphere(quintuples.begin(), quintuples.end(), std::back_inserter(sides), K());
+  assert(sides.size() == quintuples.size());
+  std::size_t nb_zeros = 0;
+  for(std::size_t i=0; i<sides.size(); ++i)
+  {
+    const auto& q = quintuples[i];
+    assert(sides[i] == CGAL::side_of_oriented_sphere(std::get<0>(q), std::get<1>(q), std::get<2>(q),
+                                                     std::get<3>(q), std::get<4>(q)));
+    if(sides[i] == CGAL::ON_ORIENTED_BOUNDARY)
+      ++nb_zeros;
+  }
+  std::cout << name << ": " << nb_zeros << " cospherical quintuples out of " << sides.size() << std::endl;
+}
+
+// the packs of the SIMD instructions and the scalar version give the same results
+void test_packs()
+{
+  using namespace CGAL::internal::Static_filters_predicates;
+
+  const std::size_t n = 4096;
+  CGAL::Random rnd(1);
+  std::vector<std::vector<double> > coordinates(15, std::vector<double>(n));
+  for(std::size_t i=0; i<n; ++i)
+    for(std::size_t k=0; k<15; ++k)
+    {
+      switch(i % 4)
+      {
+        case 0: coordinates[k][i] = rnd.get_double(-1, 1); break;
+        case 1: coordinates[k][i] = rnd.get_int(0, 2); break;
+        case 2: coordinates[k][i] = (k % 3 == 0) ? 1 : rnd.get_double(); break;
+        default: coordinates[k][i] = rnd.get_double() * ((k % 2 == 0) ? 1e-100 : 1e110); break;
+      }
+    }
+  const double* c[15];
+  for(std::size_t k=0; k<15; ++k)
+    c[k] = coordinates[k].data();
+
+  std::vector<signed char> scalar(n), packed(n);
+  batched_orientation_3<Double_pack_1>(c, n, scalar.data());
+  batched_orientation_3<Double_pack>(c, n, packed.data());
+  assert(scalar == packed);
+
+  std::size_t nb_failures = 0;
+  for(signed char r : scalar)
+    if(r == batched_filter_failure)
+      ++nb_failures;
+  assert(nb_failures > 0 && nb_failures < n);
+
+  batched_side_of_oriented_sphere_3<Double_pack_1>(c, n, scalar.data());
+  batched_side_of_oriented_sphere_3<Double_pack>(c, n, packed.data());
+  assert(scalar == packed);
+
+  std::cout << Double_pack::size << " lanes, " << nb_failures << " filter failures out of " << n << std::endl;
+}
+
+int main()
+{
+  test_packs();
+  test_kernel<Epick>("Epick");
+  test_kernel<Epeck>("Epeck");
+  test_kernel<SC>("Simple_cartesian<double>");
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+// The nodes of the lazy kernel are allocated by Lazy_node_pool:
+// nodes that outlive a Lazy_node_pool_scope, or that are released by another thread, remain valid.
+
+#define CGAL_LAZY_KERNEL_USE_NODE_POOL
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Lazy_node_pool.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_HAS_THREADS
+#include <thread>
+#endif
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   K;
+typedef K::FT                                                FT;
+typedef K::Point_3                                           Point_3;
+typedef K::Exact_kernel                                      EK;
+
+static_assert(std::is_same<CGAL::Lazy_node_allocator, CGAL::Lazy_node_pool>::value, "");
+
+void test_pool()
+{
+  typedef CGAL::Lazy_node_pool Pool;
+
+  const std::size_t initial_size = Pool::memory_size();
+  {
+    CGAL::Lazy_node_pool_scope scope;
+
+    std::vector<std::pair<unsigned char*, std::size_t> > blocks;
+    for(std::size_t i=0; i<100000; ++i)
+    {
+      const std::size_t n = 1 + (i * 37) % (Pool::max_block_size + 100);
+      unsigned char* p = static_cast<unsigned char*>(Pool::allocate(n));
+      assert(reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t) == 0);
+      std::memset(p, int(i % 256), n);
+      blocks.emplace_back(p, n);
+    }
+    assert(Pool::memory_size() > initial_size);
+
+    // the blocks do not overlap
+    for(std::size_t i=0; i<blocks.size(); ++i)
+      for(std::size_t j=0; j<blocks[i].second; ++j)
+        assert(blocks[i].first[j] == (unsigned char)(i % 256));
+
+    // half of the blocks are released, and allocated again
+    for(std::size_t i=0; i<blocks.size(); i+=2)
+      Pool::deallocate(blocks[i].first, blocks[i].second);
+    for(std::size_t i=0; i<blocks.size(); i+=2)
+      blocks[i].first = static_cast<unsigned char*>(Pool::allocate(blocks[i].second));
+
+    for(const auto& b : blocks)
+      Pool::deallocate(b.first, b.second);
+  }
+  std::cout << "memory of the pool: " << initial_size << " bytes, after the scope: "
+            << Pool::memory_size() << " bytes" << std::endl;
+  assert(Pool::memory_size() <= initial_size);
+}
+
+FT chain(const unsigned int seed)
+{
+  CGAL::Random rnd(seed);
+  FT x(rnd.get_double());
+  for(int i=0; i<50; ++i)
+    x = (x * 3 + FT(rnd.get_double())) / 7;
+  return x;
+}
+
+EK::FT exact_chain(const unsigned int seed)
+{
+  CGAL::Random rnd(seed);
+  EK::FT x(rnd.get_double());
+  for(int i=0; i<50; ++i)
+    x = (x * 3 + EK::FT(rnd.get_double())) / 7;
+  return x;
+}
+
+void test_scope()
+{
+  std::vector<FT> kept;
+  std::vector<Point_3> kept_points;
+  {
+    CGAL::Lazy_node_pool_scope scope;
+    for(unsigned int seed=0; seed<20; ++seed)
+    {
+      const FT x = chain(seed);
+      if(seed % 2 == 0)
+        kept.push_back(x);
+      else
+        assert(x.exact() == exact_chain(seed));
+    }
+
+    CGAL::Random rnd(0);
+    for(int i=0; i<100; ++i)
+    {
+      const Point_3 p(rnd.get_double(), rnd.get_double(), rnd.get_double());
+      const Point_3 q(rnd.get_double(), rnd.get_double(), rnd.get_double());
+      kept_points.push_back(CGAL::midpoint(p, q));
+      kept_points.push_back(p);
+      kept_points.push_back(q);
+    }
+  }
+
+  // the nodes created in the scope are still valid, their exact values can be computed
+  for(std::size_t i=0; i<kept.size(); ++i)
+    assert(kept[i].exact() == exact_chain(static_cast<unsigned int>(2 * i)));
+  for(std::size_t i=0; i<kept_points.size(); i+=3)
+    assert(CGAL::collinear(kept_points[i], kept_points[i + 1], kept_points[i + 2]) &&
+           CGAL::compare_distance_to_point(kept_points[i], kept_points[i + 1], kept_points[i + 2]) == CGAL::EQUAL);
+}
+
+// the nodes are created by some threads and released by others
+void test_threads()
+{
+#ifdef CGAL_HAS_THREADS
+  const int nb_threads = 4;
+  std::vector<std::vector<FT> > results(nb_threads);
+  std::vector<std::thread> threads;
+  for(int t=0; t<nb_threads; ++t)
+    threads.emplace_back([&results, t]()
+                         {
+                           CGAL::Lazy_node_pool_scope scope;
+                           for(unsigned int seed=0; seed<10; ++seed)
+                             results[t].push_back(chain(seed + 100 * t));
+                         });
+  for(std::thread& th : threads)
+    th.join();
+
+  threads.clear();
+  for(int t=0; t<nb_threads; ++t)
+    threads.emplace_back([&results, t]()
+                         {
+                           std::vector<FT> numbers;
+                           std::swap(numbers, results[(t + 1) % nb_threads]);
+                           for(std::size_t i=0; i<numbers.size(); ++i)
+                             assert(numbers[i].exact() ==
+                                    exact_chain(static_cast<unsigned int>(i + 100 * ((t + 1) % nb_threads))));
+                         });
+  for(std::thread& th : threads)
+    th.join();
+
+  CGAL::Lazy_node_pool::release_memory();
+#endif
+}
+
+int main()
+{
+  test_pool();
+  test_scope();
+  test_threads();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
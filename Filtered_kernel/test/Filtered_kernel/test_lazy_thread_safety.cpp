@@ -0,0 +1,166 @@
+// Several threads materialize the exact values of shared lazy nodes concurrently,
+// the results must be the ones obtained sequentially.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Random.h>
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#ifdef CGAL_HAS_THREADS
+#include <thread>
+#endif
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   K;
+typedef K::FT                                                FT;
+typedef K::Point_3                                           Point_3;
+
+const int nb_threads = 8;
+
+// a DAG of numbers where each node is shared by two parents
+std::vector<FT> number_dag(const unsigned int seed)
+{
+  const std::size_t width = 32, depth = 12;
+
+  CGAL::Random rnd(seed);
+  std::vector<FT> nodes;
+  for(std::size_t i=0; i<width; ++i)
+    nodes.push_back(FT(rnd.get_double(-1, 1)));
+
+  for(std::size_t d=1; d<depth; ++d)
+  {
+    const std::size_t first = nodes.size() - width;
+    for(std::size_t i=0; i<width; ++i)
+    {
+      const FT a = nodes[first + i], b = nodes[first + (i + 1) % width];
+      switch((d + i) % 4)
+      {
+        case 0: nodes.push_back(a + b); break;
+        case 1: nodes.push_back(a - b / 3); break;
+        case 2: nodes.push_back(a * 3 + b); break;
+        default: nodes.push_back((a - b) / 7); break;
+      }
+    }
+  }
+  return nodes;
+}
+
+// constructed points whose predicates cannot be decided by the interval filter
+std::vector<Point_3> point_dag(const unsigned int seed)
+{
+  CGAL::Random rnd(seed);
+  std::vector<Point_3> points;
+  for(int i=0; i<32; ++i)
+    points.emplace_back(rnd.get_double(), rnd.get_double(), rnd.get_double());
+
+  for(int i=0; i<32; ++i)
+  {
+    const Point_3 p = points[i], q = points[(i + 1) % 32];
+    const Point_3 m = CGAL::midpoint(p, q), b = CGAL::barycenter(p, 1, m, 2);
+    points.push_back(m);
+    points.push_back(b);
+    points.push_back(CGAL::midpoint(m, b));
+  }
+  return points;
+}
+
+#ifdef CGAL_HAS_THREADS
+template <typename Task>
+void run_concurrently(const Task& task)
+{
+  std::atomic<bool> go(false);
+  std::vector<std::thread> threads;
+  for(int t=0; t<nb_threads; ++t)
+    threads.emplace_back([&, t]()
+                         {
+                           while(!go.load())
+                             std::this_thread::yield();
+                           task(t);
+                         });
+  go = true;
+  for(std::thread& th : threads)
+    th.join();
+}
+#endif
+
+void test_numbers(const unsigned int seed)
+{
+  const std::vector<FT> reference = number_dag(seed);
+  std::vector<K::Exact_kernel::FT> exact_reference;
+  for(const FT& x : reference)
+    exact_reference.push_back(x.exact());
+
+  const std::vector<FT> nodes = number_dag(seed);
+  std::atomic<int> nb_errors(0);
+
+  auto task = [&](const int t)
+  {
+    // each thread visits the nodes in its own order, from the roots or from the leaves
+    const std::size_t n = nodes.size();
+    for(std::size_t k=0; k<n; ++k)
+    {
+      const std::size_t i = (t % 2 == 0) ? (k * (2 * t + 1) + t) % n : n - 1 - (k * (2 * t + 1) + t) % n;
+      if(nodes[i].exact() != exact_reference[i] || CGAL::to_double(nodes[i]) != CGAL::to_double(reference[i]))
+        ++nb_errors;
+    }
+  };
+
+#ifdef CGAL_HAS_THREADS
+  run_concurrently(task);
+#else
+  task(0);
+#endif
+
+  assert(nb_errors == 0);
+  for(std::size_t i=0; i<nodes.size(); ++i)
+    assert(nodes[i].approx().inf() == reference[i].approx().inf() &&
+           nodes[i].approx().sup() == reference[i].approx().sup());
+}
+
+void test_points(const unsigned int seed)
+{
+  const std::vector<Point_3> points = point_dag(seed);
+  std::atomic<int> nb_errors(0);
+
+  auto task = [&](const int t)
+  {
+    for(int k=0; k<32; ++k)
+    {
+      const int i = (k + 5 * t) % 32;
+      const Point_3& p = points[i];
+      const Point_3& q = points[(i + 1) % 32];
+      const Point_3& m = points[32 + 3 * i];
+      const Point_3& b = points[32 + 3 * i + 1];
+      const Point_3& mm = points[32 + 3 * i + 2];
+
+      if(!CGAL::collinear(p, q, m) || !CGAL::collinear(p, b, mm) || !CGAL::collinear(m, b, q))
+        ++nb_errors;
+      if(CGAL::compare_distance_to_point(m, p, q) != CGAL::EQUAL)
+        ++nb_errors;
+      if(K::Exact_kernel::Construct_midpoint_3()(p.exact(), q.exact()) != m.exact())
+        ++nb_errors;
+    }
+  };
+
+#ifdef CGAL_HAS_THREADS
+  run_concurrently(task);
+#else
+  task(0);
+#endif
+
+  assert(nb_errors == 0);
+}
+
+int main()
+{
+  for(unsigned int seed=0; seed<20; ++seed)
+  {
+    test_numbers(seed);
+    test_points(seed);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
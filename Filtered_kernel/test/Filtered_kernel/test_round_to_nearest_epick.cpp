@@ -0,0 +1,120 @@
+// The predicates of Round_to_nearest_epick must return the same results as the ones of Epick,
+// including when the filters fail or when the bounds of the intervals underflow or overflow.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Round_to_nearest_epick.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+typedef CGAL::Epick                                           Epick;
+typedef CGAL::Round_to_nearest_epick                          RN_epick;
+
+static_assert(std::is_same<RN_epick::Approximate_kernel::FT, CGAL::Interval_nt_round_to_nearest>::value, "");
+static_assert(std::is_same<Epick::Approximate_kernel::FT, CGAL::Interval_nt_advanced>::value, "");
+static_assert(!RN_epick::Protection && Epick::Protection, "");
+
+// random points, and points for which the filters fail
+std::vector<std::array<double, 3> > coordinates(CGAL::Random& rnd)
+{
+  std::vector<std::array<double, 3> > c;
+  for(int i=0; i<100; ++i)
+    c.push_back({ { rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1) } });
+  // on a grid: many collinear, coplanar and cospherical configurations
+  for(int i=0; i<100; ++i)
+    c.push_back({ { double(rnd.get_int(0, 3)), double(rnd.get_int(0, 3)), double(rnd.get_int(0, 3)) } });
+  // almost on a grid
+  for(int i=0; i<30; ++i)
+    c.push_back({ { rnd.get_int(0, 3) + 1e-16 * rnd.get_int(-2, 3), double(rnd.get_int(0, 3)), double(rnd.get_int(0, 3)) } });
+  // underflow and overflow of the bounds
+  for(int i=0; i<10; ++i)
+    c.push_back({ { 1e-100 * rnd.get_double(), 1e-160 * rnd.get_double(), rnd.get_double() } });
+  for(int i=0; i<10; ++i)
+    c.push_back({ { 1e120 * rnd.get_double(), 1e-120 * rnd.get_double(), rnd.get_double() } });
+  return c;
+}
+
+template <typename K>
+std::vector<int> evaluate(const std::vector<std::array<double, 3> >& c, const std::vector<int>& indices)
+{
+  typedef typename K::Point_2                                 Point_2;
+  typedef typename K::Point_3                                 Point_3;
+
+  std::vector<Point_2> p2;
+  std::vector<Point_3> p3;
+  for(const auto& x : c)
+  {
+    p2.emplace_back(x[0], x[1]);
+    p3.emplace_back(x[0], x[1], x[2]);
+  }
+
+  std::vector<int> results;
+  for(std::size_t i=0; i+5<=indices.size(); i+=5)
+  {
+    const int a = indices[i], b = indices[i+1], cc = indices[i+2], d = indices[i+3], e = indices[i+4];
+    results.push_back(CGAL::orientation(p2[a], p2[b], p2[cc]));
+    results.push_back(CGAL::side_of_oriented_circle(p2[a], p2[b], p2[cc], p2[d]));
+    results.push_back(CGAL::compare_xy(p2[a], p2[b]));
+    results.push_back(CGAL::orientation(p3[a], p3[b], p3[cc], p3[d]));
+    results.push_back(CGAL::side_of_oriented_sphere(p3[a], p3[b], p3[cc], p3[d], p3[e]));
+    results.push_back(CGAL::compare_distance_to_point(p3[a], p3[b], p3[cc]));
+    results.push_back(CGAL::angle(p3[a], p3[b], p3[cc]));
+    const bool collinear = CGAL::collinear(p3[a], p3[b], p3[cc]);
+    results.push_back(collinear);
+    if(collinear)
+      continue;
+    results.push_back(CGAL::coplanar_orientation(p3[a], p3[b], p3[cc], p3[d]));
+    if(p3[d] != p3[e])
+      results.push_back(CGAL::do_intersect(typename K::Triangle_3(p3[a], p3[b], p3[cc]),
+                                           typename K::Segment_3(p3[d], p3[e])));
+  }
+  return results;
+}
+
+template <typename K>
+std::size_t triangulate(const std::vector<std::array<double, 3> >& c)
+{
+  CGAL::Delaunay_triangulation_2<K> t2;
+  CGAL::Delaunay_triangulation_3<K> t3;
+  for(const auto& x : c)
+  {
+    t2.insert(typename K::Point_2(x[0], x[1]));
+    t3.insert(typename K::Point_3(x[0], x[1], x[2]));
+  }
+  assert(t2.is_valid());
+  assert(t3.is_valid());
+  return t2.number_of_faces() + t3.number_of_finite_cells();
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  const std::vector<std::array<double, 3> > c = coordinates(rnd);
+  const int n = static_cast<int>(c.size());
+
+  // the points of a query are taken in the same family most of the time
+  const int families[4][2] = { { 0, 100 }, { 100, 100 }, { 100, 130 }, { 230, 20 } };
+  std::vector<int> indices;
+  for(int i=0; i<20000; ++i)
+  {
+    const int family = rnd.get_int(0, 4);
+    for(int j=0; j<5; ++j)
+      indices.push_back(rnd.get_int(0, 10) == 0 ? rnd.get_int(0, n) : families[family][0] + rnd.get_int(0, families[family][1]));
+  }
+
+  assert(evaluate<RN_epick>(c, indices) == evaluate<Epick>(c, indices));
+  assert(CGAL::FPU_get_cw() == CGAL_FE_TONEAREST);
+
+  const std::size_t nb_simplices = triangulate<RN_epick>(c);
+  assert(nb_simplices == triangulate<Epick>(c));
+
+  std::cout << nb_simplices << " simplices" << std::endl;
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
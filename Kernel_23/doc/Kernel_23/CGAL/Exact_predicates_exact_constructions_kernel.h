@@ -14,6 +14,9 @@ coordinates.
 constructions.
 </UL>
 
+The nodes of the expression DAGs of the lazy constructions are allocated with `CGAL::Lazy_node_pool`
+instead of the global `operator new` if the macro `CGAL_LAZY_KERNEL_USE_NODE_POOL` is defined.
+
 \cgalModels{Kernel}
 
 \sa `CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt`
@@ -21,6 +24,7 @@ constructions.
 \sa `CGAL::Exact_predicates_exact_constructions_kernel_with_root_of`
 \sa `CGAL::Exact_predicates_inexact_constructions_kernel`
 \sa `CGAL::Cartesian`
+\sa `CGAL::Lazy_node_pool`
 
 */
 
@@ -0,0 +1,62 @@
+namespace CGAL {
+
+/*!
+\ingroup kernel_classes
+
+The class `Lazy_node_pool` is a thread-safe pool of small blocks of memory.
+When the macro `CGAL_LAZY_KERNEL_USE_NODE_POOL` is defined, it is used to allocate
+the nodes of the expression DAGs of the lazy kernels (such as
+`CGAL::Exact_predicates_exact_constructions_kernel`) and of `CGAL::Lazy_exact_nt`,
+as well as their exact values, instead of the global `operator new`.
+
+Each thread allocates and releases blocks in its own cache without synchronization,
+the caches exchanging blocks with a depot shared by all threads, which obtains
+the memory from the system by large chunks. Nodes can thus be released by any thread.
+
+The memory of the pool is given back to the system only by `release_memory()`,
+for example at the end of the scope of a `CGAL::Lazy_node_pool_scope`.
+
+Another allocator can be used by defining the macro `CGAL_LAZY_NODE_ALLOCATOR` to the name of
+a class providing the same static functions `allocate()` and `deallocate()`.
+These macros must be defined in the same way in all the translation units of a program.
+
+\sa `CGAL::Lazy_node_pool_scope`
+*/
+class Lazy_node_pool {
+public:
+
+/// returns a block of at least `n` bytes, aligned as `std::max_align_t`.
+static void* allocate(std::size_t n);
+
+/// releases a block returned by `allocate(n)`, possibly in another thread.
+static void deallocate(void* p, std::size_t n);
+
+/*!
+gives back to the system the chunks of memory of which all the blocks are free
+and held either by the calling thread or by the shared depot.
+Nodes that are still alive are not affected.
+*/
+static void release_memory();
+
+/// returns the number of bytes currently obtained from the system by the pool.
+static std::size_t memory_size();
+
+}; /* end Lazy_node_pool */
+
+/*!
+\ingroup kernel_classes
+
+An object of the class `Lazy_node_pool_scope` calls `Lazy_node_pool::release_memory()`
+when it is destroyed, so that the memory of the nodes of the lazy kernel released during
+a computation is given back to the system at the end of the scope.
+The nodes that outlive the scope remain valid.
+
+\sa `CGAL::Lazy_node_pool`
+*/
+class Lazy_node_pool_scope {
+public:
+  Lazy_node_pool_scope();
+  ~Lazy_node_pool_scope();
+}; /* end Lazy_node_pool_scope */
+
+} /* end namespace CGAL */
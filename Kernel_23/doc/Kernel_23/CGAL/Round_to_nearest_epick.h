@@ -0,0 +1,27 @@
+
+namespace CGAL {
+
+/*!
+\ingroup kernel_predef
+
+A kernel that has the same properties as `CGAL::Exact_predicates_inexact_constructions_kernel`,
+but whose filtered predicates use `CGAL::Interval_nt_round_to_nearest` instead of
+`CGAL::Interval_nt_advanced` for their interval arithmetic stage. The rounding mode of the
+processor is then never changed by the predicates, which avoids the cost of the switches of
+rounding mode when most predicates are decided by the filters, at the expense of more
+expensive interval operations when the static filters fail, for example on degenerate inputs.
+
+The predicates return the same results as the ones of `CGAL::Exact_predicates_inexact_constructions_kernel`.
+
+\cgalModels{Kernel}
+
+\sa `CGAL::Exact_predicates_inexact_constructions_kernel`
+\sa `CGAL::Interval_nt_round_to_nearest`
+
+*/
+class Round_to_nearest_epick {
+public:
+
+}; /* end Round_to_nearest_epick */
+
+} /* end namespace CGAL */
@@ -0,0 +1,63 @@
+namespace CGAL {
+
+/// \defgroup batched_orientation_grp CGAL::batched_orientation()
+/// \ingroup kernel_global_function
+/// \sa `orientation_grp`
+/// \sa `batched_side_of_oriented_sphere_grp`
+/// @{
+
+/*!
+computes the orientation of each quadruple of points of the range `[first, beyond)`,
+as `CGAL::orientation()` would, and writes the results in `out`, in the same order.
+
+When the predicates of `K` are filtered (for example with
+`CGAL::Exact_predicates_inexact_constructions_kernel`
+or `CGAL::Exact_predicates_exact_constructions_kernel`), the semi-static filter
+of `Orientation_3` is evaluated on blocks of quadruples using the SIMD instructions
+enabled at compile time (AVX-512, AVX, or SSE2), and the predicate of the kernel
+is only called for the quadruples that the filter cannot decide.
+The results are the same as with `CGAL::orientation()`.
+
+\tparam ForwardIterator a model of `ForwardIterator` whose value type `Q` is such that
+`std::get<i>(q)`, for `i` from `0` to `3`, is a `K::Point_3`,
+for example `std::array<K::Point_3, 4>` or `std::tuple<K::Point_3, K::Point_3, K::Point_3, K::Point_3>`.
+\tparam OutputIterator a model of `OutputIterator` accepting values of type `CGAL::Orientation`.
+
+If `k` is not provided, the kernel is deduced from the type of the points with `CGAL::Kernel_traits`.
+
+\returns the output iterator past the last result written.
+*/
+template <typename ForwardIterator, typename OutputIterator, typename K>
+OutputIterator batched_orientation(ForwardIterator first, ForwardIterator beyond,
+                                   OutputIterator out, const K& k = K());
+
+/// @}
+
+/// \defgroup batched_side_of_oriented_sphere_grp CGAL::batched_side_of_oriented_sphere()
+/// \ingroup kernel_global_function
+/// \sa `side_of_oriented_sphere_grp`
+/// \sa `batched_orientation_grp`
+/// @{
+
+/*!
+computes the side of the oriented sphere of each quintuple of points `(p, q, r, s, t)`
+of the range `[first, beyond)`, as `CGAL::side_of_oriented_sphere(p, q, r, s, t)` would,
+and writes the results in `out`, in the same order.
+The semi-static filter of `Side_of_oriented_sphere_3` is evaluated on blocks
+of quintuples as in `CGAL::batched_orientation()`.
+
+\tparam ForwardIterator a model of `ForwardIterator` whose value type `Q` is such that
+`std::get<i>(q)`, for `i` from `0` to `4`, is a `K::Point_3`.
+\tparam OutputIterator a model of `OutputIterator` accepting values of type `CGAL::Oriented_side`.
+
+If `k` is not provided, the kernel is deduced from the type of the points with `CGAL::Kernel_traits`.
+
+\returns the output iterator past the last result written.
+*/
+template <typename ForwardIterator, typename OutputIterator, typename K>
+OutputIterator batched_side_of_oriented_sphere(ForwardIterator first, ForwardIterator beyond,
+                                               OutputIterator out, const K& k = K());
+
+/// @}
+
+} // namespace CGAL
@@ -0,0 +1,42 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_ROUND_TO_NEAREST_EPICK_H
+#define CGAL_ROUND_TO_NEAREST_EPICK_H
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Interval_nt_round_to_nearest.h>
+
+namespace CGAL {
+
+class Round_to_nearest_epick;
+
+template <>
+struct Filtered_kernel_interval_selector<Round_to_nearest_epick> {
+  typedef Interval_nt_round_to_nearest Type;
+};
+
+// This kernel is Epick with the difference that the interval arithmetic of its
+// filtered predicates works in the default rounding mode, round-to-nearest,
+// instead of changing it to round-towards-infinity around each predicate.
+class Round_to_nearest_epick
+    : public internal::Epick_with_filtered_predicates<double, Round_to_nearest_epick>
+{};
+
+template <>
+struct Triangulation_structural_filtering_traits<Round_to_nearest_epick> {
+  using Use_structural_filtering_tag = Tag_true;
+};
+
+} //namespace CGAL
+
+#endif // CGAL_ROUND_TO_NEAREST_EPICK_H
@@ -0,0 +1,125 @@
+
+namespace CGAL {
+
+/*!
+\ingroup nt_cgal
+
+The class `Interval_nt_round_to_nearest` provides an interval arithmetic number type,
+with the same interface as `Interval_nt`, whose operations work in the default
+rounding mode, round-to-nearest.
+
+Instead of relying on the directed rounding modes of the processor, the bounds of
+the results of the operations +, -, \f$ *\f$, \f$ /\f$ and \f$ \sqrt{}\f$ are
+computed in round-to-nearest, and the error of each of them is computed exactly
+with error-free transformations (TwoSum, and the fused multiply-add instruction
+when it is enabled at compile time, or Dekker's product otherwise).
+A bound is then moved to the next floating-point number only when the exact
+value lies outside of it, so that the bounds are the same as the ones computed by
+`Interval_nt` with the rounding mode towards infinity, except close to the underflow
+and overflow thresholds, where the error cannot be computed exactly and the
+bounds are conservatively enlarged.
+
+Since no rounding mode change is needed, the type `Protector` does nothing,
+and this number type can be used in code that cannot, or must not, change the
+rounding mode of the processor. On the other hand, each operation is several times
+more expensive than with `Interval_nt_advanced`.
+
+\cgalModels{FieldWithSqrt,RealEmbeddable}
+
+\sa `CGAL::Interval_nt<Protected>`
+\sa `CGAL::Round_to_nearest_epick`
+
+*/
+class Interval_nt_round_to_nearest {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+The type of the bounds of the interval.
+*/
+typedef double value_type;
+
+/*!
+The type of the
+exceptions raised when uncertain comparisons are performed.
+*/
+typedef Uncertain_conversion_exception unsafe_comparison;
+
+/*!
+It is implemented as `Protect_FPU_rounding<false>`, that is, it does nothing.
+*/
+typedef unspecified_type Protector;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+introduces a small interval containing `i`, possibly a point if `i` is exactly representable by a `double`.
+*/
+Interval_nt_round_to_nearest(int i);
+
+/*!
+introduces a point interval.
+*/
+Interval_nt_round_to_nearest(double d);
+
+/*!
+introduces the interval [`i`;`s`].
+*/
+Interval_nt_round_to_nearest(double i, double s);
+
+/*!
+introduces the interval [`p.first`;`p.second`].
+*/
+Interval_nt_round_to_nearest(std::pair<double, double> p);
+
+/// @}
+
+/// \name Operations
+/// All functions of `Interval_nt` are provided, with the same semantics.
+/// @{
+
+/*!
+returns the lower bound of the interval.
+*/
+double inf() const;
+
+/*!
+returns the upper bound of the interval.
+*/
+double sup() const;
+
+/*!
+returns whether both intervals have the same bounds.
+*/
+bool is_same(Interval_nt_round_to_nearest i) const;
+
+/*!
+returns whether both intervals have a non empty intersection.
+*/
+bool do_overlap(Interval_nt_round_to_nearest i) const;
+
+/*!
+returns whether the interval is reduced to a single value.
+*/
+bool is_point() const;
+
+/*!
+returns the interval [-inf;+inf].
+*/
+static Interval_nt_round_to_nearest largest();
+
+/*!
+returns the interval [-denorm_min;+denorm_min].
+*/
+static Interval_nt_round_to_nearest smallest();
+
+/// @}
+
+}; /* end Interval_nt_round_to_nearest */
+
+} /* end namespace CGAL */
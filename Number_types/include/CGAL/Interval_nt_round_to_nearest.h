@@ -0,0 +1,992 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_INTERVAL_NT_ROUND_TO_NEAREST_H
+#define CGAL_INTERVAL_NT_ROUND_TO_NEAREST_H
+
+// This file contains the description of the class Interval_nt_round_to_nearest,
+// an interval number type that works with the default rounding mode of the FPU
+// (to nearest), so that it does not need to be protected by Protect_FPU_rounding.
+//
+// The bounds are rounded outward exactly as with Interval_nt in round-upward
+// mode: each bound is computed in round-to-nearest, and the error of the
+// operation, obtained with an error-free transformation (TwoSum, or an FMA /
+// Dekker's product for *, / and sqrt), tells whether it must be moved to the
+// next double. When the error cannot be represented (underflow), the bound is
+// moved to the next double unconditionally, which is still a valid enclosure.
+//
+// As for Interval_nt, the lower bound is stored negated, so that both bounds
+// are computed with the rounding upward functions below.
+
+#include <CGAL/number_type_config.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/utils_classes.h>
+#include <CGAL/Uncertain.h>
+#include <CGAL/double.h>
+#include <CGAL/FPU.h>
+#include <CGAL/IO/io.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <utility>
+
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA) || (defined(_MSC_VER) && defined(__AVX2__))
+#  define CGAL_IA_ROUND_TO_NEAREST_HAS_FMA 1
+#endif
+
+namespace CGAL {
+namespace internal {
+
+// The smallest double larger than `d`, for `d` finite or -infinity.
+inline double IA_rn_next_up(double d)
+{
+  if(d == 0)
+    return std::numeric_limits<double>::denorm_min();
+  std::uint64_t u;
+  std::memcpy(&u, &d, sizeof(double));
+  u = (d > 0) ? u + 1 : u - 1;
+  std::memcpy(&d, &u, sizeof(double));
+  return d;
+}
+
+// Below this magnitude, the error of a product may not be representable.
+const double IA_rn_min_exact_product = 2.0041683600089728e-292; // 2^-968
+// Above this magnitude, the square of the rounded square root may overflow.
+const double IA_rn_max_exact_sqrt = 1e307;
+#ifndef CGAL_IA_ROUND_TO_NEAREST_HAS_FMA
+// Above this magnitude, the splitting of Dekker's product overflows.
+const double IA_rn_max_split = 4.0e298; // < 2^995
+// Above this magnitude, the product of the high parts may overflow.
+const double IA_rn_max_dekker_product = 1e307;
+#endif
+
+// `r` is the rounded to nearest value of an operation, whose exact value is larger
+// than `r` iff `error_is_positive`. Returns the exact value rounded towards +infinity.
+#ifdef CGAL_FPU_HAS_EXCESS_PRECISION
+// The errors are not exact with the excess precision of the FPU, but the error
+// of `r`, once forced to double, is less than one ulp.
+inline double IA_rn_round_up(double r, bool /* error_is_positive */)
+{
+  r = CGAL_IA_FORCE_TO_DOUBLE(r);
+  return (r == std::numeric_limits<double>::infinity()) ? r : IA_rn_next_up(r);
+}
+#else
+inline double IA_rn_round_up(double r, bool error_is_positive)
+{
+  return error_is_positive ? IA_rn_next_up(r) : r;
+}
+#endif
+
+// a + b rounded to nearest, and the exact error e = (a + b) - s (TwoSum),
+// assuming s is finite.
+inline double IA_rn_two_sum(double a, double b, double& e)
+{
+  const double s = a + b;
+  const double bb = s - a;
+  e = (a - (s - bb)) + (b - bb);
+  return s;
+}
+
+// a + b rounded towards +infinity.
+inline double IA_rn_add_up(double a, double b)
+{
+  double e;
+  const double s = IA_rn_two_sum(a, b, e);
+  if(s == -std::numeric_limits<double>::infinity())
+    return (std::isfinite(a) && std::isfinite(b)) ? -(std::numeric_limits<double>::max)() : s;
+  return IA_rn_round_up(s, e > 0);
+}
+
+// Conservative version, when the error of the product cannot be computed.
+inline double IA_rn_mul_up_unsafe(double a, double b, double p)
+{
+  if(a == 0 || b == 0 || p == std::numeric_limits<double>::infinity())
+    return p;
+  if(p == -std::numeric_limits<double>::infinity())
+    return (std::isfinite(a) && std::isfinite(b)) ? -(std::numeric_limits<double>::max)() : p;
+  return IA_rn_next_up(p);
+}
+
+#ifndef CGAL_IA_ROUND_TO_NEAREST_HAS_FMA
+inline void IA_rn_split(double a, double& hi, double& lo)
+{
+  const double c = 134217729. * a; // 2^27 + 1
+  hi = c - (c - a);
+  lo = a - hi;
+}
+
+// The error a * b - p of the rounded value `p` of a * b, computed exactly with
+// Dekker's product, assuming no overflow nor underflow.
+inline double IA_rn_dekker_error(double a, double b, double p)
+{
+  double ah, al, bh, bl;
+  IA_rn_split(a, ah, al);
+  IA_rn_split(b, bh, bl);
+  return ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+}
+#endif
+
+// The error a * b - p of the rounded value `p` of a * b, if the product is safe.
+inline double IA_rn_product_error(double a, double b, double p)
+{
+#ifdef CGAL_IA_ROUND_TO_NEAREST_HAS_FMA
+  return std::fma(a, b, -p);
+#else
+  return IA_rn_dekker_error(a, b, p);
+#endif
+}
+
+// Whether the error of the product a * b can be computed.
+inline bool IA_rn_product_is_safe(double a, double b, double p)
+{
+#ifdef CGAL_IA_ROUND_TO_NEAREST_HAS_FMA
+  CGAL_USE(a); CGAL_USE(b);
+  return std::fabs(p) >= IA_rn_min_exact_product && std::fabs(p) <= (std::numeric_limits<double>::max)();
+#else
+  return std::fabs(p) >= IA_rn_min_exact_product && std::fabs(p) <= IA_rn_max_dekker_product &&
+         std::fabs(a) <= IA_rn_max_split && std::fabs(b) <= IA_rn_max_split;
+#endif
+}
+
+// a * b rounded towards +infinity.
+inline double IA_rn_mul_up(double a, double b)
+{
+  const double p = a * b;
+  if(!IA_rn_product_is_safe(a, b, p))
+    return IA_rn_mul_up_unsafe(a, b, p);
+  return IA_rn_round_up(p, IA_rn_product_error(a, b, p) > 0);
+}
+
+// a / b rounded towards +infinity.
+inline double IA_rn_div_up(double a, double b)
+{
+  const double q = a / b;
+  if(a == 0 || !std::isfinite(a) || !std::isfinite(b) || q == std::numeric_limits<double>::infinity())
+    return q;
+  if(q == -std::numeric_limits<double>::infinity())
+    return -(std::numeric_limits<double>::max)();
+  // a - q * b has the sign of the error times the sign of b.
+  if(!IA_rn_product_is_safe(q, b, a) || std::fabs(q) < IA_rn_min_exact_product)
+    return IA_rn_next_up(q);
+#ifdef CGAL_IA_ROUND_TO_NEAREST_HAS_FMA
+  const double r = std::fma(-q, b, a);
+  return IA_rn_round_up(q, (b > 0) ? (r > 0) : (r < 0));
+#else
+  // a - q * b = (a - ph) - pl, where a - ph is exact
+  double qh, ql, bh, bl;
+  IA_rn_split(q, qh, ql);
+  IA_rn_split(b, bh, bl);
+  const double ph = q * b;
+  if(!std::isfinite(ph))
+    return IA_rn_next_up(q);
+  const double pl = ((qh * bh - ph) + qh * bl + ql * bh) + ql * bl;
+  const double d = a - ph;
+  return IA_rn_round_up(q, (b > 0) ? (d > pl) : (d < pl));
+#endif
+}
+
+// Whether sqrt(a) is exactly larger (1), smaller (-1) or equal (0) to its rounded value `s`.
+inline int IA_rn_sqrt_error_sign(double a, double s)
+{
+#ifdef CGAL_IA_ROUND_TO_NEAREST_HAS_FMA
+  const double r = std::fma(-s, s, a);
+  return (r > 0) - (r < 0);
+#else
+  double sh, sl;
+  IA_rn_split(s, sh, sl);
+  const double ph = s * s;
+  const double pl = ((sh * sh - ph) + 2 * (sh * sl)) + sl * sl;
+  const double d = a - ph;
+  return (d > pl) - (d < pl);
+#endif
+}
+
+// sqrt(a) rounded towards +infinity, for a >= 0.
+inline double IA_rn_sqrt_up(double a)
+{
+  const double s = std::sqrt(a);
+  if(a == 0 || !std::isfinite(a))
+    return s;
+  if(a < IA_rn_min_exact_product || a > IA_rn_max_exact_sqrt)
+    return IA_rn_next_up(s);
+  return IA_rn_round_up(s, IA_rn_sqrt_error_sign(a, s) > 0);
+}
+
+// sqrt(a) rounded towards 0, for a >= 0.
+inline double IA_rn_sqrt_down(double a)
+{
+  const double s = std::sqrt(a);
+  if(a == 0 || !std::isfinite(a))
+    return s;
+  if(a < IA_rn_min_exact_product || a > IA_rn_max_exact_sqrt)
+    return -IA_rn_next_up(-s);
+  return -IA_rn_round_up(-s, IA_rn_sqrt_error_sign(a, s) < 0);
+}
+
+} // namespace internal
+
+class Interval_nt_round_to_nearest
+{
+  typedef Interval_nt_round_to_nearest   IA;
+  typedef std::pair<double, double>      Pair;
+
+public:
+
+  typedef double      value_type;
+
+  typedef Uncertain_conversion_exception            unsafe_comparison;
+  // The rounding mode does not need to be changed.
+  typedef Protect_FPU_rounding<false>               Protector;
+
+  Interval_nt_round_to_nearest()
+#ifndef CGAL_NO_ASSERTIONS
+    : _inf(-1), _sup(0) // to early and deterministically detect use of uninitialized
+#endif
+  {}
+
+  Interval_nt_round_to_nearest(int i)
+  { *this = static_cast<double>(i); }
+
+  Interval_nt_round_to_nearest(unsigned i)
+  { *this = static_cast<double>(i); }
+
+  Interval_nt_round_to_nearest(long long i)
+  {
+    const double d = CGAL_IA_FORCE_TO_DOUBLE(static_cast<double>(i));
+    *this = d;
+    const long long safe = 1LL << 52;
+    // d may be 2^63, which does not fit in a long long
+    const bool exact = (i <= safe && i >= -safe) || (d < 9223372036854775808. && (long long)d == i);
+    if(!exact)
+      *this += smallest();
+  }
+
+  Interval_nt_round_to_nearest(unsigned long long i)
+  {
+    const double d = CGAL_IA_FORCE_TO_DOUBLE(static_cast<double>(i));
+    *this = d;
+    const unsigned long long safe = 1ULL << 52;
+    // d may be 2^64, which does not fit in an unsigned long long
+    const bool exact = (i <= safe) || (d < 18446744073709551616. && (unsigned long long)d == i);
+    if(!exact)
+      *this += smallest();
+  }
+
+  Interval_nt_round_to_nearest(long i)
+  {
+    *this = (sizeof(int)==sizeof(long)) ?
+      IA((int)i) :
+      IA((long long)i);
+  }
+
+  Interval_nt_round_to_nearest(unsigned long i)
+  {
+    *this = (sizeof(int)==sizeof(long)) ?
+      IA((unsigned)i) :
+      IA((unsigned long long)i);
+  }
+
+  Interval_nt_round_to_nearest(double d)
+  {
+    CGAL_assertion(is_finite(d));
+    *this = IA(d, d);
+  }
+
+  Interval_nt_round_to_nearest(double i, double s)
+    : _inf(-i), _sup(s)
+  {
+    CGAL_assertion_msg( (!is_valid(i)) || (!is_valid(s)) || (!(i>s)),
+              " Variable used before being initialized (or CGAL bug)");
+  }
+
+  Interval_nt_round_to_nearest(const Pair & p)
+  { *this = IA(p.first, p.second); }
+
+  IA operator-() const
+  {
+    return IA(-sup(), -inf());
+  }
+
+  IA & operator+= (const IA &d) { return *this = *this + d; }
+  IA & operator-= (const IA &d) { return *this = *this - d; }
+  IA & operator*= (const IA &d) { return *this = *this * d; }
+  IA & operator/= (const IA &d) { return *this = *this / d; }
+
+  bool is_point() const
+  {
+    return sup() == inf();
+  }
+
+  bool is_same (const IA & d) const
+  {
+    return inf() == d.inf() && sup() == d.sup();
+  }
+
+  bool do_overlap (const IA & d) const
+  {
+    return !(d.inf() > sup() || d.sup() < inf());
+  }
+
+  double inf() const { return -_inf; }
+  double sup() const { return _sup; }
+
+  std::pair<double, double> pair() const
+  {
+    return std::pair<double, double>(inf(), sup());
+  }
+
+  static IA largest()
+  {
+    return IA(-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+  }
+
+  static IA smallest()
+  {
+    return IA(-CGAL_IA_MIN_DOUBLE, CGAL_IA_MIN_DOUBLE);
+  }
+
+private:
+  // The value stored in _inf is the negated lower bound.
+  double _inf, _sup;
+
+  // Builds the interval from the negated lower bound and the upper bound.
+  struct negated_inf_t {};
+  Interval_nt_round_to_nearest(negated_inf_t, double mi, double s)
+    : _inf(mi), _sup(s)
+  {}
+
+  static IA from_negated_inf(double mi, double s)
+  {
+    return IA(negated_inf_t(), mi, s);
+  }
+
+  // The interval of the exact value r + e, where `r` is finite, and non-zero if `e` is not.
+  static IA from_rounded(double r, double e)
+  {
+    return from_negated_inf(internal::IA_rn_round_up(-r, e < 0), internal::IA_rn_round_up(r, e > 0));
+  }
+
+  friend
+    Uncertain<bool>
+    operator<(const IA &a, const IA &b)
+    {
+      if (a.sup()  < b.inf()) return true;
+      if (a.inf() >= b.sup()) return false;
+      return Uncertain<bool>::indeterminate();
+    }
+
+  friend
+    Uncertain<bool>
+    operator>(const IA &a, const IA &b)
+    { return b < a; }
+
+  friend
+    Uncertain<bool>
+    operator<=(const IA &a, const IA &b)
+    {
+      if (a.sup() <= b.inf()) return true;
+      if (a.inf() >  b.sup()) return false;
+      return Uncertain<bool>::indeterminate();
+    }
+
+  friend
+    Uncertain<bool>
+    operator>=(const IA &a, const IA &b)
+    { return b <= a; }
+
+  friend
+    Uncertain<bool>
+    operator==(const IA &a, const IA &b)
+    {
+      if (b.inf() >  a.sup() || b.sup() <  a.inf()) return false;
+      if (b.inf() == a.sup() && b.sup() == a.inf()) return true;
+      return Uncertain<bool>::indeterminate();
+    }
+
+  friend
+    Uncertain<bool>
+    operator!=(const IA &a, const IA &b)
+    { return ! (a == b); }
+
+  friend
+    std::ostream & operator<< (std::ostream &os, const IA & I )
+    {
+      return os << "[" << I.inf() << ";" << I.sup() << "]";
+    }
+
+#define CGAL_SWALLOW(IS,CHAR)                    \
+  {                                              \
+    char c;                                      \
+    do is.get(c); while (isspace(c));            \
+    if (c != CHAR) {                             \
+      is.setstate(std::ios_base::failbit);       \
+    }                                            \
+  }                                              \
+
+  friend
+    std::istream & operator>> (std::istream &is, IA & I)
+    {
+      char c;
+      do is.get(c); while (isspace(c));
+      is.putback(c);
+      if(c == '['){ // read original output from operator <<
+        double inf,sup;
+        CGAL_SWALLOW(is, '[');// read the "["
+        is >> IO::iformat(inf);
+        CGAL_SWALLOW(is, ';');// read the ";"
+        is >> IO::iformat(sup);
+        CGAL_SWALLOW(is, ']');// read the "]"
+        I = IA(inf,sup);
+      }else{ //read double (backward compatibility)
+        double d;
+        is >> d;
+        I = d;
+      }
+      return is;
+    }
+#undef CGAL_SWALLOW
+
+  friend
+    IA
+    operator+ (const IA &a, const IA & b)
+    {
+      // A single TwoSum gives both bounds, which is frequent when the filters fail.
+      if (a.is_point() && b.is_point())
+      {
+        double e;
+        const double s = internal::IA_rn_two_sum(a._sup, b._sup, e);
+        if (std::isfinite(s))
+          return from_rounded(s, e);
+      }
+      return from_negated_inf(internal::IA_rn_add_up(a._inf, b._inf),
+                              internal::IA_rn_add_up(a._sup, b._sup));
+    }
+
+  friend
+    IA
+    operator+( const IA& a ) {
+      return a;
+    }
+
+  friend
+    IA
+    operator- (const IA &a, const IA & b)
+    {
+      if (a.is_point() && b.is_point())
+      {
+        double e;
+        const double s = internal::IA_rn_two_sum(a._sup, -b._sup, e);
+        if (std::isfinite(s))
+          return from_rounded(s, e);
+      }
+      return from_negated_inf(internal::IA_rn_add_up(a._inf, b._sup),
+                              internal::IA_rn_add_up(a._sup, b._inf));
+    }
+
+  // Same case analysis as the scalar version of Interval_nt.
+  friend
+    IA
+    operator* (const IA &a, const IA & b)
+    {
+      using internal::IA_rn_mul_up;
+      if (a.is_point() && b.is_point())
+      {
+        const double p = a._sup * b._sup;
+        if (internal::IA_rn_product_is_safe(a._sup, b._sup, p))
+          return from_rounded(p, internal::IA_rn_product_error(a._sup, b._sup, p));
+      }
+      if (a.inf() >= 0.0)                                   // a>=0
+      {
+        double aa = a.inf(), bb = a.sup();
+        if (bb <= 0.) return 0.; // In case b has an infinite bound, avoid NaN.
+        if (b.inf() < 0.0)
+        {
+          aa = bb;
+          if (b.sup() < 0.0)
+            bb = a.inf();
+        }
+        double r = (b.sup() == 0) ? 0. : IA_rn_mul_up(bb, b.sup()); // In case bb is infinite, avoid NaN.
+        return from_negated_inf(IA_rn_mul_up(aa, -b.inf()), r);
+      }
+      else if (a.sup()<=0.0)                                // a<=0
+      {
+        double aa = a.sup(), bb = a.inf();
+        if (b.inf() < 0.0)
+        {
+          aa=bb;
+          if (b.sup() <= 0.0)
+            bb=a.sup();
+        }
+        else if (b.sup() <= 0) return 0.; // In case a has an infinite bound, avoid NaN.
+        return from_negated_inf(IA_rn_mul_up(-bb, b.sup()), IA_rn_mul_up(-aa, -b.inf()));
+      }
+      else                                                  // 0 \in a
+      {
+        if (b.inf()>=0.0) {                                 // b>=0
+          if (b.sup()<=0.0)
+            return 0.; // In case a has an infinite bound, avoid NaN.
+          else
+            return from_negated_inf(IA_rn_mul_up(-a.inf(), b.sup()),
+                                    IA_rn_mul_up( a.sup(), b.sup()));
+        }
+        if (b.sup()<=0.0) {                                 // b<=0
+          return from_negated_inf(IA_rn_mul_up( a.sup(), -b.inf()),
+                                  IA_rn_mul_up(-a.inf(), -b.inf()));
+        }
+        // 0 \in b
+        double tmp1 = IA_rn_mul_up(-a.inf(),  b.sup());
+        double tmp2 = IA_rn_mul_up( a.sup(), -b.inf());
+        double tmp3 = IA_rn_mul_up(-a.inf(), -b.inf());
+        double tmp4 = IA_rn_mul_up( a.sup(),  b.sup());
+        return from_negated_inf((std::max)(tmp1,tmp2), (std::max)(tmp3,tmp4));
+      }
+    }
+
+  friend
+    IA
+    operator* (double a, IA b)
+    {
+      CGAL_assertion(is_finite(a));
+      if (a < 0) { a = -a; b = -b; }
+      else if (!(a > 0)) return 0.;
+      return from_negated_inf(internal::IA_rn_mul_up(a, b._inf), internal::IA_rn_mul_up(a, b._sup));
+    }
+
+  friend
+    IA
+    operator* (const IA & a, double b)
+    {
+      return b * a;
+    }
+
+  friend
+    IA
+    operator/ (const IA &a, const IA & b)
+    {
+      using internal::IA_rn_div_up;
+      if (b.inf() > 0.0)                                // b>0
+      {
+        double aa = b.sup(), bb = b.inf();
+        if (a.inf() < 0.0)
+        {
+          aa = bb;
+          if (a.sup() < 0.0)
+            bb = b.sup();
+        }
+        return from_negated_inf(IA_rn_div_up(-a.inf(), aa), IA_rn_div_up(a.sup(), bb));
+      }
+      else if (b.sup()<0.0)                             // b<0
+      {
+        double aa = b.sup(), bb = b.inf();
+        if (a.inf() < 0.0)
+        {
+          bb = aa;
+          if (a.sup() < 0.0)
+            aa = b.inf();
+        }
+        return from_negated_inf(IA_rn_div_up(a.sup(), -aa), IA_rn_div_up(a.inf(), bb));
+      }
+      else                                              // b~0
+        return largest();
+    }
+
+  friend IA square(const IA&);
+};
+
+// Non-documented
+// Returns true if the interval is a unique representable double.
+inline
+bool
+fit_in_double (const Interval_nt_round_to_nearest & d, double &r)
+{
+  bool b = d.is_point();
+  if (b)
+    r = d.inf();
+  return b;
+}
+
+// Non-documented
+inline
+bool
+is_singleton (const Interval_nt_round_to_nearest & d)
+{
+  return d.is_point();
+}
+
+// Non-documented
+inline
+double
+magnitude (const Interval_nt_round_to_nearest & d)
+{
+  return (std::max)(CGAL::abs(d.inf()), CGAL::abs(d.sup()));
+}
+
+// Non-documented
+inline
+double
+width (const Interval_nt_round_to_nearest & d)
+{
+  return d.sup() - d.inf();
+}
+
+template<>
+class Is_valid< Interval_nt_round_to_nearest >
+  : public CGAL::cpp98::unary_function< Interval_nt_round_to_nearest, bool > {
+  public :
+    bool operator()( const Interval_nt_round_to_nearest& x ) const {
+      return is_valid(-x.inf()) &&
+             is_valid(x.sup()) &&
+             x.inf() <= x.sup();
+    }
+};
+
+template <>
+struct Min <Interval_nt_round_to_nearest>
+    : public CGAL::cpp98::binary_function<Interval_nt_round_to_nearest,
+                             Interval_nt_round_to_nearest,
+                             Interval_nt_round_to_nearest >
+{
+    Interval_nt_round_to_nearest operator()( const Interval_nt_round_to_nearest& d,
+                                             const Interval_nt_round_to_nearest& e) const
+    {
+        return Interval_nt_round_to_nearest(
+                -(std::max)(-d.inf(), -e.inf()),
+                 (std::min)( d.sup(),  e.sup()));
+    }
+};
+
+template <>
+struct Max <Interval_nt_round_to_nearest>
+    : public CGAL::cpp98::binary_function<Interval_nt_round_to_nearest,
+                             Interval_nt_round_to_nearest,
+                             Interval_nt_round_to_nearest >
+{
+    Interval_nt_round_to_nearest operator()( const Interval_nt_round_to_nearest& d,
+                                             const Interval_nt_round_to_nearest& e) const
+    {
+        return Interval_nt_round_to_nearest(
+                -(std::min)(-d.inf(), -e.inf()),
+                 (std::max)( d.sup(),  e.sup()));
+    }
+};
+
+inline
+Interval_nt_round_to_nearest min BOOST_PREVENT_MACRO_SUBSTITUTION(
+const Interval_nt_round_to_nearest & x,
+const Interval_nt_round_to_nearest & y){
+  return CGAL::Min<Interval_nt_round_to_nearest> ()(x,y);
+}
+inline
+Interval_nt_round_to_nearest max BOOST_PREVENT_MACRO_SUBSTITUTION(
+const Interval_nt_round_to_nearest & x,
+const Interval_nt_round_to_nearest & y){
+  return CGAL::Max<Interval_nt_round_to_nearest> ()(x,y);
+}
+
+namespace INTERN_INTERVAL_NT {
+
+  inline
+  double
+  to_double (const Interval_nt_round_to_nearest & d)
+  {
+    return (d.sup() + d.inf()) * 0.5;
+    // This may overflow...
+  }
+
+  inline
+  std::pair<double, double>
+  to_interval (const Interval_nt_round_to_nearest & d)
+  {
+    return d.pair();
+  }
+
+  inline
+  Interval_nt_round_to_nearest
+  abs (const Interval_nt_round_to_nearest & d)
+  {
+    if (d.inf() >= 0.0) return d;
+    if (d.sup() <= 0.0) return -d;
+    return Interval_nt_round_to_nearest(0.0, (std::max)(-d.inf(), d.sup()));
+  }
+
+  inline
+  Uncertain<Sign>
+  sign (const Interval_nt_round_to_nearest & d)
+  {
+    if (d.inf() > 0.0) return POSITIVE;
+    if (d.sup() < 0.0) return NEGATIVE;
+    if (d.inf() == d.sup()) return ZERO;
+    return Uncertain<Sign>::indeterminate();
+  }
+
+  inline
+  Uncertain<Comparison_result>
+  compare (const Interval_nt_round_to_nearest & d, const Interval_nt_round_to_nearest & e)
+  {
+    if (d.inf() > e.sup()) return LARGER;
+    if (e.inf() > d.sup()) return SMALLER;
+    if (e.inf() == d.sup() && d.inf() == e.sup()) return EQUAL;
+    return Uncertain<Comparison_result>::indeterminate();
+  }
+
+  inline
+  Uncertain<bool>
+  is_zero (const Interval_nt_round_to_nearest & d)
+  {
+    if (d.inf() > 0.0) return false;
+    if (d.sup() < 0.0) return false;
+    if (d.inf() == d.sup()) return true;
+    return Uncertain<bool>::indeterminate();
+  }
+
+  inline
+  Uncertain<bool>
+  is_positive (const Interval_nt_round_to_nearest & d)
+  {
+    if (d.inf() > 0.0) return true;
+    if (d.sup() <= 0.0) return false;
+    return Uncertain<bool>::indeterminate();
+  }
+
+  inline
+  Uncertain<bool>
+  is_negative (const Interval_nt_round_to_nearest & d)
+  {
+    if (d.inf() >= 0.0) return false;
+    if (d.sup() < 0.0) return true;
+    return Uncertain<bool>::indeterminate();
+  }
+
+} // namespace INTERN_INTERVAL_NT
+
+inline
+Interval_nt_round_to_nearest
+sqrt (const Interval_nt_round_to_nearest & d)
+{
+  // sqrt([+a,+b]) => [sqrt(+a);sqrt(+b)]
+  // sqrt([-a,+b]) => [0;sqrt(+b)] => assumes roundoff error.
+  // sqrt([-a,-b]) => [0;sqrt(-b)] => assumes user bug (unspecified result).
+  double i = (d.inf() > 0.0) ? internal::IA_rn_sqrt_down(d.inf()) : 0.0;
+  double s = (d.sup() > 0.0) ? internal::IA_rn_sqrt_up(d.sup()) : 0.0;
+  return Interval_nt_round_to_nearest(i, s);
+}
+
+inline
+Interval_nt_round_to_nearest
+square (const Interval_nt_round_to_nearest & d)
+{
+  using internal::IA_rn_mul_up;
+  typedef Interval_nt_round_to_nearest IA;
+  if (d.inf()>=0.0)
+    return IA::from_negated_inf(IA_rn_mul_up(-d.inf(), d.inf()), IA_rn_mul_up(d.sup(), d.sup()));
+  if (d.sup()<=0.0)
+    return IA::from_negated_inf(IA_rn_mul_up(d.sup(), -d.sup()), IA_rn_mul_up(d.inf(), d.inf()));
+  const double m = (std::max)(-d.inf(), d.sup());
+  return IA::from_negated_inf(0.0, IA_rn_mul_up(m, m));
+}
+
+// Algebraic structure traits
+template<>
+class Algebraic_structure_traits< Interval_nt_round_to_nearest >
+  : public Algebraic_structure_traits_base< Interval_nt_round_to_nearest,
+                                            Field_with_sqrt_tag >  {
+  public:
+    typedef Interval_nt_round_to_nearest  Type;
+    typedef Tag_false           Is_exact;
+    typedef Tag_true            Is_numerical_sensitive;
+    typedef Uncertain<bool>     Boolean;
+
+    class Is_zero
+      : public CGAL::cpp98::unary_function< Type, Boolean > {
+      public:
+        Boolean operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT::is_zero( x );
+        }
+    };
+
+    // Specialized just to specify the result type
+    class Is_one
+      : public CGAL::cpp98::unary_function< Type, Boolean > {
+      public:
+        Boolean operator()( const Type& x ) const {
+          return x == 1;
+        }
+    };
+
+    class Square
+      : public CGAL::cpp98::unary_function< Type, Type > {
+      public:
+        Type operator()( const Type& x ) const {
+          return CGAL::square( x );
+        }
+    };
+
+    class Sqrt
+      : public CGAL::cpp98::unary_function< Type, Type > {
+      public:
+        Type operator()( const Type& x ) const {
+          return CGAL::sqrt( x );
+        }
+    };
+
+    struct Is_square
+        :public CGAL::cpp98::binary_function<Type,Type&,Boolean >
+    {
+        Boolean operator()(const Type& x) const {
+            return INTERN_INTERVAL_NT::is_positive( x );
+        }
+
+        Boolean operator()(const Type& x, Type& result) const {
+            Boolean is_positive = INTERN_INTERVAL_NT::is_positive( x );
+            if ( is_positive.inf() == true ){
+                result = CGAL::sqrt(x);
+            }else{
+                result = CGAL::sqrt(INTERN_INTERVAL_NT::abs(x));
+            }
+            return is_positive;
+        }
+    };
+
+  class Divides
+    : public CGAL::cpp98::binary_function< Type, Type, Boolean > {
+  public:
+    Boolean operator()( const Type& x, const Type&) const {
+      return ! Is_zero()(x);
+    }
+    // second operator computing q
+    Boolean operator()( const Type& x, const Type& y, Type& q) const {
+      if (! Is_zero()(x) )
+        q  = y/x ;
+      return Boolean(true);
+    }
+  };
+};
+
+// The Algebraic_structure_traits must be specialized first, as the base class
+// of the Real_embeddable_traits uses them.
+template<> class Real_embeddable_traits< Interval_nt_round_to_nearest >
+  : public INTERN_RET::Real_embeddable_traits_base< Interval_nt_round_to_nearest , CGAL::Tag_true> {
+  public:
+    typedef Interval_nt_round_to_nearest  Type;
+  typedef Uncertain<CGAL::Sign> Sign;
+  typedef Uncertain<bool> Boolean;
+  typedef Uncertain<CGAL::Comparison_result> Comparison_result;
+
+    class Abs
+      : public CGAL::cpp98::unary_function< Type, Type > {
+      public:
+        Type operator()( const Type& x ) const {
+            return INTERN_INTERVAL_NT::abs( x );
+        }
+    };
+
+    class Sgn
+        : public CGAL::cpp98::unary_function< Type, Uncertain< ::CGAL::Sign > > {
+      public:
+        Uncertain< ::CGAL::Sign > operator()( const Type& x ) const {
+            return INTERN_INTERVAL_NT::sign( x );
+        }
+    };
+
+    class Is_positive
+      : public CGAL::cpp98::unary_function< Type, Uncertain<bool> > {
+      public:
+        Uncertain<bool> operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT::is_positive( x );
+        }
+    };
+
+    class Is_negative
+      : public CGAL::cpp98::unary_function< Type, Uncertain<bool> > {
+      public:
+        Uncertain<bool> operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT::is_negative( x );
+        }
+    };
+
+    class Compare
+      : public CGAL::cpp98::binary_function< Type, Type, Comparison_result > {
+      public:
+      Comparison_result operator()( const Type& x, const Type& y ) const {
+        return INTERN_INTERVAL_NT::compare( x, y );
+      }
+      CGAL_IMPLICIT_INTEROPERABLE_BINARY_OPERATOR_WITH_RT( Type,
+          Comparison_result )
+    };
+
+    class To_double
+      : public CGAL::cpp98::unary_function< Type, double > {
+      public:
+        double operator()( const Type& x ) const {
+            return INTERN_INTERVAL_NT::to_double( x );
+        }
+    };
+
+    class To_interval
+      : public CGAL::cpp98::unary_function< Type, std::pair< double, double > > {
+      public:
+        std::pair<double, double> operator()( const Type& x ) const {
+            return INTERN_INTERVAL_NT::to_interval( x );
+        }
+    };
+
+    class Is_finite
+      : public CGAL::cpp98::unary_function< Type, Boolean > {
+      public :
+        Boolean operator()( const Type& x ) const {
+          return CGAL_NTS is_finite( x.inf() ) && CGAL_NTS is_finite( x.sup() );
+        }
+    };
+
+};
+
+// COERCION_TRAITS BEGIN
+template < class A, class B , int > struct Coercion_traits_for_level;
+template < class A, class B, class C> struct Coercion_traits_interval_nt;
+
+template<class A>
+struct Coercion_traits_for_level<A,Interval_nt_round_to_nearest,CTL_INTERVAL>
+    :public Coercion_traits_interval_nt<A,Interval_nt_round_to_nearest,
+            typename Real_embeddable_traits<A>::Is_real_embeddable>{};
+
+template<class A>
+struct Coercion_traits_for_level<Interval_nt_round_to_nearest,A,CTL_INTERVAL>
+    :public Coercion_traits_for_level<A,Interval_nt_round_to_nearest, CTL_INTERVAL>{};
+
+template<class A>
+struct Coercion_traits_interval_nt<A, Interval_nt_round_to_nearest,Tag_false>
+    :public Coercion_traits_for_level<A,Interval_nt_round_to_nearest,0>{};
+
+template<class A>
+struct Coercion_traits_interval_nt<A, Interval_nt_round_to_nearest, Tag_true>{
+    typedef Tag_true Are_explicit_interoperable;
+    typedef Tag_false Are_implicit_interoperable;
+    typedef Interval_nt_round_to_nearest Type;
+    struct Cast {
+        typedef Interval_nt_round_to_nearest result_type;
+        Interval_nt_round_to_nearest inline operator()(const Interval_nt_round_to_nearest& x ) const {
+            return x;
+        }
+        Interval_nt_round_to_nearest inline operator()(const A& x ) const {
+            return typename Real_embeddable_traits<A>::To_interval()(x);
+        }
+    };
+};
+
+// COERCION_TRAITS END
+
+} //namespace CGAL
+
+#endif // CGAL_INTERVAL_NT_ROUND_TO_NEAREST_H
@@ -136,7 +136,7 @@ struct Lazy_exact_Int_Cst final : public Lazy_exact_nt_rep<ET>
       : Lazy_exact_nt_rep<ET>(double(i)) {}
 
   void update_exact() const {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect((int)this->approx().sup());
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>((int)this->approx().sup());
     this->keep_at(pet);
     this->set_ptr(pet);
   }
@@ -150,7 +150,7 @@ struct Lazy_exact_Cst final : public Lazy_exact_nt_rep<ET>
       : Lazy_exact_nt_rep<ET>(x), cste(x) {}
 
   void update_exact() const {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(cste);
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>(cste);
     this->keep_at(pet);
     this->set_ptr(pet);
   }
@@ -169,8 +169,8 @@ struct Lazy_exact_Ex_Cst final : public Lazy_exact_nt_rep<ET>
   { }
 
   void update_exact() const {
-    // Currently we do not check is_lazy() before calling call_once, so this is called.
-    // CGAL_error();
+    // Not called: the exact value is known from the construction,
+    // and Lazy_rep::exact() only goes through call_once() for lazy nodes.
   }
 };
 
@@ -190,7 +190,7 @@ public:
 
   void update_exact() const
   {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(l.exact());
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>(l.exact());
     this->set_at(pet, l.approx());
     this->set_ptr(pet);
     this->prune_dag();
@@ -281,7 +281,7 @@ struct NAME final : public Lazy_exact_unary<ET>                          \
                                                                          \
   void update_exact() const                                              \
   {                                                                      \
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(OP(this->op1.exact())); \
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>(OP(this->op1.exact())); \
     if (!this->approx().is_point())                                               \
       this->set_at(pet);                                                 \
     this->set_ptr(pet);                                                  \
@@ -305,7 +305,7 @@ struct NAME final : public Lazy_exact_binary<ET, ET1, ET2>               \
                                                                          \
   void update_exact() const                                              \
   {                                                                      \
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(this->op1.exact() OP this->op2.exact()); \
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>(this->op1.exact() OP this->op2.exact()); \
     if (!this->approx().is_point())                                               \
       this->set_at(pet);                                                 \
     this->set_ptr(pet);                                                  \
@@ -328,7 +328,7 @@ struct Lazy_exact_Min final : public Lazy_exact_binary<ET>
   void update_exact() const
   {
     // Should we test is_point earlier, and construct ET from double in that case? Constructing from double is not free, but if op1 or op2 is not exact yet, we may be able to skip a whole tree of exact constructions.
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect((CGAL::min)(this->op1.exact(), this->op2.exact()));
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>((CGAL::min)(this->op1.exact(), this->op2.exact()));
     if (!this->approx().is_point())
       this->set_at(pet);
     this->set_ptr(pet);
@@ -345,7 +345,7 @@ struct Lazy_exact_Max final : public Lazy_exact_binary<ET>
 
   void update_exact() const
   {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect((CGAL::max)(this->op1.exact(), this->op2.exact()));
+    auto* pet = new_lazy_node<typename Lazy_exact_nt_rep<ET>::Indirect>((CGAL::max)(this->op1.exact(), this->op2.exact()));
     if (!this->approx().is_point())
       this->set_at(pet);
     this->set_ptr(pet);
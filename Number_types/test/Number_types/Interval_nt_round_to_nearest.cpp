@@ -0,0 +1,175 @@
+// Test file for the Interval_nt_round_to_nearest class:
+// its bounds must be the same as the ones of Interval_nt, computed with the
+// rounding mode towards +infinity, except in case of underflow, where they
+// must contain them.
+
+#include <CGAL/config.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Interval_nt_round_to_nearest.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+typedef CGAL::Interval_nt<true>                 IA;
+typedef CGAL::Interval_nt_round_to_nearest      RN;
+
+RN to_rn(const IA& a) { return RN(a.inf(), a.sup()); }
+
+// the bounds are equal, or the bounds of `r` contain the ones of `a` if `exact` is false
+// With the excess precision of the FPU, the errors cannot be computed exactly,
+// and the bounds are only guaranteed to contain the ones of Interval_nt.
+#ifdef CGAL_FPU_HAS_EXCESS_PRECISION
+const bool exact_errors = false;
+#else
+const bool exact_errors = true;
+#endif
+
+bool check(const RN& r, const IA& a, bool exact, const char* op)
+{
+  exact = exact && exact_errors;
+  bool ok = exact ? (r.inf() == a.inf() && r.sup() == a.sup())
+                  : (r.inf() <= a.inf() && a.sup() <= r.sup());
+  if(!ok)
+    std::cerr << "ERROR: " << op << " gives " << r << " instead of " << a << std::endl;
+  return ok;
+}
+
+// With infinite bounds, the results may differ since the SSE2 version of Interval_nt
+// returns larger intervals than necessary in some cases (0 * [-inf;inf]).
+bool check_unbounded(const RN& r, const IA& a, const char* op)
+{
+  bool ok = (r.inf() <= r.sup()) &&
+            ((r.inf() <= a.inf() && a.sup() <= r.sup()) || (a.inf() <= r.inf() && r.sup() <= a.sup()));
+  if(!ok)
+    std::cerr << "ERROR: " << op << " gives " << r << " and " << a << std::endl;
+  return ok;
+}
+
+bool is_finite(const IA& a)
+{
+  return std::isfinite(a.inf()) && std::isfinite(a.sup());
+}
+
+// The bounds are only guaranteed to be the same far from underflow and overflow.
+bool is_extreme(const IA& a)
+{
+  const double m = (std::max)(std::fabs(a.inf()), std::fabs(a.sup()));
+  return (m != 0 && m < 1e-280) || m > 1e290;
+}
+
+bool is_extreme(const IA& a, const IA& b, const IA& r)
+{
+  return is_extreme(a) || is_extreme(b) || is_extreme(r);
+}
+
+bool test_operations(const std::vector<IA>& values)
+{
+  bool ok = true;
+  for(const IA& a : values)
+  {
+    const RN ra = to_rn(a);
+    ok = ok && check(CGAL::square(ra), CGAL::square(a), !is_extreme(a, a, CGAL::square(a)), "square");
+    if(a.inf() >= 0)
+      ok = ok && check(CGAL::sqrt(ra), CGAL::sqrt(a), !is_extreme(a), "sqrt");
+    ok = ok && check(-ra, -a, true, "opposite");
+
+    for(const IA& b : values)
+    {
+      const RN rb = to_rn(b);
+      if(!is_finite(a) || !is_finite(b))
+      {
+        ok = ok && check_unbounded(ra + rb, a + b, "+");
+        ok = ok && check_unbounded(ra * rb, a * b, "*");
+        continue;
+      }
+      ok = ok && check(ra + rb, a + b, true, "+");
+      ok = ok && check(ra - rb, a - b, true, "-");
+      ok = ok && check(ra * rb, a * b, !is_extreme(a, b, a * b), "*");
+      if(b.inf() > 0 || b.sup() < 0)
+        ok = ok && check(ra / rb, a / b, !is_extreme(a, b, a / b), "/");
+    }
+  }
+  return ok;
+}
+
+// Same as the spiral test of Interval_nt.cpp: with the same bounds, the first axis is found at 396.
+bool spiral_test()
+{
+  int i=0;
+  RN x_i (1.0), y_i (0.0);
+
+  while (++i < 500)
+  {
+    RN x_ip1 = x_i - y_i/CGAL_NTS sqrt(RN(i));
+    RN y_ip1 = y_i + x_i/CGAL_NTS sqrt(RN(i));
+    x_i = x_ip1;
+    y_i = y_ip1;
+    if ( x_i.do_overlap(0) || y_i.do_overlap(0) )
+      break;
+  };
+
+  return exact_errors ? (i == 396) : (i <= 396);
+}
+
+bool test_predicates()
+{
+  RN a(0.1), b(0.2), c(0.3);
+  bool ok = true;
+  ok = ok && CGAL::is_indeterminate(a + b == c);
+  ok = ok && !CGAL::is_indeterminate(a + b < 1);
+  ok = ok && CGAL::sign(a - b) == CGAL::NEGATIVE;
+  ok = ok && CGAL::compare(a, b) == CGAL::SMALLER;
+  ok = ok && CGAL::is_zero(RN(0) * a) == true;
+  ok = ok && CGAL::is_indeterminate(CGAL::sign(RN(1) / RN(3) * RN(3) - RN(1)));
+  ok = ok && CGAL::abs(RN(-1, 2)).inf() == 0;
+  ok = ok && RN(1LL << 60).is_point();
+  ok = ok && !RN((1LL << 60) + 1).is_point() && RN((1LL << 60) + 1).do_overlap(RN(std::ldexp(1., 60)));
+  double d = 0;
+  ok = ok && (!exact_errors || (CGAL::fit_in_double(RN(3) * RN(7), d) && d == 21));
+  return ok;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  std::vector<IA> values;
+  const double specials[] = { 0., 1., -1., 0.1, -0.3, 3., 1e-300, -2e-310, 1e-160, 1e300, -1e300, 1.7e308, 1e154,
+                              std::numeric_limits<double>::denorm_min(), (std::numeric_limits<double>::max)() };
+  for(double d : specials)
+    values.push_back(IA(d));
+  for(int i=0; i<150; ++i)
+  {
+    double x = rnd.get_double(-1, 1), y = rnd.get_double(-1, 1);
+    switch(i % 5)
+    {
+      case 0: values.push_back(IA(x)); break;
+      case 1: values.push_back(IA((std::min)(x, y), (std::max)(x, y))); break;
+      case 2: values.push_back(IA(x) / IA(3)); break;
+      case 3: values.push_back(IA(std::ldexp(x, rnd.get_int(-1000, 1000)))); break;
+      default: values.push_back(IA(x) * IA(std::ldexp(1., rnd.get_int(-500, 500)))); break;
+    }
+  }
+  values.push_back(IA::largest());
+  values.push_back(IA(0, std::numeric_limits<double>::infinity()));
+  values.push_back(IA(-std::numeric_limits<double>::infinity(), -1));
+
+  bool ok = test_operations(values);
+  if(!spiral_test())
+  {
+    std::cerr << "ERROR: spiral test" << std::endl;
+    ok = false;
+  }
+  if(!test_predicates())
+  {
+    std::cerr << "ERROR: predicates" << std::endl;
+    ok = false;
+  }
+
+  std::cout << (ok ? "done" : "failed") << std::endl;
+  return ok ? 0 : 1;
+}
@@ -24,6 +24,7 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/Face_graph_output_builder.h>
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/Output_builder_for_autorefinement.h>
 #include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 
 
 namespace CGAL {
@@ -232,6 +233,14 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the intersection of the faces and their retriangulation
+  *                           should be done using one or several threads.}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. The output does not depend on the tag. The visitor is called from the calling thread only.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param nps_out an optional tuple of sequences of \ref bgl_namedparameters "Named Parameters" each among the ones listed below
@@ -288,6 +297,17 @@ corefine_and_compute_boolean_operations(
   const bool throw_on_self_intersection =
     choose_parameter(get_parameter(np1, internal_np::throw_on_self_intersection), false);
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NPIn1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  const bool parallel_mode = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
 // Vertex point maps
   //for input meshes
   typedef typename GetVertexPointMap<TriangleMesh, NPIn1>::type  VPM1;
@@ -490,8 +510,11 @@ corefine_and_compute_boolean_operations(
     ob.setup_for_clipping_a_surface(use_compact_clipper);
   }
 
+  Algo_visitor algo_visitor(uv,ob,ecm_in);
+  algo_visitor.set_parallel_mode(parallel_mode);
   Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor >
-    functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm_in));
+    functor(tm1, tm2, vpm1, vpm2, algo_visitor);
+  functor.set_parallel_mode(parallel_mode);
   functor(CGAL::Emptyset_iterator(), throw_on_self_intersection, true);
 
 
@@ -571,6 +594,14 @@ corefine_and_compute_boolean_operations(
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the intersection of the faces and their retriangulation
+  *                           should be done using one or several threads.}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. The output does not depend on the tag. The visitor is called from the calling thread only.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param np_out an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -738,6 +769,15 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  *     \cgalParamDefault{`false`}
  *     \cgalParamExtra{`np1` only}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the intersection of the faces and their retriangulation
+ *                           should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{`np1` only. The output does not depend on the tag. The visitor is called from the calling thread only.}
+ *   \cgalParamNEnd
+ *
  *   \cgalParamNBegin{do_not_modify}
  *     \cgalParamDescription{if `true`, the corresponding mesh will not be updated.}
  *     \cgalParamType{Boolean}
@@ -777,6 +817,17 @@ corefine(      TriangleMesh& tm1,
   const bool throw_on_self_intersection =
     choose_parameter(get_parameter(np1, internal_np::throw_on_self_intersection), false);
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  const bool parallel_mode = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
 // Vertex point maps
   typedef typename GetVertexPointMap<TriangleMesh, NamedParameters1>::type VPM1;
   typedef typename GetVertexPointMap<TriangleMesh, NamedParameters2>::type VPM2;
@@ -834,8 +885,11 @@ corefine(      TriangleMesh& tm1,
 
   Ob ob;
   Ecm ecm(tm1,tm2,ecm1,ecm2);
+  Algo_visitor algo_visitor(uv,ob,ecm,const_mesh_ptr);
+  algo_visitor.set_parallel_mode(parallel_mode);
   Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor>
-    functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm,const_mesh_ptr), const_mesh_ptr);
+    functor(tm1, tm2, vpm1, vpm2, algo_visitor, const_mesh_ptr);
+  functor.set_parallel_mode(parallel_mode);
 
   // Fill non-manifold feature maps if provided
   functor.set_non_manifold_feature_map_1(parameters::get_parameter(np1, internal_np::non_manifold_feature_map));
@@ -27,6 +27,8 @@
 #endif
 
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CGAL {
 
@@ -54,6 +56,74 @@ bool fair(TriangleMesh& tmesh,
   return fair_functor.fair(vertices, solver, continuity);
 }
 
+// computes the faired points of `vertices` without relocating them, see `fair()` for the named parameters.
+// Only reads `tmesh`: several regions can be processed concurrently.
+template<typename TriangleMesh,
+         typename VertexRange,
+         typename NamedParameters>
+bool compute_fair_points(TriangleMesh& tmesh,
+                         const VertexRange& vertices,
+                         std::vector<std::pair<typename boost::graph_traits<TriangleMesh>::vertex_descriptor,
+                                               typename boost::property_traits<
+                                                 typename GetVertexPointMap<TriangleMesh, NamedParameters>::type>::value_type> >& fair_points,
+                         const NamedParameters& np)
+{
+  using parameters::get_parameter;
+  using parameters::choose_parameter;
+
+  CGAL_precondition(is_triangle_mesh(tmesh));
+
+#if defined(CGAL_EIGEN3_ENABLED)
+  #if EIGEN_VERSION_AT_LEAST(3,2,0)
+  typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
+    CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> >  >
+    Default_solver;
+  #else
+  typedef bool Default_solver;//compilation should crash
+    //if no solver is provided and Eigen version < 3.2
+  #endif
+#else
+  typedef bool Default_solver;//compilation should crash
+    //if no solver is provided and Eigen version < 3.2
+#endif
+
+#if defined(CGAL_EIGEN3_ENABLED)
+  static_assert(
+    (!std::is_same<typename GetSolver<NamedParameters, Default_solver>::type, bool>::value) || EIGEN_VERSION_AT_LEAST(3, 2, 0),
+    "The function `fair` requires Eigen3 version 3.2 or later.");
+#else
+  static_assert(
+    (!std::is_same<typename GetSolver<NamedParameters, Default_solver>::type, bool>::value),
+    "The function `fair` requires Eigen3 version 3.2 or later.");
+#endif
+
+  typedef typename GetVertexPointMap < TriangleMesh, NamedParameters>::type VPMap;
+  VPMap vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                                 get_property_map(vertex_point, tmesh));
+
+  typedef typename GetGeomTraits < TriangleMesh, NamedParameters>::type GT;
+  GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+
+  // Cotangent_weight_with_voronoi_area_fairing has been changed to the version:
+  // Secure_cotangent_weight_with_voronoi_area to avoid imprecisions from
+  // the issue #4706 - https://github.com/CGAL/cgal/issues/4706.
+  typedef CGAL::Weights::Secure_cotangent_weight_with_voronoi_area<TriangleMesh, VPMap, GT> Default_weight_calculator;
+
+  typedef typename GetSolver<NamedParameters, Default_solver>::type Solver;
+  typedef typename internal_np::Lookup_named_param_def<internal_np::weight_calculator_t,
+                                                       NamedParameters,
+                                                       Default_weight_calculator>::type Weight_calculator;
+
+  CGAL::Polygon_mesh_processing::internal::Fair_Polyhedron_3<TriangleMesh, Solver, Weight_calculator, VPMap>
+    fair_functor(tmesh, vpmap,
+                 choose_parameter(get_parameter(np, internal_np::weight_calculator),
+                                  Default_weight_calculator(tmesh, vpmap, gt)));
+  return fair_functor.compute_fair_points(vertices,
+                                          choose_parameter<Default_solver>(get_parameter(np, internal_np::sparse_linear_solver)),
+                                          choose_parameter(get_parameter(np, internal_np::fairing_continuity), 1),
+                                          fair_points);
+}
+
 } //end namespace internal
 
   /*!
@@ -134,49 +204,19 @@ bool fair(TriangleMesh& tmesh,
     using parameters::get_parameter;
     using parameters::choose_parameter;
 
-    CGAL_precondition(is_triangle_mesh(tmesh));
-
-#if defined(CGAL_EIGEN3_ENABLED)
-  #if EIGEN_VERSION_AT_LEAST(3,2,0)
-    typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
-      CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> >  >
-      Default_solver;
-  #else
-    typedef bool Default_solver;//compilation should crash
-      //if no solver is provided and Eigen version < 3.2
-  #endif
-#else
-    typedef bool Default_solver;//compilation should crash
-      //if no solver is provided and Eigen version < 3.2
-#endif
+    typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor vertex_descriptor;
+    typedef typename GetVertexPointMap<TriangleMesh, NamedParameters>::type VPMap;
+    typedef typename boost::property_traits<VPMap>::value_type Point_3;
 
-#if defined(CGAL_EIGEN3_ENABLED)
-    static_assert(
-      (!std::is_same<typename GetSolver<NamedParameters, Default_solver>::type, bool>::value) || EIGEN_VERSION_AT_LEAST(3, 2, 0),
-      "The function `fair` requires Eigen3 version 3.2 or later.");
-#else
-    static_assert(
-      (!std::is_same<typename GetSolver<NamedParameters, Default_solver>::type, bool>::value),
-      "The function `fair` requires Eigen3 version 3.2 or later.");
-#endif
+    std::vector<std::pair<vertex_descriptor, Point_3> > fair_points;
+    if(!internal::compute_fair_points(tmesh, vertices, fair_points, np))
+      return false;
 
-    typedef typename GetVertexPointMap < TriangleMesh, NamedParameters>::type VPMap;
     VPMap vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point),
                                    get_property_map(vertex_point, tmesh));
-
-    typedef typename GetGeomTraits < TriangleMesh, NamedParameters>::type GT;
-    GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
-
-    // Cotangent_weight_with_voronoi_area_fairing has been changed to the version:
-    // Secure_cotangent_weight_with_voronoi_area to avoid imprecisions from
-    // the issue #4706 - https://github.com/CGAL/cgal/issues/4706.
-    typedef CGAL::Weights::Secure_cotangent_weight_with_voronoi_area<TriangleMesh, VPMap, GT> Default_weight_calculator;
-
-    return internal::fair(tmesh, vertices,
-      choose_parameter<Default_solver>(get_parameter(np, internal_np::sparse_linear_solver)),
-      choose_parameter(get_parameter(np, internal_np::weight_calculator), Default_weight_calculator(tmesh, vpmap, gt)),
-      choose_parameter(get_parameter(np, internal_np::fairing_continuity), 1),
-      vpmap);
+    for(const std::pair<vertex_descriptor, Point_3>& vp : fair_points)
+      put(vpmap, vp.first, vp.second);
+    return true;
   }
 
 } // namespace Polygon_mesh_processing
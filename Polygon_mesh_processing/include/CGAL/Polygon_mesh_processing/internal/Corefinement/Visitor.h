@@ -29,6 +29,14 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <memory>
+#include <vector>
+
 namespace CGAL{
 namespace Polygon_mesh_processing {
 namespace Corefinement{
@@ -514,6 +522,7 @@ private:
   EdgeMarkMapBind marks_on_edges;
   bool input_with_coplanar_faces;
   TriangleMesh* const_mesh_ptr;
+  bool parallel_mode;
 
   template <class Ecm1, class Ecm2>
   void call_put(Ecm_bind<TriangleMesh, Ecm1, Ecm2>& ecm,
@@ -550,8 +559,15 @@ public:
     , marks_on_edges(emm)
     , input_with_coplanar_faces(false)
     , const_mesh_ptr(const_mesh_ptr)
+    , parallel_mode(false)
   {}
 
+  // if `b` is `true`, the triangulations of the intersected faces are built in parallel
+  void set_parallel_mode(bool b)
+  {
+    parallel_mode=b;
+  }
+
 
   void start_filtering_intersections() const
   {
@@ -1188,6 +1204,348 @@ public:
     }
   }
 
+  // split a degenerate face along the intersection edges and triangulate the new faces
+  void triangulate_degenerate_face(face_descriptor f,
+                                   TriangleMesh& tm,
+                                   const std::array<Node_id,3>& f_indices,
+                                   typename Face_boundaries::iterator it_fb,
+                                   Face_boundaries& face_boundaries,
+                                   const Node_id nb_nodes,
+                                   Node_id_to_vertex& node_id_to_vertex)
+  {
+    Node_ids face_vertex_nids;
+
+    //check if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik)
+      if ( f_indices[ik]<nb_nodes )
+        face_vertex_nids.push_back(f_indices[ik]);
+
+    // collect nodes on edges (if any)
+    if (it_fb != face_boundaries.end())
+    {
+      Face_boundary& f_boundary=it_fb->second;
+      for (int i=0;i<3;++i)
+        std::copy(f_boundary.node_ids_array[i].begin(),
+                  f_boundary.node_ids_array[i].end(),
+                  std::back_inserter(face_vertex_nids));
+    }
+
+    std::sort(face_vertex_nids.begin(), face_vertex_nids.end());
+    std::vector<std::array<std::pair<halfedge_descriptor,Node_id>,2>> constraints;
+    for(Node_id id : face_vertex_nids)
+    {
+      CGAL_assertion(id < graph_of_constraints.size());
+      const std::vector<Node_id>& neighbors=graph_of_constraints[id];
+      if (!neighbors.empty())
+      {
+        for(Node_id id_n :neighbors)
+        {
+          if (id_n<id) continue;
+          if (std::binary_search(face_vertex_nids.begin(), face_vertex_nids.end(), id_n))
+          {
+            vertex_descriptor vi = node_id_to_vertex.get_vertex(id),
+                              vn = node_id_to_vertex.get_vertex(id_n);
+            bool is_face_border = false;
+            halfedge_descriptor h;
+
+            std::tie(h, is_face_border) = halfedge(vi,vn, tm);
+            if (is_face_border)
+            {
+              call_put(marks_on_edges,tm,edge(h,tm),true);
+              output_builder.set_edge_per_polyline(tm,std::make_pair(id, id_n),h);
+            }
+            else
+            {
+              halfedge_descriptor hi=halfedge(vi, tm);
+              while(face(hi, tm) != f)
+                hi=opposite(next(hi, tm), tm);
+
+              halfedge_descriptor hn=halfedge(vn, tm);
+              while(face(hn, tm) != f)
+                hn=opposite(next(hn, tm), tm);
+              constraints.emplace_back(make_array(std::make_pair(hi,id),std::make_pair(hn, id_n)));
+            }
+          }
+        }
+      }
+      #ifdef CGAL_COREFINEMENT_DEBUG
+      else
+        std::cout << "X0bis: Found an isolated point" << std::endl;
+      #endif
+    }
+
+    CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
+    std::vector<face_descriptor> new_faces;
+    for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
+    {
+      halfedge_descriptor nh = Euler::split_face(a[0].first, a[1].first, tm);
+      new_faces.push_back(face(opposite(nh, tm), tm));
+
+      call_put(marks_on_edges,tm,edge(nh,tm),true);
+      output_builder.set_edge_per_polyline(tm,std::make_pair(a[0].second, a[1].second),nh);
+    }
+
+    // now triangulate new faces
+    if (!new_faces.empty())
+    {
+      new_faces.push_back(f);
+      for(face_descriptor nf : new_faces)
+      {
+        halfedge_descriptor h = halfedge(nf, tm),
+                            nh = next(next(h,tm),tm);
+        while(next(nh, tm)!=h)
+          nh=next(Euler::split_face(h, nh, tm), tm);
+      }
+    }
+  }
+
+  // the constrained triangulation of a face to be retriangulated,
+  // and the information needed to import it in the mesh
+  struct Face_triangulation{
+    // the vertices of f
+    std::array<vertex_descriptor,3> f_vertices;
+    // the node_id of an input vertex or a fake id (>=nb_nodes)
+    std::array<Node_id,3> f_indices;
+    std::map<Node_id,CDT_Vertex_handle> id_to_CDT_vh;
+    //associate an edge of the triangulation to a halfedge in a given polyhedron
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+    std::unique_ptr<CDT> cdt;
+  };
+
+  // collect the vertices of the face `f` and the halfedges of its edges
+  void init_face_triangulation(face_descriptor f,
+                               TriangleMesh& tm,
+                               typename Face_boundaries::iterator it_fb,
+                               Face_boundaries& face_boundaries,
+                               const Node_id nb_nodes,
+                               Vertex_to_node_id& vertex_to_node_id,
+                               Node_id_to_vertex& node_id_to_vertex,
+                               Face_triangulation& ft)
+  {
+    std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    std::array<Node_id,3>& f_indices = ft.f_indices;
+    f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
+    if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
+      f_vertices[0]=it_fb->second.vertices[0];
+      f_vertices[1]=it_fb->second.vertices[1];
+      f_vertices[2]=it_fb->second.vertices[2];
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+      if (doing_autorefinement || handle_non_manifold_features)
+        it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
+    }
+    else{
+      CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
+      halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
+      f_vertices[0]=target(h0,tm); //nb_nodes
+      f_vertices[1]=target(h1,tm); //nb_nodes+1
+      f_vertices[2]=target(h2,tm); //nb_nodes+2
+
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+      ft.edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
+      ft.edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
+      ft.edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+    }
+  }
+
+  // `true` if the constraints of the face depend on the retriangulation of coplanar faces, see XSL_TAG_CPL_VERT
+  bool has_nodes_from_coplanar_faces(const Face_triangulation& ft,
+                                     const Node_ids& node_ids,
+                                     typename Face_boundaries::iterator it_fb,
+                                     Face_boundaries& face_boundaries) const
+  {
+    if (number_coplanar_vertices==0) return false;
+    for (Node_id id : ft.f_indices)
+      if (id < number_coplanar_vertices) return true;
+    for (Node_id id : node_ids)
+      if (id < number_coplanar_vertices) return true;
+    if (it_fb!=face_boundaries.end())
+      for (int i=0;i<3;++i)
+        for (Node_id id : it_fb->second.node_ids_array[i])
+          if (id < number_coplanar_vertices) return true;
+    return false;
+  }
+
+  // build the constrained triangulation of the face `f` with the nodes on its boundary and in its interior
+  template <class VPM>
+  void build_face_triangulation(TriangleMesh& tm,
+                                const VPM& vpm,
+                                INodes& nodes,
+                                Node_ids& node_ids,
+                                typename Face_boundaries::iterator it_fb,
+                                Face_boundaries& face_boundaries,
+                                const Node_id nb_nodes,
+                                Face_triangulation& ft)
+  {
+    const std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    const std::array<Node_id,3>& f_indices = ft.f_indices;
+    std::map<Node_id,CDT_Vertex_handle>& id_to_CDT_vh = ft.id_to_CDT_vh;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+
+    typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
+                         q = nodes.to_exact(get(vpm,f_vertices[1])),
+                         r = nodes.to_exact(get(vpm,f_vertices[2]));
+///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
+    CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
+    ft.cdt.reset(new CDT(traits));
+    CDT& cdt = *ft.cdt;
+
+    // insert triangle points
+    std::array<CDT_Vertex_handle,3> triangle_vertices;
+    //we can do this to_exact because these are supposed to be input points.
+    triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
+    triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
+    triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
+    triangle_vertices[2]->set_point(r);
+
+    triangle_vertices[0]->info()=f_indices[0];
+    triangle_vertices[1]->info()=f_indices[1];
+    triangle_vertices[2]->info()=f_indices[2];
+
+    //if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik){
+      if ( f_indices[ik]<nb_nodes )
+        id_to_CDT_vh.insert(
+            std::make_pair(f_indices[ik],triangle_vertices[ik]));
+    }
+    //insert points on edges
+    if (it_fb!=face_boundaries.end()) //if f not a triangle?
+    {
+      // collect infinite faces incident to the initial triangle
+      typename CDT::Face_handle infinite_faces[3];
+      for (int i=0;i<3;++i)
+      {
+        int oi=-1;
+        CGAL_assertion_code(bool is_edge = )
+        cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
+        CGAL_assertion(is_edge);
+        CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
+      }
+
+      // In this loop, for each original edge of the triangle, we insert
+      // the constrained edges and we recover the halfedge_descriptor
+      // corresponding to these constrained (they are already in tm)
+      Face_boundary& f_boundary=it_fb->second;
+      for (int i=0;i<3;++i){
+        //handle case of halfedge starting at triangle_vertices[i]
+        // and ending at triangle_vertices[(i+1)%3]
+
+        const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
+        CDT_Vertex_handle previous=triangle_vertices[i];
+        Node_id prev_index=f_indices[i];// node-id of the mesh vertex
+        halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
+        CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
+        if (!ids_on_edge.empty()){ //is there at least one node on this edge?
+          // fh must be an infinite face
+          // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
+          for(Node_id id : ids_on_edge)
+          {
+            CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
+            vh->info()=id;
+            id_to_CDT_vh.insert(std::make_pair(id,vh));
+            edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
+            previous=vh;
+            hedge=next(hedge,tm);
+            prev_index=id;
+          }
+        }
+        else{
+        CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
+          CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
+          CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
+        }
+        CGAL_assertion(hedge==f_boundary.halfedges[i]);
+        edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
+          it_fb->second.halfedges[i];
+      }
+    }
+
+    //insert point inside face
+    for(Node_id node_id : node_ids)
+    {
+      CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
+      vh->info()=node_id;
+      id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    }
+
+    // insert constraints that are interior to the triangle (in the case
+    // no edges are collinear in the meshes)
+    insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,ft.constrained_edges);
+
+    // insert constraints between points that are on the boundary
+    // (not a constrained on the triangle boundary)
+    if (it_fb!=face_boundaries.end()) //is f not a triangle ?
+    {
+      for (int i=0;i<3;++i)
+      {
+        Node_ids& ids=it_fb->second.node_ids_array[i];
+        insert_constrained_edges(ids,cdt,id_to_CDT_vh,ft.constrained_edges,1);
+      }
+    }
+
+    //insert coplanar edges for endpoints of triangles
+    for (int i=0;i<3;++i){
+      Node_id nindex=triangle_vertices[i]->info();
+      if ( nindex < nb_nodes )
+        insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+    }
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // build concurrently the triangulations of the faces in a batch starting at `begin`.
+  // Degenerate faces and faces whose constraints depend on previously retriangulated
+  // coplanar faces are left to the sequential loop (their triangulation is not built).
+  template <class OnFaceMapIterator, class VPM>
+  void build_face_triangulations_in_parallel(OnFaceMapIterator begin,
+                                             OnFaceMapIterator end,
+                                             TriangleMesh& tm,
+                                             const VPM& vpm,
+                                             INodes& nodes,
+                                             Face_boundaries& face_boundaries,
+                                             Vertex_to_node_id& vertex_to_node_id,
+                                             Node_id_to_vertex& node_id_to_vertex,
+                                             std::vector<Face_triangulation>& triangulations)
+  {
+    // bounds the memory used by the triangulations waiting to be imported in the mesh
+    const std::size_t batch_size = 4096;
+
+    std::vector<OnFaceMapIterator> batch;
+    for (; begin!=end && batch.size()<batch_size; ++begin)
+      batch.push_back(begin);
+
+    triangulations.clear();
+    triangulations.resize(batch.size());
+
+    const Node_id nb_nodes = nodes.size();
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for (std::size_t i=r.begin(); i!=r.end(); ++i)
+                        {
+                          face_descriptor f = batch[i]->first;
+                          Node_ids& node_ids = batch[i]->second;
+                          typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+
+                          Face_triangulation& ft = triangulations[i];
+                          init_face_triangulation(f, tm, it_fb, face_boundaries, nb_nodes,
+                                                  vertex_to_node_id, node_id_to_vertex, ft);
+                          if (is_degenerate_face(ft, vpm) ||
+                              has_nodes_from_coplanar_faces(ft, node_ids, it_fb, face_boundaries))
+                            continue;
+                          build_face_triangulation(tm, vpm, nodes, node_ids, it_fb, face_boundaries, nb_nodes, ft);
+                        }
+                      });
+  }
+#endif
+
+  template <class VPM>
+  bool is_degenerate_face(const Face_triangulation& ft, const VPM& vpm) const
+  {
+    return const_mesh_ptr && collinear( get(vpm,ft.f_vertices[0]),
+                                        get(vpm,ft.f_vertices[1]),
+                                        get(vpm,ft.f_vertices[2]) );
+  }
+
   template <class OnFaceMapIterator, class VPM>
   void triangulate_intersected_faces(OnFaceMapIterator it,
                                      const VPM& vpm,
@@ -1204,165 +1562,65 @@ public:
 
     const Node_id nb_nodes = nodes.size();
 
+    // In parallel mode, the triangulations of the faces are built concurrently by batches,
+    // and then imported one after the other in the mesh, in the same order as in sequential mode.
+    // The parallel mode is not used to autorefine or with non-manifold features
+    // as the map node_id_to_vertex is then updated for each face.
+    std::vector<Face_triangulation> triangulations;
+    std::size_t batch_begin = 0, face_rank = 0;
+
     for (typename On_face_map::iterator it=on_face_map.begin();
-          it!=on_face_map.end();++it)
+          it!=on_face_map.end();++it, ++face_rank)
     {
+#ifdef CGAL_LINKED_WITH_TBB
+      if (parallel_mode && !doing_autorefinement && !handle_non_manifold_features &&
+          face_rank==batch_begin+triangulations.size())
+      {
+        batch_begin = face_rank;
+        build_face_triangulations_in_parallel(it, on_face_map.end(), tm, vpm, nodes, face_boundaries,
+                                              vertex_to_node_id, node_id_to_vertex, triangulations);
+      }
+#endif
+
       user_visitor.triangulating_faces_step();
       face_descriptor f = it->first; //the face to be triangulated
       Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
       typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
 
-      std::map<Node_id,typename CDT::Vertex_handle> id_to_CDT_vh;
-
-      //associate an edge of the triangulation to a halfedge in a given polyhedron
-      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
-
-      // the vertices of f
-      std::array<vertex_descriptor,3> f_vertices;
-      // the node_id of an input vertex or a fake id (>=nb_nodes)
-      std::array<Node_id,3> f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
-      if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
-        f_vertices[0]=it_fb->second.vertices[0];
-        f_vertices[1]=it_fb->second.vertices[1];
-        f_vertices[2]=it_fb->second.vertices[2];
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        if (doing_autorefinement || handle_non_manifold_features)
-          it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
-      }
-      else{
-        CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
-        halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
-        f_vertices[0]=target(h0,tm); //nb_nodes
-        f_vertices[1]=target(h1,tm); //nb_nodes+1
-        f_vertices[2]=target(h2,tm); //nb_nodes+2
-
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
-        edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
-        edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
-      }
+      Face_triangulation sequential_ft;
+      Face_triangulation& ft = (face_rank<batch_begin+triangulations.size() &&
+                                triangulations[face_rank-batch_begin].cdt!=nullptr)
+                             ? triangulations[face_rank-batch_begin]
+                             : sequential_ft;
 
-      // handle possible presence of degenerate faces
-      if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
+      if (ft.cdt==nullptr)
       {
-        Node_ids face_vertex_nids;
-
-        //check if one of the triangle input vertex is also a node
-        for (int ik=0;ik<3;++ik)
-          if ( f_indices[ik]<nb_nodes )
-            face_vertex_nids.push_back(f_indices[ik]);
-
-        // collect nodes on edges (if any)
-        if (it_fb != face_boundaries.end())
-        {
-          Face_boundary& f_boundary=it_fb->second;
-          for (int i=0;i<3;++i)
-            std::copy(f_boundary.node_ids_array[i].begin(),
-                      f_boundary.node_ids_array[i].end(),
-                      std::back_inserter(face_vertex_nids));
-        }
-
-        std::sort(face_vertex_nids.begin(), face_vertex_nids.end());
-        std::vector<std::array<std::pair<halfedge_descriptor,Node_id>,2>> constraints;
-        for(Node_id id : face_vertex_nids)
-        {
-          CGAL_assertion(id < graph_of_constraints.size());
-          const std::vector<Node_id>& neighbors=graph_of_constraints[id];
-          if (!neighbors.empty())
-          {
-            for(Node_id id_n :neighbors)
-            {
-              if (id_n<id) continue;
-              if (std::binary_search(face_vertex_nids.begin(), face_vertex_nids.end(), id_n))
-              {
-                vertex_descriptor vi = node_id_to_vertex.get_vertex(id),
-                                  vn = node_id_to_vertex.get_vertex(id_n);
-                bool is_face_border = false;
-                halfedge_descriptor h;
-
-                std::tie(h, is_face_border) = halfedge(vi,vn, tm);
-                if (is_face_border)
-                {
-                  call_put(marks_on_edges,tm,edge(h,tm),true);
-                  output_builder.set_edge_per_polyline(tm,std::make_pair(id, id_n),h);
-                }
-                else
-                {
-                  halfedge_descriptor hi=halfedge(vi, tm);
-                  while(face(hi, tm) != f)
-                    hi=opposite(next(hi, tm), tm);
-
-                  halfedge_descriptor hn=halfedge(vn, tm);
-                  while(face(hn, tm) != f)
-                    hn=opposite(next(hn, tm), tm);
-                  constraints.emplace_back(make_array(std::make_pair(hi,id),std::make_pair(hn, id_n)));
-                }
-              }
-            }
-          }
-          #ifdef CGAL_COREFINEMENT_DEBUG
-          else
-            std::cout << "X0bis: Found an isolated point" << std::endl;
-          #endif
-        }
-
-        CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
-        std::vector<face_descriptor> new_faces;
-        for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
-        {
-          halfedge_descriptor nh = Euler::split_face(a[0].first, a[1].first, tm);
-          new_faces.push_back(face(opposite(nh, tm), tm));
-
-          call_put(marks_on_edges,tm,edge(nh,tm),true);
-          output_builder.set_edge_per_polyline(tm,std::make_pair(a[0].second, a[1].second),nh);
-        }
+        init_face_triangulation(f, tm, it_fb, face_boundaries, nb_nodes,
+                                vertex_to_node_id, node_id_to_vertex, ft);
 
-        // now triangulate new faces
-        if (!new_faces.empty())
+        // handle possible presence of degenerate faces
+        if (is_degenerate_face(ft, vpm))
         {
-          new_faces.push_back(f);
-          for(face_descriptor nf : new_faces)
-          {
-            halfedge_descriptor h = halfedge(nf, tm),
-                                nh = next(next(h,tm),tm);
-            while(next(nh, tm)!=h)
-              nh=next(Euler::split_face(h, nh, tm), tm);
-          }
+          triangulate_degenerate_face(f, tm, ft.f_indices, it_fb, face_boundaries, nb_nodes, node_id_to_vertex);
+          continue;
         }
 
-        continue;
+        build_face_triangulation(tm, vpm, nodes, node_ids, it_fb, face_boundaries, nb_nodes, ft);
       }
 
-      typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
-                           q = nodes.to_exact(get(vpm,f_vertices[1])),
-                           r = nodes.to_exact(get(vpm,f_vertices[2]));
-///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
-      CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
-      CDT cdt(traits);
-
-      // insert triangle points
-      std::array<CDT_Vertex_handle,3> triangle_vertices;
-      //we can do this to_exact because these are supposed to be input points.
-      triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
-      triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
-      triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
-      triangle_vertices[2]->set_point(r);
-
-      triangle_vertices[0]->info()=f_indices[0];
-      triangle_vertices[1]->info()=f_indices[1];
-      triangle_vertices[2]->info()=f_indices[2];
+      const std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+      const std::array<Node_id,3>& f_indices = ft.f_indices;
+      CDT& cdt = *ft.cdt;
 
       node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
       node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
       node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
 
       //if one of the triangle input vertex is also a node
-      for (int ik=0;ik<3;++ik){
-        if ( f_indices[ik]<nb_nodes )
-        {
-          id_to_CDT_vh.insert(
-              std::make_pair(f_indices[ik],triangle_vertices[ik]));
-          if (doing_autorefinement || handle_non_manifold_features)
+      if (doing_autorefinement || handle_non_manifold_features)
+      {
+        for (int ik=0;ik<3;++ik){
+          if ( f_indices[ik]<nb_nodes )
             // update the current vertex in node_id_to_vertex
             // to match the one of the face
             node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
@@ -1371,89 +1629,6 @@ public:
             // is already tight and the call in Intersection_nodes::finalize() will not fix anything
         }
       }
-      //insert points on edges
-      if (it_fb!=face_boundaries.end()) //if f not a triangle?
-      {
-        // collect infinite faces incident to the initial triangle
-        typename CDT::Face_handle infinite_faces[3];
-        for (int i=0;i<3;++i)
-        {
-          int oi=-1;
-          CGAL_assertion_code(bool is_edge = )
-          cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
-          CGAL_assertion(is_edge);
-          CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
-        }
-
-        // In this loop, for each original edge of the triangle, we insert
-        // the constrained edges and we recover the halfedge_descriptor
-        // corresponding to these constrained (they are already in tm)
-        Face_boundary& f_boundary=it_fb->second;
-        for (int i=0;i<3;++i){
-          //handle case of halfedge starting at triangle_vertices[i]
-          // and ending at triangle_vertices[(i+1)%3]
-
-          const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
-          CDT_Vertex_handle previous=triangle_vertices[i];
-          Node_id prev_index=f_indices[i];// node-id of the mesh vertex
-          halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
-          CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
-          if (!ids_on_edge.empty()){ //is there at least one node on this edge?
-            // fh must be an infinite face
-            // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
-            for(Node_id id : ids_on_edge)
-            {
-              CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
-              vh->info()=id;
-              id_to_CDT_vh.insert(std::make_pair(id,vh));
-              edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
-              previous=vh;
-              hedge=next(hedge,tm);
-              prev_index=id;
-            }
-          }
-          else{
-          CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
-            CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
-            CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
-          }
-          CGAL_assertion(hedge==f_boundary.halfedges[i]);
-          edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
-            it_fb->second.halfedges[i];
-        }
-      }
-
-      //insert point inside face
-      for(Node_id node_id : node_ids)
-      {
-        CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
-        vh->info()=node_id;
-        id_to_CDT_vh.insert(std::make_pair(node_id,vh));
-      }
-
-      std::vector<std::pair<Node_id,Node_id> > constrained_edges;
-
-      // insert constraints that are interior to the triangle (in the case
-      // no edges are collinear in the meshes)
-      insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
-
-      // insert constraints between points that are on the boundary
-      // (not a constrained on the triangle boundary)
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (int i=0;i<3;++i)
-        {
-          Node_ids& ids=it_fb->second.node_ids_array[i];
-          insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
-        }
-      }
-
-      //insert coplanar edges for endpoints of triangles
-      for (int i=0;i<3;++i){
-        Node_id nindex=triangle_vertices[i]->info();
-        if ( nindex < nb_nodes )
-          insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
-      }
 
       //XSL_TAG_CPL_VERT
       //collect edges incident to a point that is the intersection of two
@@ -1500,7 +1675,7 @@ public:
 
       // import the triangle in `cdt` in the face `f` of `tm`
       triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
-        edge_to_hedge, cdt, vpm, output_builder, user_visitor);
+        ft.edge_to_hedge, cdt, vpm, output_builder, user_visitor);
 
       // TODO Here we do the update only for internal edges.
       // Update for border halfedges could be done during the split
@@ -1508,15 +1683,15 @@ public:
       //3) mark halfedges that are common to two polyhedral surfaces
       //recover halfedges inserted that are on the intersection
       typedef std::pair<Node_id,Node_id> Node_id_pair;
-      for(const Node_id_pair& node_id_pair : constrained_edges)
+      for(const Node_id_pair& node_id_pair : ft.constrained_edges)
       {
         typename std::map<Node_id_pair,halfedge_descriptor>
-          ::iterator it_poly_hedge=edge_to_hedge.find(node_id_pair);
+          ::iterator it_poly_hedge=ft.edge_to_hedge.find(node_id_pair);
         //we cannot have an assertion here in case an edge or part of an edge is a constraints.
         //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
         //is defined as one of them defines an adjacent face
         //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
-        if( it_poly_hedge!=edge_to_hedge.end() ){
+        if( it_poly_hedge!=ft.edge_to_hedge.end() ){
           call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
           output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
         }
@@ -1524,13 +1699,16 @@ public:
           //WARNING: in few case this is needed if the marked edge is on the border
           //to optimize it might be better to only use sorted pair. TAG_SLXX1
           Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
-          it_poly_hedge=edge_to_hedge.find(opposite_pair);
-          CGAL_assertion( it_poly_hedge!=edge_to_hedge.end() );
+          it_poly_hedge=ft.edge_to_hedge.find(opposite_pair);
+          CGAL_assertion( it_poly_hedge!=ft.edge_to_hedge.end() );
 
           call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
           output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
         }
       }
+
+      // the triangulation is no longer needed
+      ft.cdt.reset();
     }
   }
 
@@ -31,9 +31,16 @@
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace CGAL{
 namespace Polygon_mesh_processing {
@@ -238,6 +245,7 @@ class Intersection_of_triangle_meshes
   Non_manifold_feature_map<TriangleMesh> non_manifold_feature_map_1,
                                          non_manifold_feature_map_2;
   const TriangleMesh* const_mesh_ptr;
+  bool parallel_mode = false;
   static const constexpr std::size_t NM_NID = (std::numeric_limits<std::size_t>::max)();
   CGAL_assertion_code(bool doing_autorefinement;)
 
@@ -943,21 +951,66 @@ class Intersection_of_triangle_meshes
                                    Node_id& current_node)
   {
     typedef std::tuple<Intersection_type, halfedge_descriptor, bool,bool>  Inter_type;
+    typedef std::vector<std::pair<face_descriptor, Inter_type> >          Face_inter_types;
 
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    // In parallel mode, the intersection types of all the edge-face pairs are computed
+    // first and concurrently. The creation of the nodes depends on the order in which the
+    // pairs are handled and is done sequentially in the main loop that only reads the types.
+    std::vector<std::pair<edge_descriptor, Face_inter_types> > inter_types;
+#ifdef CGAL_LINKED_WITH_TBB
+    if (parallel_mode)
+    {
+      inter_types.reserve(tm1_edge_to_tm2_faces.size());
+      for(const typename Edge_to_faces::value_type& e_and_faces : tm1_edge_to_tm2_faces)
+      {
+        inter_types.emplace_back(e_and_faces.first, Face_inter_types());
+        for(face_descriptor f_2 : e_and_faces.second)
+          inter_types.back().second.emplace_back(f_2, Inter_type());
+      }
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, inter_types.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          {
+                            halfedge_descriptor h_1=halfedge(inter_types[i].first,tm1);
+                            for(std::pair<face_descriptor, Inter_type>& f_and_type : inter_types[i].second)
+                              f_and_type.second=intersection_type(h_1,f_and_type.first,tm1,tm2,vpm1,vpm2);
+                          }
+                        });
+    }
+#endif
+
+    std::size_t edge_rank=0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++edge_rank)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
 
+      const Face_inter_types* precomputed_types =
+        (edge_rank<inter_types.size() && inter_types[edge_rank].first==e_1)
+          ? &inter_types[edge_rank].second : nullptr;
+
       halfedge_descriptor h_1=halfedge(e_1,tm1);
       Face_set& fset=it->second;
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        Inter_type res;
+        bool is_precomputed=false;
+        if (precomputed_types!=nullptr)
+          for (const std::pair<face_descriptor, Inter_type>& f_and_type : *precomputed_types)
+            if (f_and_type.first==f_2)
+            {
+              res=f_and_type.second;
+              is_precomputed=true;
+              break;
+            }
+        if (!is_precomputed)
+          res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
@@ -1701,6 +1754,12 @@ public:
     CGAL_assertion_code( doing_autorefinement=true; )
   }
 
+// if `b` is `true`, the intersection types of the edge-face pairs are computed in parallel
+  void set_parallel_mode(bool b)
+  {
+    parallel_mode=b;
+  }
+
 // setting maps of non manifold features
   void set_non_manifold_feature_map_1(internal_np::Param_not_found){}
   void set_non_manifold_feature_map_2(internal_np::Param_not_found){}
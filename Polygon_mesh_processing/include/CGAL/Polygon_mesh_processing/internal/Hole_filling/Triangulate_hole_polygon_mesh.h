@@ -94,19 +94,43 @@ struct Tracer_polyhedron
   std::vector<halfedge_descriptor>& P;
 };
 
-// This function is used in test cases (since it returns not just OutputIterator but also Weight)
-template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
-std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
-triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
-            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
-            OutputIterator out,
-            VertexPointMap vpmap,
-            bool use_delaunay_triangulation,
-            const Kernel& k,
-            const bool use_cdt,
-            const bool skip_cubic_algorithm,
-            Visitor& visitor,
-            const typename Kernel::FT max_squared_distance)
+// records the lookup table used by a tracer, so that the triangulation can be applied later
+struct Tracer_recorder
+{
+  Tracer_recorder(CGAL::internal::Lookup_table_map<int>& lambda)
+    : lambda(lambda)
+  { }
+
+  template <class LookupTable>
+  void operator()(const LookupTable& lambda_, int i, int k)
+  {
+    if(i + 2 >= k)
+      return;
+
+    int la = lambda_.get(i, k);
+    lambda.put(i, k, la);
+    operator()(lambda_, i, la);
+    operator()(lambda_, la, k);
+  }
+
+  CGAL::internal::Lookup_table_map<int>& lambda;
+};
+
+// Computes the triangulation of a hole without modifying the mesh: the border halfedges of the hole
+// are put in `P_edges` and the triangulation is recorded in `lambda`, to be applied by `apply_hole_triangulation()`.
+template<class PolygonMesh, class VertexPointMap, class Kernel, class Visitor>
+CGAL::internal::Weight_min_max_dihedral_and_area
+compute_hole_triangulation(const PolygonMesh& pmesh,
+                           typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                           VertexPointMap vpmap,
+                           bool use_delaunay_triangulation,
+                           const Kernel& k,
+                           const bool use_cdt,
+                           const bool skip_cubic_algorithm,
+                           Visitor& visitor,
+                           const typename Kernel::FT max_squared_distance,
+                           std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor>& P_edges,
+                           CGAL::internal::Lookup_table_map<int>& lambda)
 {
 #ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
   CGAL_USE(use_cdt);
@@ -115,7 +139,6 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 
   typedef Halfedge_around_face_circulator<PolygonMesh>   Hedge_around_face_circulator;
   typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
-  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
   typedef typename Kernel::Point_3 Point_3;
 
   typedef std::map<vertex_descriptor, int>    Vertex_map;
@@ -126,9 +149,9 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #endif
 
   std::vector<Point_3> P, Q;
-  std::vector<halfedge_descriptor> P_edges;
   Vertex_map vertex_map;
 
+  P_edges.clear();
   int id = 0;
   Hedge_around_face_circulator circ(border_halfedge,pmesh), done(circ);
   do
@@ -143,7 +166,7 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #else
       std::cerr << "W: Returning no output. Non-manifold vertex is found on boundary!\n";
 #endif
-      return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+      return CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID();
     }
   } while (++circ != done);
 
@@ -189,12 +212,13 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 
   CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
 
-  // fill hole using polyline function, with custom tracer for PolygonMesh
-  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+  // fill hole using polyline function, recording the triangulation
+  lambda = CGAL::internal::Lookup_table_map<int>(id, -1);
+  Tracer_recorder tracer(lambda);
 
 #ifndef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
   if(use_cdt && triangulate_hole_polyline_with_cdt(P, tracer, visitor, is_valid, k, max_squared_distance))
-    return std::make_pair(tracer.out, CGAL::internal::Weight_min_max_dihedral_and_area(0,0));
+    return CGAL::internal::Weight_min_max_dihedral_and_area(0,0);
 #endif
   CGAL::internal::Weight_min_max_dihedral_and_area weight =
 #ifndef CGAL_USE_WEIGHT_INCOMPLETE
@@ -208,7 +232,47 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
   std::cerr << "Hole filling: " << timer.time() << " sc." << std::endl; timer.reset();
 #endif
 
-  return std::make_pair(tracer.out, weight);
+  return weight;
+}
+
+// adds to the mesh the faces of a triangulation computed by `compute_hole_triangulation()`
+template<class PolygonMesh, class OutputIterator>
+OutputIterator
+apply_hole_triangulation(PolygonMesh& pmesh,
+                         std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor>& P_edges,
+                         const CGAL::internal::Lookup_table_map<int>& lambda,
+                         OutputIterator out)
+{
+  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+  tracer(lambda, 0, static_cast<int>(P_edges.size()) - 1);
+  return tracer.out;
+}
+
+// This function is used in test cases (since it returns not just OutputIterator but also Weight)
+template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
+std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
+triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
+            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+            OutputIterator out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            Visitor& visitor,
+            const typename Kernel::FT max_squared_distance)
+{
+  std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor> P_edges;
+  CGAL::internal::Lookup_table_map<int> lambda(0, -1);
+
+  CGAL::internal::Weight_min_max_dihedral_and_area weight =
+    compute_hole_triangulation(pmesh, border_halfedge, vpmap, use_delaunay_triangulation, k, use_cdt,
+                               skip_cubic_algorithm, visitor, max_squared_distance, P_edges, lambda);
+
+  if(weight != CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID())
+    out = apply_hole_triangulation(pmesh, P_edges, lambda, out);
+
+  return std::make_pair(out, weight);
 }
 
 } // namespace internal
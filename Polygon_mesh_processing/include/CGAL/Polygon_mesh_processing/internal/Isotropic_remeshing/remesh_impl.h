@@ -36,6 +36,11 @@
 #include <boost/graph/graph_traits.hpp>
 #include <CGAL/tags.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <boost/bimap.hpp>
 #include <boost/bimap/multiset_of.hpp>
 #include <boost/bimap/set_of.hpp>
@@ -481,8 +486,8 @@ namespace internal {
     // "visits all edges of the mesh
     //if an edge is longer than the given threshold `high`, the edge
     //is split at its midpoint and the two adjacent triangles are bisected (2-4 split)"
-    template<typename SizingFunction>
-    void split_long_edges(SizingFunction& sizing)
+    template<typename SizingFunction, typename ConcurrencyTag = Sequential_tag>
+    void split_long_edges(SizingFunction& sizing, const ConcurrencyTag tag = ConcurrencyTag())
     {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       std::cout << "Split long edges..." << std::endl;
@@ -495,15 +500,14 @@ namespace internal {
         { return p1.second > p2.second; }
       );
 
-      for(edge_descriptor e : edges(mesh_))
-      {
-        if (!is_split_allowed(e))
-          continue;
-        const halfedge_descriptor he = halfedge(e, mesh_);
-        std::optional<double> sqlen = sizing.is_too_long(source(he, mesh_), target(he, mesh_), mesh_);
-        if(sqlen != std::nullopt)
-          long_edges.emplace(halfedge(e, mesh_), sqlen.value());
-      }
+      for(const H_and_sql& h_and_sql : collect_edges([&](const edge_descriptor e) -> std::optional<double>
+                                         {
+                                           if (!is_split_allowed(e))
+                                             return std::nullopt;
+                                           const halfedge_descriptor he = halfedge(e, mesh_);
+                                           return sizing.is_too_long(source(he, mesh_), target(he, mesh_), mesh_);
+                                         }, tag))
+        long_edges.insert(h_and_sql);
 
       //split long edges
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -627,9 +631,10 @@ namespace internal {
     // "collapses and thus removes all edges that are shorter than a
     // threshold `low`. [...] testing before each collapse whether the collapse
     // would produce an edge that is longer than `high`"
-    template<typename SizingFunction>
+    template<typename SizingFunction, typename ConcurrencyTag = Sequential_tag>
     void collapse_short_edges(const SizingFunction& sizing,
-                              const bool collapse_constraints)
+                              const bool collapse_constraints,
+                              const ConcurrencyTag tag = ConcurrencyTag())
     {
       typedef boost::bimap<
         boost::bimaps::set_of<halfedge_descriptor>,
@@ -646,13 +651,16 @@ namespace internal {
 #endif
 
       Boost_bimap short_edges;
-      for(edge_descriptor e : edges(mesh_))
-      {
-        std::optional<double> sqlen = sizing.is_too_short(halfedge(e, mesh_), mesh_);
-        if(sqlen != std::nullopt
-          && is_collapse_allowed(e, collapse_constraints))
-          short_edges.insert(short_edge(halfedge(e, mesh_), sqlen.value()));
-      }
+      for(const std::pair<halfedge_descriptor, double>& h_and_sql :
+            collect_edges([&](const edge_descriptor e) -> std::optional<double>
+                          {
+                            std::optional<double> sqlen = sizing.is_too_short(halfedge(e, mesh_), mesh_);
+                            if(sqlen != std::nullopt
+                              && is_collapse_allowed(e, collapse_constraints))
+                              return sqlen;
+                            return std::nullopt;
+                          }, tag))
+        short_edges.insert(short_edge(h_and_sql.first, h_and_sql.second));
 #ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
       std::cout << "done." << std::endl;
 #endif
@@ -1014,11 +1022,12 @@ namespace internal {
     // "applies an iterative smoothing filter to the mesh.
     // The vertex movement has to be constrained to the vertex tangent plane [...]
     // smoothing algorithm with uniform Laplacian weights"
-    template <class SizingFunction, typename AllowMoveFunctor>
+    template <class SizingFunction, typename AllowMoveFunctor, typename ConcurrencyTag = Sequential_tag>
     void tangential_relaxation_impl(const bool relax_constraints/*1d smoothing*/
                                   , const unsigned int nb_iterations
                                   , const SizingFunction& sizing
-                                  , const AllowMoveFunctor& shall_move)
+                                  , const AllowMoveFunctor& shall_move
+                                  , const ConcurrencyTag tag = ConcurrencyTag())
     {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       std::cout << "Tangential relaxation (" << nb_iterations << " iter.)...";
@@ -1065,6 +1074,7 @@ namespace internal {
             .vertex_is_constrained_map(constrained_vertices_pmap)
             .relax_constraints(relax_constraints)
             .allow_move_functor(shall_move)
+            .concurrency_tag(tag)
         );
       }
       else
@@ -1084,6 +1094,7 @@ namespace internal {
             .relax_constraints(relax_constraints)
             .sizing_function(sizing)
             .allow_move_functor(shall_move)
+            .concurrency_tag(tag)
         );
       }
 
@@ -1102,7 +1113,8 @@ namespace internal {
 
     // PMP book :
     // "maps the vertices back to the surface"
-    void project_to_surface(internal_np::Param_not_found)
+    template <typename ConcurrencyTag = Sequential_tag>
+    void project_to_surface(internal_np::Param_not_found, const ConcurrencyTag tag = ConcurrencyTag())
     {
       //todo : handle the case of boundary vertices
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -1110,15 +1122,15 @@ namespace internal {
       std::cout.flush();
 #endif
 
-      for(vertex_descriptor v : vertices(mesh_))
+      for_each_vertex_to_project([&](const vertex_descriptor v)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
         //note if v is constrained, it has not moved
-
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
+        // (a patch without any tree is mapped to the first tree)
+        typename Patch_id_to_index_map::const_iterator it
+          = patch_id_to_index_map.find(get_patch_id(face(halfedge(v, mesh_), mesh_)));
+        Point proj = trees[it == patch_id_to_index_map.end() ? 0 : it->second]->closest_point(get(vpmap_, v));
         put(vpmap_, v, proj);
-      }
+      }, tag);
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1132,21 +1144,19 @@ namespace internal {
 #endif
     }
 
-    template <class ProjectionFunctor>
-    void project_to_surface(const ProjectionFunctor& proj)
+    template <class ProjectionFunctor, typename ConcurrencyTag = Sequential_tag>
+    void project_to_surface(const ProjectionFunctor& proj, const ConcurrencyTag tag = ConcurrencyTag())
     {
       //todo : handle the case of boundary vertices
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       std::cout << "Project to surface...";
       std::cout.flush();
 #endif
-      for(vertex_descriptor v : vertices(mesh_))
+      for_each_vertex_to_project([&](const vertex_descriptor v)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
         //note if v is constrained, it has not moved
         put(vpmap_, v,  proj(v));
-      }
+      }, tag);
       CGAL_assertion(is_valid(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1161,6 +1171,71 @@ namespace internal {
     }
 
 private:
+  // returns the pairs made of `halfedge(e, mesh_)` and `*sqlen(e)` for all the edges `e` of the mesh
+  // such that `sqlen(e)` is set, in the order of the edges. `sqlen` is evaluated in parallel
+  // if `ConcurrencyTag` is `Parallel_tag`.
+  template <typename SquaredLength, typename ConcurrencyTag>
+  std::vector<std::pair<halfedge_descriptor, double> >
+  collect_edges(const SquaredLength& sqlen, const ConcurrencyTag) const
+  {
+    std::vector<std::pair<halfedge_descriptor, double> > res;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      const std::vector<edge_descriptor> es(std::begin(edges(mesh_)), std::end(edges(mesh_)));
+      std::vector<std::optional<double> > sqlens(es.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, es.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            sqlens[i] = sqlen(es[i]);
+                        });
+      for(std::size_t i=0; i<es.size(); ++i)
+        if(sqlens[i] != std::nullopt)
+          res.emplace_back(halfedge(es[i], mesh_), sqlens[i].value());
+      return res;
+    }
+#endif
+
+    for(edge_descriptor e : edges(mesh_))
+    {
+      std::optional<double> l = sqlen(e);
+      if(l != std::nullopt)
+        res.emplace_back(halfedge(e, mesh_), l.value());
+    }
+    return res;
+  }
+
+  // calls `f(v)` on the vertices to be projected, in parallel if `ConcurrencyTag` is `Parallel_tag`
+  template <typename Functor, typename ConcurrencyTag>
+  void for_each_vertex_to_project(const Functor& f, const ConcurrencyTag)
+  {
+    auto to_project = [&](const vertex_descriptor v)
+    {
+      return !(is_constrained(v) || is_isolated(v) || !is_on_patch(v));
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      const std::vector<vertex_descriptor> vs(std::begin(vertices(mesh_)), std::end(vertices(mesh_)));
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vs.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            if(to_project(vs[i]))
+                              f(vs[i]);
+                        });
+      return;
+    }
+#endif
+
+    for(vertex_descriptor v : vertices(mesh_))
+      if(to_project(v))
+        f(v);
+  }
+
   Patch_id get_patch_id(const face_descriptor& f) const
   {
     if (f == boost::graph_traits<PM>::null_face())
@@ -24,6 +24,8 @@
 #include <CGAL/Timer.h>
 #endif
 #include <iterator>
+#include <utility>
+#include <vector>
 
 namespace CGAL {
 
@@ -111,10 +113,12 @@ private:
   }
 
 public:
+  // computes the new points of the vertices of the range, without moving them
   template<class VertexRange>
-  bool fair(const VertexRange& vertices
+  bool compute_fair_points(const VertexRange& vertices
     , SparseLinearSolver solver
-    , unsigned int fc)
+    , unsigned int fc
+    , std::vector<std::pair<vertex_descriptor, Point_3> >& fair_points)
   {
     int depth = static_cast<int>(fc) + 1;
     if(depth < 0 || depth > 3) {
@@ -124,7 +128,7 @@ public:
 
     std::set<vertex_descriptor> interior_vertices(std::begin(vertices),
                                                   std::end(vertices));
-    if(interior_vertices.empty()) { return true; }
+    if(interior_vertices.empty()) { fair_points.clear(); return true; }
 
     #ifdef CGAL_PMP_FAIR_DEBUG
     CGAL::Timer timer; timer.start();
@@ -190,13 +194,29 @@ public:
 
     // update
     id = 0;
+    fair_points.clear();
+    fair_points.reserve(nb_vertices);
     for(vertex_descriptor vd : interior_vertices)
     {
-      put(ppmap, vd, Point_3(X[id], Y[id], Z[id]));
+      fair_points.emplace_back(vd, Point_3(X[id], Y[id], Z[id]));
       ++id;
     }
     return true;
   }
+
+  template<class VertexRange>
+  bool fair(const VertexRange& vertices
+    , SparseLinearSolver solver
+    , unsigned int fc)
+  {
+    std::vector<std::pair<vertex_descriptor, Point_3> > fair_points;
+    if(!compute_fair_points(vertices, solver, fc, fair_points))
+      return false;
+
+    for(const std::pair<vertex_descriptor, Point_3>& vp : fair_points)
+      put(ppmap, vp.first, vp.second);
+    return true;
+  }
 };
 
 }//namespace internal
@@ -0,0 +1,753 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_NARY_BOOLEAN_OPERATIONS_H
+#define CGAL_POLYGON_MESH_PROCESSING_NARY_BOOLEAN_OPERATIONS_H
+
+#include <CGAL/license/Polygon_mesh_processing/corefinement.h>
+
+#include <CGAL/Polygon_mesh_processing/autorefinement.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Side_of_triangle_mesh.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/Union_find.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+namespace Corefinement {
+
+/// \ingroup PMP_corefinement_grp
+/// Boolean operations available in `compute_nary_boolean_operation()`
+enum Nary_boolean_operation_type { NARY_UNION = 0, NARY_INTERSECTION, NARY_DIFFERENCE };
+
+} // end of namespace Corefinement
+
+namespace internal {
+
+// records, for each triangle of the refined soup, the triangle of the input soup it comes from
+struct Nary_boolean_autoref_visitor
+{
+  std::vector<std::size_t>* out_to_in;
+
+  void number_of_output_triangles(std::size_t nbt) { out_to_in->resize(nbt); }
+  void verbatim_triangle_copy(std::size_t tgt_id, std::size_t src_id) { (*out_to_in)[tgt_id] = src_id; }
+  void new_subtriangle(std::size_t tgt_id, std::size_t src_id) { (*out_to_in)[tgt_id] = src_id; }
+};
+
+// rotates the triangle so that its smallest point id comes first, keeping its orientation
+inline std::array<std::size_t, 3> canonical_triangle(const std::array<std::size_t, 3>& t)
+{
+  std::array<std::size_t, 3> c = t;
+  std::rotate(c.begin(), std::min_element(c.begin(), c.end()), c.end());
+  return c;
+}
+
+// A triangle of the refined soup coincides with another one when both have the same three vertices
+// (coplanar faces of different inputs are refined the same way by the autorefinement).
+struct Nary_coincident_triangle
+{
+  std::size_t mesh_id;
+  bool same_orientation;
+};
+
+template <class TriangleMeshRange, class GT, class VPM>
+class Nary_boolean_operation
+{
+  typedef typename std::iterator_traits<typename TriangleMeshRange::const_iterator>::value_type TriangleMesh;
+  typedef typename boost::graph_traits<TriangleMesh>::halfedge_descriptor     halfedge_descriptor;
+  typedef typename boost::graph_traits<TriangleMesh>::face_descriptor         face_descriptor;
+  typedef typename GetInitializedVertexIndexMap<TriangleMesh>::const_type     VIM;
+  typedef typename GetInitializedFaceIndexMap<TriangleMesh>::const_type       FIM;
+
+  typedef typename GT::Point_3                                                Point_3;
+  typedef typename GT::Triangle_3                                             Triangle_3;
+  typedef typename GT::FT                                                     FT;
+  typedef std::array<std::size_t, 3>                                          Triangle;
+
+  typedef AABB_face_graph_triangle_primitive<TriangleMesh, VPM>               Primitive;
+  typedef AABB_traits_3<GT, Primitive>                                        AABB_traits;
+  typedef AABB_tree<AABB_traits>                                              Tree;
+  typedef Side_of_triangle_mesh<TriangleMesh, GT, VPM, Tree>                  Side_of_mesh;
+
+  // location of a face of an input with respect to another input
+  enum Face_location { UNKNOWN_LOCATION = 0, INTERSECTING, INSIDE, OUTSIDE };
+  // what is done with a face of an input
+  enum Face_status { COPIED_FACE = 0, REFINED_FACE, DISCARDED_FACE };
+
+  const GT& gt;
+
+  std::vector<const TriangleMesh*> mesh_ptrs;
+  std::vector<VIM> vims;
+  std::vector<FIM> fims;
+  std::vector<std::unique_ptr<Tree> > trees;
+  std::vector<std::unique_ptr<Side_of_mesh> > side_of_meshes;
+
+  // the refined soup
+  std::vector<Point_3> points;
+  std::vector<Triangle> triangles;
+  std::vector<std::size_t> triangle_mesh_ids;
+
+  // the triangles sharing the vertices of a triangle, coming from other inputs
+  std::vector<std::vector<Nary_coincident_triangle> > coincident_triangles;
+
+  // the patches, sets of triangles of the same input bounded by intersection edges
+  std::vector<std::size_t> triangle_patch_ids;
+  std::vector<std::vector<std::size_t> > patches;
+
+public:
+  Nary_boolean_operation(const TriangleMeshRange& meshes, const GT& gt)
+    : gt(gt)
+  {
+    for(const TriangleMesh& tm : meshes)
+    {
+      mesh_ptrs.push_back(&tm);
+      vims.push_back(get_initialized_vertex_index_map(tm));
+      fims.push_back(get_initialized_face_index_map(tm));
+    }
+  }
+
+  // builds the AABB trees of the inputs, used both for culling and for classifying the patches
+  template <class ConcurrencyTag>
+  void build_trees()
+  {
+    const std::size_t nb_meshes = mesh_ptrs.size();
+    trees.resize(nb_meshes);
+    side_of_meshes.resize(nb_meshes);
+
+    auto build_tree = [&](std::size_t mesh_id)
+    {
+      const TriangleMesh& tm = *mesh_ptrs[mesh_id];
+      trees[mesh_id] = std::make_unique<Tree>(faces(tm).first, faces(tm).second, tm, get(vertex_point, tm));
+      trees[mesh_id]->build();
+      side_of_meshes[mesh_id] = std::make_unique<Side_of_mesh>(*trees[mesh_id], gt);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_meshes),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t mesh_id=r.begin(); mesh_id!=r.end(); ++mesh_id)
+                            build_tree(mesh_id);
+                        });
+    }
+    else
+#endif
+    {
+      for(std::size_t mesh_id=0; mesh_id<nb_meshes; ++mesh_id)
+        build_tree(mesh_id);
+    }
+  }
+
+private:
+  // Sets the location of the faces of the input `mesh_id` with respect to the input `other_id`.
+  // The faces intersecting no face of `other_id` are gathered in connected components,
+  // and the location of each component is computed once.
+  void locate_faces(std::size_t mesh_id, std::size_t other_id, std::vector<Face_location>& locations) const
+  {
+    const TriangleMesh& tm = *mesh_ptrs[mesh_id];
+    const VPM vpm = get(vertex_point, tm);
+    const Bbox_3 other_bbox = trees[other_id]->bbox();
+
+    locations.assign(num_faces(tm), UNKNOWN_LOCATION);
+    for(face_descriptor f : faces(tm))
+    {
+      const halfedge_descriptor h = halfedge(f, tm);
+      const Triangle_3 t(get(vpm, source(h, tm)), get(vpm, target(h, tm)), get(vpm, target(next(h, tm), tm)));
+      if(!do_overlap(t.bbox(), other_bbox))
+        locations[get(fims[mesh_id], f)] = OUTSIDE;
+      else if(trees[other_id]->do_intersect(t))
+        locations[get(fims[mesh_id], f)] = INTERSECTING;
+    }
+
+    std::vector<face_descriptor> component, queue;
+    std::vector<bool> visited(num_faces(tm), false);
+    for(face_descriptor seed : faces(tm))
+    {
+      const std::size_t seed_id = get(fims[mesh_id], seed);
+      if(visited[seed_id] || locations[seed_id] == INTERSECTING)
+        continue;
+
+      component.clear();
+      queue.assign(1, seed);
+      visited[seed_id] = true;
+      bool is_outside = false;
+      while(!queue.empty())
+      {
+        const face_descriptor f = queue.back();
+        queue.pop_back();
+        component.push_back(f);
+        is_outside = is_outside || (locations[get(fims[mesh_id], f)] == OUTSIDE);
+        for(halfedge_descriptor h : halfedges_around_face(halfedge(f, tm), tm))
+        {
+          const halfedge_descriptor oh = opposite(h, tm);
+          if(is_border(oh, tm))
+            continue;
+          const std::size_t nid = get(fims[mesh_id], face(oh, tm));
+          if(!visited[nid] && locations[nid] != INTERSECTING)
+          {
+            visited[nid] = true;
+            queue.push_back(face(oh, tm));
+          }
+        }
+      }
+
+      // none of the faces of the component intersects the other input: any vertex can be used
+      if(!is_outside)
+        is_outside = (*side_of_meshes[other_id])(get(vpm, target(halfedge(seed, tm), tm))) != ON_BOUNDED_SIDE;
+      for(face_descriptor f : component)
+        locations[get(fims[mesh_id], f)] = is_outside ? OUTSIDE : INSIDE;
+    }
+  }
+
+  // Returns the status of each face of the input `mesh_id`. The faces that intersect no other input
+  // are copied as they are, and the faces that are entirely inside (resp. outside) another input
+  // and that cannot be part of the result whatever the other inputs are, are discarded.
+  std::vector<Face_status> face_statuses(std::size_t mesh_id, Corefinement::Nary_boolean_operation_type op) const
+  {
+    const TriangleMesh& tm = *mesh_ptrs[mesh_id];
+    const Bbox_3 bbox = trees[mesh_id]->bbox();
+
+    std::vector<Face_status> statuses(num_faces(tm), COPIED_FACE);
+    std::vector<Face_location> locations;
+    for(std::size_t other_id=0; other_id<mesh_ptrs.size(); ++other_id)
+    {
+      if(other_id == mesh_id)
+        continue;
+
+      const bool other_is_first = (op == Corefinement::NARY_DIFFERENCE && other_id == 0);
+      const bool discard_outside = (op == Corefinement::NARY_INTERSECTION) || other_is_first;
+      const bool discard_inside = (op != Corefinement::NARY_INTERSECTION) && !other_is_first;
+
+      if(!do_overlap(bbox, trees[other_id]->bbox()))
+      {
+        if(discard_outside)
+          return std::vector<Face_status>(num_faces(tm), DISCARDED_FACE);
+        continue;
+      }
+
+      locate_faces(mesh_id, other_id, locations);
+      for(std::size_t fid=0; fid<locations.size(); ++fid)
+      {
+        if((discard_outside && locations[fid] == OUTSIDE) || (discard_inside && locations[fid] == INSIDE))
+          statuses[fid] = DISCARDED_FACE;
+        else if(locations[fid] == INTERSECTING && statuses[fid] == COPIED_FACE)
+          statuses[fid] = REFINED_FACE;
+      }
+    }
+    return statuses;
+  }
+
+public:
+  // Builds the soup of the input triangles that might contribute to the output, and refines
+  // the ones intersecting other inputs in a single intersection pass. The other triangles
+  // have no intersection point on their edges and are appended as they are.
+  template <class ConcurrencyTag>
+  void refine(Corefinement::Nary_boolean_operation_type op)
+  {
+    const std::size_t nb_meshes = mesh_ptrs.size();
+
+    std::vector<std::vector<Face_status> > statuses(nb_meshes);
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_meshes),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t mesh_id=r.begin(); mesh_id!=r.end(); ++mesh_id)
+                            statuses[mesh_id] = face_statuses(mesh_id, op);
+                        });
+    }
+    else
+#endif
+    {
+      for(std::size_t mesh_id=0; mesh_id<nb_meshes; ++mesh_id)
+        statuses[mesh_id] = face_statuses(mesh_id, op);
+    }
+
+    std::vector<Triangle> copied_triangles;
+    std::vector<std::size_t> copied_mesh_ids, refined_mesh_ids;
+    for(std::size_t mesh_id=0; mesh_id<nb_meshes; ++mesh_id)
+    {
+      const TriangleMesh& tm = *mesh_ptrs[mesh_id];
+      const VPM vpm = get(vertex_point, tm);
+
+      const std::size_t offset = points.size();
+      points.resize(offset + num_vertices(tm));
+      for(auto v : vertices(tm))
+        points[offset + get(vims[mesh_id], v)] = get(vpm, v);
+
+      for(face_descriptor f : faces(tm))
+      {
+        const Face_status status = statuses[mesh_id][get(fims[mesh_id], f)];
+        if(status == DISCARDED_FACE)
+          continue;
+        const halfedge_descriptor h = halfedge(f, tm);
+        const Triangle t = CGAL::make_array(offset + get(vims[mesh_id], source(h, tm)),
+                                            offset + get(vims[mesh_id], target(h, tm)),
+                                            offset + get(vims[mesh_id], target(next(h, tm), tm)));
+        if(status == REFINED_FACE)
+        {
+          triangles.push_back(t);
+          refined_mesh_ids.push_back(mesh_id);
+        }
+        else
+        {
+          copied_triangles.push_back(t);
+          copied_mesh_ids.push_back(mesh_id);
+        }
+      }
+    }
+
+    std::vector<std::size_t> out_to_in;
+    Nary_boolean_autoref_visitor visitor{&out_to_in};
+    autorefine_triangle_soup(points, triangles,
+                             parameters::visitor(visitor)
+                                        .concurrency_tag(ConcurrencyTag())
+                                        .geom_traits(gt));
+
+    CGAL_assertion(out_to_in.size() == triangles.size());
+    triangle_mesh_ids.resize(triangles.size());
+    for(std::size_t ti=0; ti<triangles.size(); ++ti)
+      triangle_mesh_ids[ti] = refined_mesh_ids[out_to_in[ti]];
+
+    triangles.insert(triangles.end(), copied_triangles.begin(), copied_triangles.end());
+    triangle_mesh_ids.insert(triangle_mesh_ids.end(), copied_mesh_ids.begin(), copied_mesh_ids.end());
+  }
+
+  // gathers the triangles in patches and detects the triangles shared by several inputs
+  void build_patches()
+  {
+    const std::size_t nbt = triangles.size();
+
+    // coincident triangles
+    coincident_triangles.assign(nbt, std::vector<Nary_coincident_triangle>());
+    std::vector<std::pair<Triangle, std::size_t> > sorted_triangles;
+    sorted_triangles.reserve(nbt);
+    for(std::size_t ti=0; ti<nbt; ++ti)
+    {
+      Triangle t = triangles[ti];
+      std::sort(t.begin(), t.end());
+      sorted_triangles.emplace_back(t, ti);
+    }
+    std::sort(sorted_triangles.begin(), sorted_triangles.end());
+
+    for(std::size_t i=0; i<nbt; )
+    {
+      std::size_t j = i+1;
+      while(j<nbt && sorted_triangles[j].first == sorted_triangles[i].first)
+        ++j;
+      for(std::size_t k=i; k<j; ++k)
+      {
+        const std::size_t tk = sorted_triangles[k].second;
+        const Triangle ck = canonical_triangle(triangles[tk]);
+        for(std::size_t l=i; l<j; ++l)
+        {
+          const std::size_t tl = sorted_triangles[l].second;
+          if(l != k && triangle_mesh_ids[tl] != triangle_mesh_ids[tk])
+            coincident_triangles[tk].push_back({ triangle_mesh_ids[tl], canonical_triangle(triangles[tl]) == ck });
+        }
+      }
+      i = j;
+    }
+
+    // patches: two triangles of the same input are in the same patch if they share an edge
+    // incident to no other triangle and are not coincident with triangles of other inputs
+    typedef Union_find<std::size_t>                                           UF;
+    UF uf;
+    std::vector<typename UF::handle> handles;
+    handles.reserve(nbt);
+    for(std::size_t ti=0; ti<nbt; ++ti)
+      handles.push_back(uf.make_set(ti));
+
+    std::vector<std::pair<std::pair<std::size_t, std::size_t>, std::size_t> > edges;
+    edges.reserve(3*nbt);
+    for(std::size_t ti=0; ti<nbt; ++ti)
+      for(int i=0; i<3; ++i)
+      {
+        std::size_t a = triangles[ti][i], b = triangles[ti][(i+1)%3];
+        if(b < a)
+          std::swap(a, b);
+        edges.emplace_back(std::make_pair(a, b), ti);
+      }
+    std::sort(edges.begin(), edges.end());
+
+    for(std::size_t i=0; i<edges.size(); )
+    {
+      std::size_t j = i+1;
+      while(j<edges.size() && edges[j].first == edges[i].first)
+        ++j;
+      if(j == i+2)
+      {
+        const std::size_t t1 = edges[i].second, t2 = edges[i+1].second;
+        if(triangle_mesh_ids[t1] == triangle_mesh_ids[t2] &&
+           coincident_triangles[t1].empty() && coincident_triangles[t2].empty())
+          uf.unify_sets(handles[t1], handles[t2]);
+      }
+      i = j;
+    }
+
+    triangle_patch_ids.assign(nbt, nbt);
+    std::vector<std::size_t> root_patch_ids(nbt, nbt);
+    for(std::size_t ti=0; ti<nbt; ++ti)
+    {
+      std::size_t& pid = root_patch_ids[*uf.find(handles[ti])];
+      if(pid == nbt)
+      {
+        pid = patches.size();
+        patches.emplace_back();
+      }
+      triangle_patch_ids[ti] = pid;
+      patches[pid].push_back(ti);
+    }
+  }
+
+private:
+  // a point in the interior of the patch, the centroid of its largest triangle
+  Point_3 patch_point(const std::vector<std::size_t>& patch) const
+  {
+    typename GT::Compute_squared_area_3 squared_area = gt.compute_squared_area_3_object();
+    typename GT::Construct_centroid_3 centroid = gt.construct_centroid_3_object();
+
+    std::size_t best = patch.front();
+    FT best_area = squared_area(points[triangles[best][0]], points[triangles[best][1]], points[triangles[best][2]]);
+    for(std::size_t ti : patch)
+    {
+      const FT a = squared_area(points[triangles[ti][0]], points[triangles[ti][1]], points[triangles[ti][2]]);
+      if(best_area < a)
+      {
+        best_area = a;
+        best = ti;
+      }
+    }
+    return centroid(points[triangles[best][0]], points[triangles[best][1]], points[triangles[best][2]]);
+  }
+
+  bool is_coincident_with(const std::vector<Nary_coincident_triangle>& coincident, std::size_t mesh_id) const
+  {
+    for(const Nary_coincident_triangle& ct : coincident)
+      if(ct.mesh_id == mesh_id)
+        return true;
+    return false;
+  }
+
+  // Returns 0 if the patch is not part of the output, 1 if it is kept as is, and -1 if it is kept reversed.
+  // The location of the patch with respect to the inputs it does not coincide with is evaluated once.
+  int classify(const std::vector<std::size_t>& patch, Corefinement::Nary_boolean_operation_type op) const
+  {
+    const std::size_t mesh_id = triangle_mesh_ids[patch.front()];
+    const std::vector<Nary_coincident_triangle>& coincident = coincident_triangles[patch.front()];
+    CGAL_assertion(coincident.empty() || patch.size() == 1);
+
+    // coincident triangles: only the one of the input with the smallest index is kept,
+    // and none of them if the inputs are on opposite sides of the triangle
+    bool has_same_orientation = false, has_opposite_orientation = false;
+    bool has_smaller_same_orientation = false;
+    for(const Nary_coincident_triangle& ct : coincident)
+    {
+      if(op == Corefinement::NARY_DIFFERENCE && (ct.mesh_id == 0 || mesh_id == 0))
+      {
+        if(ct.same_orientation)
+          has_same_orientation = true;
+        continue;
+      }
+      if(ct.same_orientation)
+      {
+        if(ct.mesh_id < mesh_id)
+          has_smaller_same_orientation = true;
+      }
+      else
+        has_opposite_orientation = true;
+    }
+
+    if(has_opposite_orientation || has_smaller_same_orientation)
+      return 0;
+
+    const std::size_t nb_meshes = mesh_ptrs.size();
+    const Point_3 p = patch_point(patch);
+
+    switch(op)
+    {
+      case Corefinement::NARY_UNION:
+        for(std::size_t k=0; k<nb_meshes; ++k)
+          if(k != mesh_id && !is_coincident_with(coincident, k) &&
+             (*side_of_meshes[k])(p) != ON_UNBOUNDED_SIDE)
+            return 0;
+        return 1;
+      case Corefinement::NARY_INTERSECTION:
+        for(std::size_t k=0; k<nb_meshes; ++k)
+          if(k != mesh_id && !is_coincident_with(coincident, k) &&
+             (*side_of_meshes[k])(p) != ON_BOUNDED_SIDE)
+            return 0;
+        return 1;
+      default: // NARY_DIFFERENCE
+        if(mesh_id == 0)
+        {
+          // the boundary of the first input that is outside of all the others
+          if(has_same_orientation)
+            return 0;
+          for(std::size_t k=1; k<nb_meshes; ++k)
+            if(!is_coincident_with(coincident, k) && (*side_of_meshes[k])(p) != ON_UNBOUNDED_SIDE)
+              return 0;
+          return 1;
+        }
+        // the boundary of the other inputs that is strictly inside the first input and outside of the others
+        if(is_coincident_with(coincident, 0) || (*side_of_meshes[0])(p) != ON_BOUNDED_SIDE)
+          return 0;
+        for(std::size_t k=1; k<nb_meshes; ++k)
+          if(k != mesh_id && !is_coincident_with(coincident, k) &&
+             (*side_of_meshes[k])(p) != ON_UNBOUNDED_SIDE)
+            return 0;
+        return -1;
+    }
+  }
+
+public:
+  // classifies every patch once, and builds the soup of the output triangles
+  template <class ConcurrencyTag, class TriangleMeshOut, class NamedParametersOut>
+  bool extract(Corefinement::Nary_boolean_operation_type op, TriangleMeshOut& tm_out, const NamedParametersOut& np_out)
+  {
+    std::vector<int> patch_status(patches.size(), 0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, patches.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t pid=r.begin(); pid!=r.end(); ++pid)
+                            patch_status[pid] = classify(patches[pid], op);
+                        });
+    }
+    else
+#endif
+    {
+      for(std::size_t pid=0; pid<patches.size(); ++pid)
+        patch_status[pid] = classify(patches[pid], op);
+    }
+
+    std::vector<Triangle> output_triangles;
+    for(std::size_t ti=0; ti<triangles.size(); ++ti)
+    {
+      const int status = patch_status[triangle_patch_ids[ti]];
+      if(status == 1)
+        output_triangles.push_back(triangles[ti]);
+      else if(status == -1)
+        output_triangles.push_back(CGAL::make_array(triangles[ti][0], triangles[ti][2], triangles[ti][1]));
+    }
+
+    std::vector<Point_3> output_points = points;
+    remove_isolated_points_in_polygon_soup(output_points, output_triangles);
+
+    if(!is_polygon_soup_a_polygon_mesh(output_triangles))
+      return false;
+
+    clear(tm_out);
+    polygon_soup_to_polygon_mesh(output_points, output_triangles, tm_out, parameters::default_values(), np_out);
+    return true;
+  }
+};
+
+} // end of namespace internal
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * computes a Boolean operation of all the volumes bounded by the triangle meshes of `meshes`:
+ * their union, their intersection, or the difference of the first one with all the others.
+ *
+ * Contrary to chaining calls to `corefine_and_compute_union()` (or to the other binary operations),
+ * the input meshes are refined together in a single pass of intersection detection, using
+ * `autorefine_triangle_soup()` on the soup made of the triangles of the inputs that intersect
+ * other inputs. Triangles that are entirely inside (or outside) another input and cannot be part
+ * of the result are discarded beforehand, and triangles intersecting no other input are kept as they are.
+ * The triangles are then gathered in patches bounded by the intersection polylines,
+ * and the location of each patch with respect to each of the other inputs is evaluated once.
+ * Faces shared by several inputs are handled as in the binary operations: they are in the output
+ * if the inputs are on the same side of the face, and only one copy is kept.
+ *
+ * If the output is not a valid triangle mesh (for example if two inputs share only an edge),
+ * `false` is returned and `tm_out` is not modified.
+ *
+ * \pre `CGAL::is_triangle_mesh(tm)` for each mesh `tm` of `meshes`
+ * \pre `CGAL::Polygon_mesh_processing::does_self_intersect(tm) == false` for each mesh `tm` of `meshes`
+ * \pre `CGAL::Polygon_mesh_processing::does_bound_a_volume(tm) == true` for each mesh `tm` of `meshes`
+ *
+ * @tparam TriangleMeshRange a model of `ConstRange` whose value type is a model of `HalfedgeListGraph`,
+ *                           `FaceListGraph`, and `FaceGraph` with an internal property map for `CGAL::vertex_point_t`
+ * @tparam TriangleMeshOut a model of `MutableFaceGraph`, `HalfedgeListGraph`, and `FaceListGraph`
+ * @tparam NamedParametersIn a sequence of \ref bgl_namedparameters "Named Parameters"
+ * @tparam NamedParametersOut a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * @param meshes the input triangle meshes, that are not modified
+ * @param op the Boolean operation to compute. For `Corefinement::NARY_DIFFERENCE`, the first
+ *           mesh of `meshes` is the one all the others are subtracted from.
+ * @param tm_out the output triangle mesh. It is cleared before being filled with the result.
+ * @param np_in an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ * @param np_out an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin{Input}
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *   \cgalParamNEnd
+ *   \cgalParamNBegin{geom_traits}
+ *     \cgalParamDescription{an instance of a geometric traits class}
+ *     \cgalParamType{a class model of `Kernel`}
+ *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+ *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * \cgalNamedParamsBegin{Output}
+ *   \cgalParamNBegin{vertex_point_map}
+ *     \cgalParamDescription{a property map associating points to the vertices of `tm_out`}
+ *     \cgalParamType{a class model of `WritablePropertyMap` with `boost::graph_traits<TriangleMeshOut>::%vertex_descriptor`
+ *                    as key type and `%Point_3` as value type}
+ *     \cgalParamDefault{`boost::get(CGAL::vertex_point, tm_out)`}
+ *     \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+ *                     must be available in `TriangleMeshOut`.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * @return `true` if the output surface mesh is manifold and was written in `tm_out`.
+ *
+ * \sa `compute_nary_union()`
+ * \sa `compute_nary_intersection()`
+ * \sa `compute_nary_difference()`
+ * \sa `corefine_and_compute_boolean_operations()`
+ */
+template <class TriangleMeshRange,
+          class TriangleMeshOut,
+          class NamedParametersIn = parameters::Default_named_parameters,
+          class NamedParametersOut = parameters::Default_named_parameters>
+bool
+compute_nary_boolean_operation(const TriangleMeshRange& meshes,
+                               Corefinement::Nary_boolean_operation_type op,
+                               TriangleMeshOut& tm_out,
+                               const NamedParametersIn& np_in = parameters::default_values(),
+                               const NamedParametersOut& np_out = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename std::iterator_traits<typename TriangleMeshRange::const_iterator>::value_type TriangleMesh;
+  typedef typename GetGeomTraits<TriangleMesh, NamedParametersIn>::type                        GT;
+  typedef typename boost::property_map<TriangleMesh, vertex_point_t>::const_type               VPM;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParametersIn,
+                                                       Sequential_tag>::type                   Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  GT gt = choose_parameter<GT>(get_parameter(np_in, internal_np::geom_traits));
+
+  if(std::begin(meshes) == std::end(meshes))
+    return false;
+
+  internal::Nary_boolean_operation<TriangleMeshRange, GT, VPM> nary_bo(meshes, gt);
+  nary_bo.template build_trees<Concurrency_tag>();
+  nary_bo.template refine<Concurrency_tag>(op);
+  nary_bo.build_patches();
+  return nary_bo.template extract<Concurrency_tag>(op, tm_out, np_out);
+}
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * computes the union of all the volumes bounded by the triangle meshes of `meshes`, using a single
+ * pass of intersection detection. It is a shortcut for `compute_nary_boolean_operation()` called
+ * with `Corefinement::NARY_UNION`, see this function for the preconditions and the named parameters.
+ */
+template <class TriangleMeshRange,
+          class TriangleMeshOut,
+          class NamedParametersIn = parameters::Default_named_parameters,
+          class NamedParametersOut = parameters::Default_named_parameters>
+bool
+compute_nary_union(const TriangleMeshRange& meshes,
+                   TriangleMeshOut& tm_out,
+                   const NamedParametersIn& np_in = parameters::default_values(),
+                   const NamedParametersOut& np_out = parameters::default_values())
+{
+  return compute_nary_boolean_operation(meshes, Corefinement::NARY_UNION, tm_out, np_in, np_out);
+}
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * computes the intersection of all the volumes bounded by the triangle meshes of `meshes`, using a single
+ * pass of intersection detection. It is a shortcut for `compute_nary_boolean_operation()` called
+ * with `Corefinement::NARY_INTERSECTION`, see this function for the preconditions and the named parameters.
+ */
+template <class TriangleMeshRange,
+          class TriangleMeshOut,
+          class NamedParametersIn = parameters::Default_named_parameters,
+          class NamedParametersOut = parameters::Default_named_parameters>
+bool
+compute_nary_intersection(const TriangleMeshRange& meshes,
+                          TriangleMeshOut& tm_out,
+                          const NamedParametersIn& np_in = parameters::default_values(),
+                          const NamedParametersOut& np_out = parameters::default_values())
+{
+  return compute_nary_boolean_operation(meshes, Corefinement::NARY_INTERSECTION, tm_out, np_in, np_out);
+}
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * computes the volume bounded by the first triangle mesh of `meshes` minus the union of the volumes
+ * bounded by all the others, using a single pass of intersection detection. It is a shortcut for
+ * `compute_nary_boolean_operation()` called with `Corefinement::NARY_DIFFERENCE`, see this function
+ * for the preconditions and the named parameters.
+ */
+template <class TriangleMeshRange,
+          class TriangleMeshOut,
+          class NamedParametersIn = parameters::Default_named_parameters,
+          class NamedParametersOut = parameters::Default_named_parameters>
+bool
+compute_nary_difference(const TriangleMeshRange& meshes,
+                        TriangleMeshOut& tm_out,
+                        const NamedParametersIn& np_in = parameters::default_values(),
+                        const NamedParametersOut& np_out = parameters::default_values())
+{
+  return compute_nary_boolean_operation(meshes, Corefinement::NARY_DIFFERENCE, tm_out, np_in, np_out);
+}
+
+} // end of namespace Polygon_mesh_processing
+} // end of namespace CGAL
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_NARY_BOOLEAN_OPERATIONS_H
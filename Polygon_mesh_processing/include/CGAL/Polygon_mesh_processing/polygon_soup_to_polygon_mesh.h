@@ -24,6 +24,8 @@
 #include <CGAL/boost/graph/internal/helpers.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/property_map.h>
+#include <CGAL/Surface_mesh/Surface_mesh_fwd.h>
+#include <CGAL/tags.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/range/size.hpp>
@@ -31,9 +33,19 @@
 #include <boost/range/reference.hpp>
 #include <boost/container/flat_set.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <set>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -164,6 +176,233 @@ private:
   const PointMap m_pm;
 };
 
+
+// calls `f(i)` for all `i` in `[0, n)`, in parallel if `ConcurrencyTag` is `Parallel_tag`
+template <typename ConcurrencyTag, typename Functor>
+void soup_to_mesh_for_each_index(const std::size_t n, const Functor& f)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          f(i);
+                      });
+    return;
+  }
+#endif
+
+  for(std::size_t i=0; i<n; ++i)
+    f(i);
+}
+
+// Builds the connectivity of the empty mesh `sm` from `polygons` at once: the halfedges
+// of the polygons are sorted by the pair of their vertices, and each group of halfedges
+// with the same vertices becomes an edge. Vertex `i` of `sm` is the point `i` of the soup,
+// and face `i` is the polygon `i`.
+// Returns `false` and leaves `sm` empty if the soup does not define a polygon mesh,
+// the edges that have more than two incident polygons or two incident polygons with
+// incompatible orientations being written in `out` as pairs of point ids.
+template <typename ConcurrencyTag, typename P, typename PolygonRange, typename OutputIterator>
+bool build_surface_mesh_connectivity(const PolygonRange& polygons,
+                                     const std::size_t nb_points,
+                                     Surface_mesh<P>& sm,
+                                     OutputIterator out)
+{
+  typedef Surface_mesh<P>                                              Mesh;
+  typedef typename Mesh::size_type                                     size_type;
+  typedef typename Mesh::Vertex_index                                  Vertex_index;
+  typedef typename Mesh::Halfedge_index                                Halfedge_index;
+  typedef typename Mesh::Face_index                                    Face_index;
+
+  // the vertices of the edge, as `(min << 32) | max`, and `(corner << 1) | is_reversed`
+  typedef std::pair<std::uint64_t, std::uint64_t>                      Edge_key;
+
+  constexpr size_type null = (std::numeric_limits<size_type>::max)();
+
+  const std::size_t nb_polygons = polygons.size();
+
+  // the position of the first halfedge (corner) of each polygon
+  std::vector<std::size_t> offsets(nb_polygons + 1);
+  offsets[0] = 0;
+  for(std::size_t f=0; f<nb_polygons; ++f)
+  {
+    const std::size_t size = boost::size(polygons[f]);
+    if(size < 3)
+      return false;
+    offsets[f+1] = offsets[f] + size;
+  }
+
+  const std::size_t nb_corners = offsets[nb_polygons];
+  CGAL_precondition(nb_points < null && 2 * nb_corners < null);
+
+  std::atomic<bool> valid(true);
+
+  std::vector<Edge_key> keys(nb_corners);
+  soup_to_mesh_for_each_index<ConcurrencyTag>(nb_polygons, [&](const std::size_t f)
+  {
+    const auto& polygon = polygons[f];
+    const std::size_t size = offsets[f+1] - offsets[f];
+    for(std::size_t j=0; j<size; ++j)
+    {
+      const std::uint64_t u = polygon[j], v = polygon[(j+1) % size];
+      if(u >= nb_points)
+        valid = false;
+
+      // no vertex met twice in the same polygon
+      for(std::size_t k=j+1; k<size; ++k)
+        if(polygon[k] == polygon[j])
+          valid = false;
+
+      const std::uint64_t corner = offsets[f] + j;
+      keys[corner] = (u < v) ? Edge_key((u << 32) | v, corner << 1)
+                             : Edge_key((v << 32) | u, (corner << 1) | 1);
+    }
+  });
+
+  if(!valid)
+    return false;
+
+  // sort the keys: bucket them by their smallest vertex, and sort the (small) buckets
+  std::vector<std::size_t> buckets(nb_points + 1, 0);
+  for(const Edge_key& k : keys)
+    ++buckets[(k.first >> 32) + 1];
+  for(std::size_t i=0; i<nb_points; ++i)
+    buckets[i+1] += buckets[i];
+  {
+    std::vector<std::size_t> positions(buckets.begin(), buckets.end() - 1);
+    std::vector<Edge_key> sorted_keys(nb_corners);
+    for(const Edge_key& k : keys)
+      sorted_keys[positions[k.first >> 32]++] = k;
+    keys.swap(sorted_keys);
+  }
+
+  soup_to_mesh_for_each_index<ConcurrencyTag>(nb_points, [&](const std::size_t i)
+  {
+    std::sort(keys.begin() + buckets[i], keys.begin() + buckets[i+1]);
+  });
+
+  // the halfedge of each corner, and the border halfedges
+  std::vector<size_type> corner_halfedges(nb_corners);
+  std::vector<size_type> border_halfedges;
+  size_type nb_edges = 0;
+  for(std::size_t i=0; i<nb_corners; ++nb_edges)
+  {
+    std::size_t j = i + 1;
+    while(j < nb_corners && keys[j].first == keys[i].first)
+      ++j;
+
+    const size_type h = 2 * nb_edges;
+    if(j == i + 1)
+    {
+      corner_halfedges[keys[i].second >> 1] = h;
+      border_halfedges.push_back(h + 1);
+    }
+    else if(j == i + 2 && (keys[i].second & 1) != (keys[i+1].second & 1))
+    {
+      corner_halfedges[keys[i].second >> 1] = h;
+      corner_halfedges[keys[i+1].second >> 1] = h + 1;
+    }
+    else
+    {
+      *out++ = std::make_pair(std::size_t(keys[i].first >> 32), std::size_t(keys[i].first & 0xFFFFFFFF));
+      valid = false;
+    }
+    i = j;
+  }
+
+  if(!valid)
+    return false;
+
+  keys.clear();
+  keys.shrink_to_fit();
+
+  if(sm.has_garbage())
+    sm.collect_garbage();
+  sm.resize(static_cast<size_type>(nb_points), nb_edges, static_cast<size_type>(nb_polygons));
+
+  // the halfedges of the polygons
+  soup_to_mesh_for_each_index<ConcurrencyTag>(nb_polygons, [&](const std::size_t f)
+  {
+    const auto& polygon = polygons[f];
+    const std::size_t first = offsets[f], size = offsets[f+1] - first;
+    for(std::size_t j=0; j<size; ++j)
+    {
+      const Halfedge_index h(corner_halfedges[first + j]);
+      const std::size_t nj = (j + 1 == size) ? 0 : j + 1;
+      sm.set_target(h, Vertex_index(static_cast<size_type>(polygon[nj])));
+      sm.set_face(h, Face_index(static_cast<size_type>(f)));
+      sm.set_next(h, Halfedge_index(corner_halfedges[first + nj]));
+    }
+    sm.set_halfedge(Face_index(static_cast<size_type>(f)), Halfedge_index(corner_halfedges[first]));
+  });
+
+  // an incoming halfedge for each vertex, which must be a border halfedge for border vertices
+  std::vector<size_type> degrees(nb_points, 0);
+  for(size_type h : corner_halfedges)
+  {
+    const Vertex_index v = sm.target(Halfedge_index(h));
+    sm.set_halfedge(v, Halfedge_index(h));
+    ++degrees[v];
+  }
+
+  // the outgoing border halfedge of each vertex, which must be unique
+  std::vector<size_type> outgoing_border_halfedges(nb_points, null);
+  for(size_type b : border_halfedges)
+  {
+    const Halfedge_index h(b);
+    const Vertex_index s = sm.target(sm.opposite(h)), t = sm.target(sm.prev(sm.opposite(h)));
+    sm.set_target(h, t);
+    sm.set_face(h, Mesh::null_face());
+    sm.set_halfedge(t, h);
+    ++degrees[t];
+
+    if(outgoing_border_halfedges[s] != null)
+      valid = false;
+    outgoing_border_halfedges[s] = b;
+  }
+
+  if(valid)
+  {
+    soup_to_mesh_for_each_index<ConcurrencyTag>(border_halfedges.size(), [&](const std::size_t i)
+    {
+      const Halfedge_index h(border_halfedges[i]);
+      sm.set_next(h, Halfedge_index(outgoing_border_halfedges[sm.target(h)]));
+    });
+
+    // the incoming halfedges of each vertex must form a single umbrella
+    soup_to_mesh_for_each_index<ConcurrencyTag>(nb_points, [&](const std::size_t i)
+    {
+      const Vertex_index v(static_cast<size_type>(i));
+      const Halfedge_index h = sm.halfedge(v);
+      if(h == Mesh::null_halfedge())
+        return;
+
+      size_type degree = 0;
+      Halfedge_index hi = h;
+      do
+      {
+        ++degree;
+        hi = sm.opposite(sm.next(hi));
+      }
+      while(hi != h && degree <= degrees[i]);
+
+      if(degree != degrees[i])
+        valid = false;
+    });
+  }
+
+  if(!valid)
+  {
+    sm.clear_without_removing_property_maps();
+    return false;
+  }
+
+  return true;
+}
+
 } // namespace internal
 
 /**
@@ -323,6 +562,7 @@ bool is_polygon_soup_a_polygon_mesh(const PolygonRange& polygons)
 * \sa `CGAL::Polygon_mesh_processing::orient_polygon_soup()`
 * \sa `CGAL::Polygon_mesh_processing::is_polygon_soup_a_polygon_mesh()`
 * \sa `CGAL::Polygon_mesh_processing::polygon_mesh_to_polygon_soup()`
+* \sa `CGAL::Polygon_mesh_processing::polygon_soup_to_surface_mesh()`
 */
 template<typename PolygonMesh,
          typename PointRange, typename PolygonRange,
@@ -361,6 +601,122 @@ void polygon_soup_to_polygon_mesh(const PointRange& points,
       "Named parameter face_to_face_map was renamed polygon_to_face_map");
 }
 
+/**
+* \ingroup PMP_combinatorial_repair_grp
+*
+* builds a `Surface_mesh` from a soup of polygons, constructing all its halfedges at once.
+*
+* Instead of adding the polygons one by one as `polygon_soup_to_polygon_mesh()` does,
+* the edges of the polygons are sorted by their vertices (in parallel if `Parallel_tag`
+* is used), and the connectivity of the mesh is then filled in a single pass. This function
+* is thus much faster on large soups, and it checks that the soup defines a polygon mesh
+* instead of requiring it as a precondition.
+*
+* The vertex `i` of `out` is the point `points[i]` (all the points are inserted, even
+* if they are not used by any polygon), and the face `i` of `out` is the polygon `polygons[i]`.
+*
+* @tparam P the point type of the `Surface_mesh`
+* @tparam PointRange a model of the concept `RandomAccessContainer`
+* whose value type is the point type
+* @tparam PolygonRange a model of the concept `RandomAccessContainer` whose
+* value type is a model of the concept `RandomAccessContainer` whose value type is `std::size_t`
+* @tparam NamedParameters_PS a sequence of \ref bgl_namedparameters "Named Parameters"
+* @tparam NamedParameters_PM a sequence of \ref bgl_namedparameters "Named Parameters"
+*
+* @param points points of the soup of polygons
+* @param polygons each element in the range describes a polygon using the indices of the points in `points`
+* @param out the surface mesh to be built
+* @param np_ps an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+*
+* \cgalNamedParamsBegin
+*   \cgalParamNBegin{point_map}
+*     \cgalParamDescription{a property map associating points to the elements of the range `points`}
+*     \cgalParamType{a model of `ReadablePropertyMap` whose value type is a point type convertible to the point type
+*                    of the vertex point map associated to the polygon mesh}
+*     \cgalParamDefault{`CGAL::Identity_property_map`}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{output_iterator}
+*     \cgalParamDescription{an output iterator to collect the edges of the soup that prevent it from being a polygon mesh}
+*     \cgalParamType{a model of `OutputIterator` with value type `std::pair<std::size_t, std::size_t>`}
+*     \cgalParamDefault{unused}
+*     \cgalParamExtra{Each edge incident to more than two polygons, or to two polygons that are not consistently oriented,
+*                     is reported once as the pair of the indices of its points, the smallest first.}
+*   \cgalParamNEnd
+* \cgalNamedParamsEnd
+*
+* @param np_pm an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+*
+* \cgalNamedParamsBegin
+*   \cgalParamNBegin{vertex_point_map}
+*     \cgalParamDescription{a property map associating points to the vertices of `out`}
+*     \cgalParamType{a class model of `WritablePropertyMap` with `Surface_mesh<P>::Vertex_index`
+*                    as key type and `%Point_3` as value type}
+*     \cgalParamDefault{`boost::get(CGAL::vertex_point, out)`}
+*   \cgalParamNEnd
+* \cgalNamedParamsEnd
+*
+* @return `true` if the soup defines a consistently oriented polygon mesh (see `is_polygon_soup_a_polygon_mesh()`),
+* and `false` otherwise, in which case `out` is left empty.
+*
+* @pre `out` is empty.
+*
+* \sa `CGAL::Polygon_mesh_processing::polygon_soup_to_polygon_mesh()`
+* \sa `CGAL::Polygon_mesh_processing::orient_polygon_soup()`
+*/
+template<typename P,
+         typename PointRange, typename PolygonRange,
+         typename NamedParameters_PS = parameters::Default_named_parameters, typename NamedParameters_PM = parameters::Default_named_parameters>
+bool polygon_soup_to_surface_mesh(const PointRange& points,
+                                  const PolygonRange& polygons,
+                                  Surface_mesh<P>& out,
+                                  const NamedParameters_PS& np_ps = parameters::default_values(),
+                                  const NamedParameters_PM& np_pm = parameters::default_values())
+{
+  CGAL_precondition(out.is_empty());
+
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef Surface_mesh<P>                                                             Mesh;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters_PS,
+                                                       Sequential_tag>::type             Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  typedef typename CGAL::GetPointMap<PointRange, NamedParameters_PS>::const_type    Point_map;
+  Point_map pm = choose_parameter<Point_map>(get_parameter(np_ps, internal_np::point_map));
+
+  typedef typename CGAL::GetVertexPointMap<Mesh, NamedParameters_PM>::type          Vertex_point_map;
+  typedef typename boost::property_traits<Vertex_point_map>::value_type             PM_Point;
+  Vertex_point_map vpm = choose_parameter(get_parameter(np_pm, internal_np::vertex_point),
+                                          get_property_map(CGAL::vertex_point, out));
+
+  if(!internal::build_surface_mesh_connectivity<Concurrency_tag>(
+        polygons, points.size(), out,
+        choose_parameter(get_parameter(np_ps, internal_np::output_iterator), Emptyset_iterator())))
+    return false;
+
+  internal::soup_to_mesh_for_each_index<Concurrency_tag>(points.size(), [&](const std::size_t i)
+  {
+    put(vpm, typename Mesh::Vertex_index(static_cast<typename Mesh::size_type>(i)),
+        internal::convert_to_pm_point<PM_Point>(get(pm, points[i])));
+  });
+
+  return true;
+}
+
 } // namespace Polygon_mesh_processing
 } // namespace CGAL
 
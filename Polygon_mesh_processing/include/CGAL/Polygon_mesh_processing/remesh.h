@@ -193,6 +193,17 @@ namespace Polygon_mesh_processing {
 *                    of the vertex point map.}
 *     \cgalParamDefault{If not provided, vertices are projected on the input surface mesh.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel mode, the edges to be split or collapsed are detected in parallel,
+*                     the tangential relaxation is performed in parallel (see `tangential_relaxation()`),
+*                     and the vertices are projected in parallel, the functors passed to `allow_move_functor`
+*                     and `projection_functor` must thus be thread-safe.
+*                     The topological operations (splits, collapses, and flips) remain sequential.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * @sa `split_long_edges()`
@@ -318,6 +329,16 @@ void isotropic_remeshing(const FaceRange& faces
   bool do_split = choose_parameter(get_parameter(np, internal_np::do_split), true);
   bool do_flip = choose_parameter(get_parameter(np, internal_np::do_flip), true);
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 #ifdef CGAL_PMP_REMESHING_VERBOSE
   std::cout << std::endl;
   std::cout << "Remeshing (#iter = " << nb_iterations << ")..." << std::endl;
@@ -331,14 +352,14 @@ void isotropic_remeshing(const FaceRange& faces
 #endif
 
     if(do_split)
-     remesher.split_long_edges(sizing);
+     remesher.split_long_edges(sizing, Concurrency_tag());
     if(do_collapse)
-     remesher.collapse_short_edges(sizing, collapse_constraints);
+     remesher.collapse_short_edges(sizing, collapse_constraints, Concurrency_tag());
     if(do_flip)
       remesher.flip_edges_for_valence_and_shape();
-    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian, sizing, shall_move);
+    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian, sizing, shall_move, Concurrency_tag());
     if ( choose_parameter(get_parameter(np, internal_np::do_project), true) )
-      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor));
+      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor), Concurrency_tag());
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     std::cout << std::endl;
 #endif
@@ -22,10 +22,20 @@
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 
-#include <tuple>
+#include <boost/property_map/function_property_map.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -38,6 +48,108 @@ struct Allow_all_moves{
     return true;
   }
 };
+
+#ifdef CGAL_LINKED_WITH_TBB
+// Parallel version of the relaxation loop of `tangential_relaxation()`. The new locations
+// are computed in parallel from the current positions as in the sequential version, but
+// the moves (that are validated using the normals of the incident faces) are performed
+// by batches of vertices that do not share any face. The batches are obtained from
+// a greedy coloring of the vertices, so the result does not depend on the number of threads.
+template <typename VertexRange, typename TriangleMesh,
+          typename NewLocation, typename PerformMove, typename NamedParameters>
+void parallel_tangential_relaxation(const VertexRange& vertex_range,
+                                    TriangleMesh& tm,
+                                    const unsigned int nb_iterations,
+                                    const NewLocation& new_location,
+                                    const PerformMove& perform_move,
+                                    const NamedParameters& np)
+{
+  typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor vertex_descriptor;
+  typedef typename boost::graph_traits<TriangleMesh>::halfedge_descriptor halfedge_descriptor;
+  typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+
+  typedef typename GetGeomTraits<TriangleMesh, NamedParameters>::type GT;
+  typedef typename GT::Vector_3 Vector_3;
+  typedef typename GT::Point_3 Point_3;
+
+  const std::vector<vertex_descriptor> vs(std::begin(vertex_range), std::end(vertex_range));
+  const std::vector<face_descriptor> fs(std::begin(faces(tm)), std::end(faces(tm)));
+
+  auto vim = get_initialized_vertex_index_map(tm, np);
+  auto fim = get_initialized_face_index_map(tm, np);
+
+  // greedy coloring: two vertices sharing a face get different colors
+  std::vector<int> colors(num_vertices(tm), -1);
+  std::vector<std::vector<std::size_t> > batches;
+  std::vector<bool> used;
+  for(std::size_t i=0; i<vs.size(); ++i)
+  {
+    used.assign(batches.size(), false);
+    for(halfedge_descriptor h : halfedges_around_target(vs[i], tm))
+    {
+      if(is_border(h, tm))
+        continue;
+      for(vertex_descriptor w : vertices_around_face(h, tm))
+        if(colors[get(vim, w)] >= 0)
+          used[colors[get(vim, w)]] = true;
+    }
+
+    const int c = int(std::find(used.begin(), used.end(), false) - used.begin());
+    if(c == int(batches.size()))
+      batches.emplace_back();
+    batches[c].push_back(i);
+    colors[get(vim, vs[i])] = c;
+  }
+
+  std::vector<Vector_3> face_normals(num_faces(tm));
+  auto face_normal_map = boost::make_function_property_map<face_descriptor>(
+                           [&](const face_descriptor f) -> Vector_3 { return face_normals[get(fim, f)]; });
+
+  std::vector<std::optional<Point_3> > new_locations(vs.size());
+  for(unsigned int nit = 0; nit < nb_iterations; ++nit)
+  {
+#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
+    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
+    std::cout << nb_iterations << ") ";
+    std::cout.flush();
+#endif
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, fs.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          face_normals[get(fim, fs[i])] = compute_face_normal(fs[i], tm, np);
+                      });
+
+    // at each vertex, compute barycenter of neighbors and the move
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vs.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                        {
+                          const vertex_descriptor v = vs[i];
+                          new_locations[i] = new_location(v, [&]()
+                          {
+                            return compute_vertex_normal(v, tm, np.face_normal_map(face_normal_map));
+                          });
+                        }
+                      });
+
+    // perform moves
+    for(const std::vector<std::size_t>& batch : batches)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            if(new_locations[batch[i]])
+                              perform_move(vs[batch[i]], *new_locations[batch[i]]);
+                        });
+    }
+  }
+}
+#endif // CGAL_LINKED_WITH_TBB
+
 } // internal namespace
 
 
@@ -109,6 +221,15 @@ struct Allow_all_moves{
 *     \cgalParamDefault{`false`}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel mode, the moves of vertices that do not share a face are performed simultaneously,
+*                     in an order that differs from the sequential one, and the functor passed to
+*                     `allow_move_functor` must be thread-safe.}
+*   \cgalParamNEnd
+*
 *   \cgalParamNBegin{allow_move_functor}
 *     \cgalParamDescription{A function object used to determinate if a vertex move should be allowed or not}
 *     \cgalParamType{Unary functor that provides `bool operator()(vertex_descriptor v, Point_3 src, Point_3 tgt)` returning `true`
@@ -226,144 +347,165 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
-  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
-  {
-#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
-    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
-    std::cout << nb_iterations << ") ";
-    std::cout.flush();
-#endif
-
-    typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
-    std::vector< VNP > barycenters;
-    auto gt_barycenter = gt.construct_barycenter_3_object();
-    auto gt_project = gt.construct_projected_point_3_object();
+  auto gt_barycenter = gt.construct_barycenter_3_object();
+  auto gt_project = gt.construct_projected_point_3_object();
 
-    // at each vertex, compute vertex normal
-    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+  // the new location of `v` computed from the current positions, if `v` has to move;
+  // `vertex_normal()` returns the normal at `v`, and is only called when needed
+  auto new_location = [&](const vertex_descriptor v, const auto& vertex_normal) -> std::optional<Point_3>
+  {
+    if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
+      return std::nullopt;
 
-    // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    // collect hedges to detect if we have to handle boundary cases
+    std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
+    for(halfedge_descriptor h : halfedges_around_target(v, tm))
     {
-      if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
-
-      // collect hedges to detect if we have to handle boundary cases
-      std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
-      for(halfedge_descriptor h : halfedges_around_target(v, tm))
-      {
-        if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
-          border_halfedges.push_back(h);
-        else
-          interior_hedges.push_back(h);
-      }
+      if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
+        border_halfedges.push_back(h);
+      else
+        interior_hedges.push_back(h);
+    }
 
-      if (border_halfedges.empty())
+    Vector_3 vn(NULL_VECTOR);
+    Point_3 qv; // barycenter at v
+    if (border_halfedges.empty())
+    {
+      vn = vertex_normal();
+      Vector_3 move = CGAL::NULL_VECTOR;
+      if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
       {
-        const Vector_3& vn = vnormals.at(v);
-        Vector_3 move = CGAL::NULL_VECTOR;
-        if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
-        {
-          unsigned int star_size = 0;
-          for(halfedge_descriptor h :interior_hedges)
-          {
-            move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
-            ++star_size;
-          }
-          CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
-          move = (1. / static_cast<double>(star_size)) * move;
-        }
-        else
+        unsigned int star_size = 0;
+        for(halfedge_descriptor h :interior_hedges)
         {
-          auto gt_centroid = gt.construct_centroid_3_object();
-          auto gt_area = gt.compute_area_3_object();
-          double weight = 0;
-          for(halfedge_descriptor h :interior_hedges)
-          {
-            // calculate weight
-            // need v, v1 and v2
-            const vertex_descriptor v1 = target(next(h, tm), tm);
-            const vertex_descriptor v2 = source(h, tm);
-
-            const double tri_area = gt_area(get(vpm, v), get(vpm, v1), get(vpm, v2));
-            const double face_weight = tri_area
-                                       / (1. / 3. * (sizing.at(v, tm)
-                                                   + sizing.at(v1, tm)
-                                                   + sizing.at(v2, tm)));
-            weight += face_weight;
-
-            const Point_3 centroid = gt_centroid(get(vpm, v), get(vpm, v1), get(vpm, v2));
-            move = move + Vector_3(get(vpm, v), centroid) * face_weight;
-          }
-          move = move / weight; //todo ip: what if weight ends up being close to 0?
+          move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
+          ++star_size;
         }
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
+        move = (1. / static_cast<double>(star_size)) * move;
       }
       else
       {
-        if (!relax_constraints) continue;
-        Vector_3 vn(NULL_VECTOR);
-
-        if (border_halfedges.size() == 2)// corners are constrained
+        auto gt_centroid = gt.construct_centroid_3_object();
+        auto gt_area = gt.compute_area_3_object();
+        double weight = 0;
+        for(halfedge_descriptor h :interior_hedges)
         {
-          vertex_descriptor ph0 = source(border_halfedges[0], tm);
-          vertex_descriptor ph1 = source(border_halfedges[1], tm);
-          double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
-                                 * Vector_3(get(vpm, v), get(vpm, ph1)));
-          // \todo shouldn't it be an input parameter?
-          //check squared cosine is < 0.25 (~120 degrees)
-          if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
-                                 squared_distance(get(vpm,ph1), get(vpm, v))) )
-          {
-            typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
-            // to avoid shrinking of borders, we project back onto the incident segments
-            typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
-                                   s2(get(vpm, ph1), get(vpm,v));
-
-            typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
-
-            bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
-          }
+          // calculate weight
+          // need v, v1 and v2
+          const vertex_descriptor v1 = target(next(h, tm), tm);
+          const vertex_descriptor v2 = source(h, tm);
+
+          const double tri_area = gt_area(get(vpm, v), get(vpm, v1), get(vpm, v2));
+          const double face_weight = tri_area
+                                     / (1. / 3. * (sizing.at(v, tm)
+                                                 + sizing.at(v1, tm)
+                                                 + sizing.at(v2, tm)));
+          weight += face_weight;
+
+          const Point_3 centroid = gt_centroid(get(vpm, v), get(vpm, v1), get(vpm, v2));
+          move = move + Vector_3(get(vpm, v), centroid) * face_weight;
         }
+        move = move / weight; //todo ip: what if weight ends up being close to 0?
       }
+      qv = get(vpm, v) + move;
     }
-
-    // compute moves
-    typedef std::pair<vertex_descriptor, Point_3> VP_pair;
-    std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
-    new_locations.reserve(barycenters.size());
-    for(const VNP& vnp : barycenters)
+    else
     {
-      vertex_descriptor v = std::get<0>(vnp);
-      const Point_3& pv = get(vpm, v);
-      const Vector_3& nv = std::get<1>(vnp);
-      const Point_3& qv = std::get<2>(vnp); //barycenter at v
-
-      new_locations.emplace_back(v, qv + (nv * Vector_3(qv, pv)) * nv);
+      if (!relax_constraints)
+        return std::nullopt;
+
+      if (border_halfedges.size() != 2)// corners are constrained
+        return std::nullopt;
+
+      vertex_descriptor ph0 = source(border_halfedges[0], tm);
+      vertex_descriptor ph1 = source(border_halfedges[1], tm);
+      double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
+                             * Vector_3(get(vpm, v), get(vpm, ph1)));
+      // \todo shouldn't it be an input parameter?
+      //check squared cosine is < 0.25 (~120 degrees)
+      if (!(0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
+                               squared_distance(get(vpm,ph1), get(vpm, v)))) )
+        return std::nullopt;
+
+      typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
+      // to avoid shrinking of borders, we project back onto the incident segments
+      typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
+                             s2(get(vpm, ph1), get(vpm,v));
+
+      typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
+
+      qv = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
     }
 
-    // perform moves
-    for(const VP_pair& vp : new_locations)
+    // compute move
+    const Point_3& pv = get(vpm, v);
+    return qv + (vn * Vector_3(qv, pv)) * vn;
+  };
+
+  // moves `v` to `new_pos`, shortening the move if a face gets inverted
+  auto perform_move = [&](const vertex_descriptor v, const Point_3& new_pos)
+  {
+    const Point_3 initial_pos = get(vpm, v); // make a copy on purpose
+    const Vector_3 move(initial_pos, new_pos);
+
+    put(vpm, v, new_pos);
+
+    //check that no inversion happened
+    double frac = 1.;
+    while (frac > 0.03 //5 attempts maximum
+           && (   !check_normals(v)
+                  || !shall_move(v, initial_pos, get(vpm, v)))) //if a face has been inverted
     {
-      const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
-      const Vector_3 move(initial_pos, vp.second);
+      frac = 0.5 * frac;
+      put(vpm, v, initial_pos + frac * move);//shorten the move by 2
+    }
+    if (frac <= 0.02)
+      put(vpm, v, initial_pos);//cancel move
+  };
+
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      CGAL_NP_CLASS,
+      Sequential_tag
+    > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    internal::parallel_tangential_relaxation(vertices, tm, nb_iterations, new_location, perform_move, np);
+    return;
+  }
+#endif
+
+  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
+  {
+#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
+    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
+    std::cout << nb_iterations << ") ";
+    std::cout.flush();
+#endif
 
-      put(vpm, vp.first, vp.second);
+    // at each vertex, compute vertex normal
+    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
+    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
 
-      //check that no inversion happened
-      double frac = 1.;
-      while (frac > 0.03 //5 attempts maximum
-             && (   !check_normals(vp.first)
-                    || !shall_move(vp.first, initial_pos, get(vpm, vp.first)))) //if a face has been inverted
-      {
-        frac = 0.5 * frac;
-        put(vpm, vp.first, initial_pos + frac * move);//shorten the move by 2
-      }
-      if (frac <= 0.02)
-        put(vpm, vp.first, initial_pos);//cancel move
+    // at each vertex, compute barycenter of neighbors and the move
+    typedef std::pair<vertex_descriptor, Point_3> VP_pair;
+    std::vector< VP_pair > new_locations;
+    for(vertex_descriptor v : vertices)
+    {
+      std::optional<Point_3> p = new_location(v, [&]() -> const Vector_3& { return vnormals.at(v); });
+      if (p)
+        new_locations.emplace_back(v, *p);
     }
+
+    // perform moves
+    for(const VP_pair& vp : new_locations)
+      perform_move(vp.first, vp.second);
   }//end for loop (nit == nb_iterations)
 
 #ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
@@ -26,9 +26,19 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Dynamic_property_map.h>
+#include <CGAL/tags.h>
 
-#include <tuple>
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
 
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -60,6 +70,44 @@ namespace Polygon_mesh_processing {
     };
   } // namespace Hole_filling
 
+  namespace internal {
+
+  // maximum squared distance between the boundary of the hole and its fitting plane,
+  // used when filling the hole with the 2D constrained Delaunay triangulation
+  template<typename PolygonMesh, typename NamedParameters>
+  typename GetGeomTraits<PolygonMesh, NamedParameters>::type::FT
+  hole_max_squared_distance(const PolygonMesh& pmesh,
+                            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                            const NamedParameters& np)
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename GetGeomTraits<PolygonMesh, NamedParameters>::type         GeomTraits;
+
+    std::vector<typename GeomTraits::Point_3> points;
+    typedef Halfedge_around_face_circulator<PolygonMesh> Hedge_around_face_circulator;
+    const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_const_property_map(vertex_point, pmesh));
+    Hedge_around_face_circulator circ(border_halfedge, pmesh), done(circ);
+    do {
+      points.push_back(get(vpmap, target(*circ, pmesh)));
+    } while (++circ != done);
+
+    const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
+    typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
+    default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
+
+    const typename GeomTraits::FT threshold_distance = choose_parameter(
+      get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
+    typename GeomTraits::FT max_squared_distance = default_squared_distance;
+    if (threshold_distance >= typename GeomTraits::FT(0))
+      max_squared_distance = threshold_distance * threshold_distance;
+    CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
+    return max_squared_distance;
+  }
+
+  } // namespace internal
+
   /*!
   \ingroup PMP_hole_filling_grp
 
@@ -196,27 +244,8 @@ namespace Polygon_mesh_processing {
 #endif
 
     typename GeomTraits::FT max_squared_distance = typename GeomTraits::FT(-1);
-    if (use_cdt) {
-
-      std::vector<typename GeomTraits::Point_3> points;
-      typedef Halfedge_around_face_circulator<PolygonMesh> Hedge_around_face_circulator;
-      const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
-      Hedge_around_face_circulator circ(border_halfedge, pmesh), done(circ);
-      do {
-        points.push_back(get(vpmap, target(*circ, pmesh)));
-      } while (++circ != done);
-
-      const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
-      typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
-      default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
-
-      const typename GeomTraits::FT threshold_distance = choose_parameter(
-        get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
-      max_squared_distance = default_squared_distance;
-      if (threshold_distance >= typename GeomTraits::FT(0))
-        max_squared_distance = threshold_distance * threshold_distance;
-      CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
-    }
+    if (use_cdt)
+      max_squared_distance = internal::hole_max_squared_distance(pmesh, border_halfedge, np);
 
     Hole_filling::Default_visitor default_visitor;
 
@@ -635,6 +664,467 @@ namespace Polygon_mesh_processing {
   }
 #endif // CGAL_NO_DEPRECATED_CODE
 
+  namespace internal {
+
+  // triangulates the holes described by `holes`, the faces of the patch filling `holes[i]` being put in `patches[i]`.
+  // The triangulations of the holes not sharing any vertex with another hole are independent,
+  // and are computed concurrently in parallel mode. They are then added to the mesh in the order of `holes`,
+  // so that the output does not depend on the concurrency tag.
+  template<typename PolygonMesh, typename NamedParameters>
+  std::size_t
+  triangulate_holes(PolygonMesh& pmesh,
+                    const std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor>& holes,
+                    std::vector<std::vector<typename boost::graph_traits<PolygonMesh>::face_descriptor> >& patches,
+                    const NamedParameters& np)
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor       halfedge_descriptor;
+    typedef typename GetGeomTraits<PolygonMesh, NamedParameters>::type            GeomTraits;
+    typedef typename GetVertexPointMap<PolygonMesh, NamedParameters>::type        VPM;
+    typedef CGAL::internal::Weight_min_max_dihedral_and_area                      Weight;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const bool use_dt3 =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_DT3
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_delaunay_triangulation), true);
+#endif
+    const bool use_cdt =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
+#endif
+    const bool skip_cubic_algorithm = choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false);
+
+    VPM vpm = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+    const GeomTraits gt = choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits));
+
+    const std::size_t nb_holes = holes.size();
+    std::vector<std::vector<halfedge_descriptor> > P_edges(nb_holes);
+    std::vector<CGAL::internal::Lookup_table_map<int> > lambdas(nb_holes, CGAL::internal::Lookup_table_map<int>(0, -1));
+    std::vector<Weight> weights(nb_holes, Weight::NOT_VALID());
+    std::vector<bool> computed(nb_holes, false);
+    patches.assign(nb_holes, std::vector<typename boost::graph_traits<PolygonMesh>::face_descriptor>());
+
+    auto compute_triangulation = [&](const std::size_t i)
+    {
+      CGAL_precondition(face(holes[i], pmesh) == boost::graph_traits<PolygonMesh>::null_face());
+
+      typename GeomTraits::FT max_squared_distance = typename GeomTraits::FT(-1);
+      if(use_cdt)
+        max_squared_distance = hole_max_squared_distance(pmesh, holes[i], np);
+
+      Hole_filling::Default_visitor visitor;
+      weights[i] = compute_hole_triangulation(pmesh, holes[i], vpm, use_dt3, gt, use_cdt, skip_cubic_algorithm,
+                                              visitor, max_squared_distance, P_edges[i], lambdas[i]);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      // filling a hole might create an edge between two vertices of another hole,
+      // the holes sharing a vertex are thus filled one after the other
+      std::vector<std::size_t> independent_holes;
+      {
+        std::vector<bool> is_independent(nb_holes, true);
+        auto hole_ids = get(CGAL::dynamic_vertex_property_t<std::size_t>(), pmesh, nb_holes);
+        for(std::size_t i=0; i<nb_holes; ++i)
+        {
+          for(halfedge_descriptor h : halfedges_around_face(holes[i], pmesh))
+          {
+            const std::size_t j = get(hole_ids, target(h, pmesh));
+            if(j == nb_holes)
+              put(hole_ids, target(h, pmesh), i);
+            else
+              is_independent[i] = is_independent[j] = false;
+          }
+        }
+        for(std::size_t i=0; i<nb_holes; ++i)
+          if(is_independent[i])
+            independent_holes.push_back(i);
+      }
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, independent_holes.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t k=r.begin(); k!=r.end(); ++k)
+                            compute_triangulation(independent_holes[k]);
+                        });
+
+      for(std::size_t i : independent_holes)
+        computed[i] = true;
+    }
+#endif
+
+    std::size_t nb_filled = 0;
+    for(std::size_t i=0; i<nb_holes; ++i)
+    {
+      if(!computed[i])
+        compute_triangulation(i);
+      if(weights[i] == Weight::NOT_VALID())
+        continue;
+
+      apply_hole_triangulation(pmesh, P_edges[i], lambdas[i], std::back_inserter(patches[i]));
+      lambdas[i] = CGAL::internal::Lookup_table_map<int>(0, -1);
+      ++nb_filled;
+    }
+
+    return nb_filled;
+  }
+
+  } // namespace internal
+
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  triangulates several holes in a polygon mesh.
+
+  The result is the same as calling `triangulate_hole()` on each hole of `border_halfedges`, in the order
+  of the range. The triangulations of the holes that do not share any vertex with another hole of the range
+  are independent, and are computed concurrently in parallel mode; the patches are then added to the mesh
+  sequentially, so that the output does not depend on the concurrency tag.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a range of halfedge descriptors of `PolygonMesh`, model of `Range`.
+          Its iterator type is `InputIterator`.
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges one border halfedge incident to each hole to be filled
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{face_output_iterator}
+      \cgalParamDescription{iterator over patch faces}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%face_descriptor` for patch faces}
+      \cgalParamDefault{`Emptyset_iterator`}
+      \cgalParamExtra{The faces of the patches are output hole after hole, in the order of `border_halfedges`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_point_map}
+      \cgalParamDescription{a property map associating points to the vertices of `pmesh`}
+      \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+                     as key type and `%Point_3` as value type}
+      \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`}
+      \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+                      must be available in `PolygonMesh`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a class model of `Kernel`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_delaunay_triangulation}
+      \cgalParamDescription{If `true`, use the Delaunay triangulation facet search space.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If no valid triangulation can be found in this search space, the algorithm
+                      falls back to the non-Delaunay triangulations search space to find a solution.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_2d_constrained_delaunay_triangulation}
+      \cgalParamDescription{If `true`, the points of the boundary of the hole are used
+                            to estimate a fitting plane and a 2D constrained Delaunay triangulation
+                            is then used to fill the hole projected in the fitting plane.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If the boundary of the hole is not planar (according to the
+                      parameter `threshold_distance`) or if no valid 2D triangulation
+                      can be found, the algorithm falls back to the method using
+                      the 3D Delaunay triangulation. This parameter is a good choice for near planar holes.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{threshold_distance}
+      \cgalParamDescription{The maximum distance between the vertices of
+                            the hole boundary and the least squares plane fitted to this boundary.}
+      \cgalParamType{double}
+      \cgalParamDefault{one quarter of the height of the bounding box of the hole}
+      \cgalParamExtra{This parameter is used only in conjunction with
+                      the parameter `use_2d_constrained_delaunay_triangulation`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{do_not_use_cubic_algorithm}
+      \cgalParamDescription{Set this parameter to `true` if you only want to use the Delaunay based versions of the algorithm,
+                            skipping the cubic search space one in case of failure.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+      \cgalParamExtra{If `true`, `use_2d_constrained_delaunay_triangulation` or `use_delaunay_triangulation` must be set to `true`
+                      otherwise nothing will be done.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @return the number of holes that have been filled
+
+  @pre the halfedges of `border_halfedges` are border halfedges of distinct holes
+
+  \sa CGAL::Polygon_mesh_processing::triangulate_hole()
+  \sa CGAL::Polygon_mesh_processing::extract_boundary_cycles()
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::size_t
+  triangulate_holes(PolygonMesh& pmesh,
+                    const HalfedgeRange& border_halfedges,
+                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor       halfedge_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::face_descriptor           face_descriptor;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+
+    Face_output_iterator out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+
+    const std::vector<halfedge_descriptor> holes(std::begin(border_halfedges), std::end(border_halfedges));
+    std::vector<std::vector<face_descriptor> > patches;
+    const std::size_t nb_filled = internal::triangulate_holes(pmesh, holes, patches, np);
+
+    for(const std::vector<face_descriptor>& patch : patches)
+      out = std::copy(patch.begin(), patch.end(), out);
+
+    return nb_filled;
+  }
+
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  triangulates, refines, and fairs several holes in a polygon mesh.
+
+  The holes are first triangulated as in `triangulate_holes()`, the patches are then refined
+  one after the other as in `refine()`, and finally faired as in `fair()`. The linear systems
+  used to fair the different patches are set up and solved concurrently in parallel mode;
+  all the systems are built from the positions of the vertices before fairing,
+  so that the output does not depend on the concurrency tag. If two patches are close
+  enough for the fairing of one patch to involve vertices of the other one, the output might thus
+  differ from the one of successive calls to `triangulate_refine_and_fair_hole()`.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a range of halfedge descriptors of `PolygonMesh`, model of `Range`.
+          Its iterator type is `InputIterator`.
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges one border halfedge incident to each hole to be filled
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In parallel mode, the solver passed to `sparse_linear_solver` is copied for each patch.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{face_output_iterator}
+      \cgalParamDescription{iterator over patch faces}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%face_descriptor` for patch faces}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_output_iterator}
+      \cgalParamDescription{iterator over patch vertices}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%vertex_descriptor` for patch vertices}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_point_map}
+      \cgalParamDescription{a property map associating points to the vertices of `pmesh`}
+      \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+                     as key type and `%Point_3` as value type}
+      \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`}
+      \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+                      must be available in `PolygonMesh`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a class model of `Kernel`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_delaunay_triangulation}
+      \cgalParamDescription{If `true`, use the Delaunay triangulation facet search space.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If no valid triangulation can be found in this search space, the algorithm
+                      falls back to the non-Delaunay triangulations search space to find a solution.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_2d_constrained_delaunay_triangulation}
+      \cgalParamDescription{If `true`, the points of the boundary of the hole are used
+                            to estimate a fitting plane and a 2D constrained Delaunay triangulation
+                            is then used to fill the hole projected in the fitting plane.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If the boundary of the hole is not planar (according to the
+                      parameter `threshold_distance`) or if no valid 2D triangulation
+                      can be found, the algorithm falls back to the method using
+                      the 3D Delaunay triangulation. This parameter is a good choice for near planar holes.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{threshold_distance}
+      \cgalParamDescription{The maximum distance between the vertices of
+                            the hole boundary and the least squares plane fitted to this boundary.}
+      \cgalParamType{double}
+      \cgalParamDefault{one quarter of the height of the bounding box of the hole}
+      \cgalParamExtra{This parameter is used only in conjunction with
+                      the parameter `use_2d_constrained_delaunay_triangulation`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{density_control_factor}
+      \cgalParamDescription{factor to control density of the output mesh,
+                            where larger values cause denser refinements, as in `refine()`}
+      \cgalParamType{double}
+      \cgalParamDefault{\f$ \sqrt{2}\f$}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{fairing_continuity}
+      \cgalParamDescription{A value controlling the tangential continuity of the output surface patch.
+                            The possible values are 0, 1 and 2, referring to the  C<sup>0</sup>, C<sup>1</sup>
+                            and C<sup>2</sup> continuity.}
+      \cgalParamType{unsigned int}
+      \cgalParamDefault{`1`}
+      \cgalParamExtra{The larger `fairing_continuity` gets, the more fixed vertices are required.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{sparse_linear_solver}
+      \cgalParamDescription{an instance of the sparse linear solver used for fairing}
+      \cgalParamType{a class model of `SparseLinearAlgebraWithFactorTraits_d`}
+      \cgalParamDefault{If \ref thirdpartyEigen "Eigen" 3.2 (or greater) is available and
+                        `CGAL_EIGEN3_ENABLED` is defined, then the following overload of `Eigen_solver_traits`
+                        is provided as default value:\n
+                        `CGAL::Eigen_solver_traits<Eigen::SparseLU<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::COLAMDOrdering<int> > >`}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @return the number of holes that have been filled and whose patch has been successfully faired.
+          The patches that cannot be faired are triangulated and refined, but not faired.
+
+  @pre the halfedges of `border_halfedges` are border halfedges of distinct holes
+
+  \sa CGAL::Polygon_mesh_processing::triangulate_refine_and_fair_hole()
+  \sa CGAL::Polygon_mesh_processing::triangulate_holes()
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::size_t
+  triangulate_refine_and_fair_holes(PolygonMesh& pmesh,
+                                    const HalfedgeRange& border_halfedges,
+                                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    CGAL_precondition(CGAL::is_triangle_mesh(pmesh));
+
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor       halfedge_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor         vertex_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::face_descriptor           face_descriptor;
+    typedef typename GetVertexPointMap<PolygonMesh, CGAL_NP_CLASS>::type          VPM;
+    typedef typename boost::property_traits<VPM>::value_type                      Point;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+
+    Face_output_iterator face_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::vertex_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Vertex_output_iterator;
+
+    Vertex_output_iterator vertex_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::vertex_output_iterator));
+
+    VPM vpm = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+
+    const std::vector<halfedge_descriptor> holes(std::begin(border_halfedges), std::end(border_halfedges));
+    const std::size_t nb_holes = holes.size();
+
+    std::vector<std::vector<face_descriptor> > patches;
+    internal::triangulate_holes(pmesh, holes, patches, np);
+
+    std::vector<std::vector<vertex_descriptor> > patch_vertices(nb_holes);
+    for(std::size_t i=0; i<nb_holes; ++i)
+    {
+      if(patches[i].empty())
+        continue;
+      face_out = std::copy(patches[i].begin(), patches[i].end(), face_out);
+      face_out = refine(pmesh, patches[i], face_out, std::back_inserter(patch_vertices[i]), np).first;
+    }
+
+    CGAL_postcondition(CGAL::is_triangle_mesh(pmesh));
+
+    // the new positions are all computed before any vertex is moved
+    std::vector<std::vector<std::pair<vertex_descriptor, Point> > > fair_points(nb_holes);
+    std::vector<char> fair_success(nb_holes, false);
+    auto compute_fair_points = [&](const std::size_t i)
+    {
+      fair_success[i] = !patches[i].empty() &&
+                        internal::compute_fair_points(pmesh, patch_vertices[i], fair_points[i], np);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_holes),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            compute_fair_points(i);
+                        });
+    else
+#endif
+      for(std::size_t i=0; i<nb_holes; ++i)
+        compute_fair_points(i);
+
+    std::size_t nb_faired = 0;
+    for(std::size_t i=0; i<nb_holes; ++i)
+    {
+      vertex_out = std::copy(patch_vertices[i].begin(), patch_vertices[i].end(), vertex_out);
+      if(!fair_success[i])
+        continue;
+
+      for(const std::pair<vertex_descriptor, Point>& vp : fair_points[i])
+        put(vpm, vp.first, vp.second);
+      ++nb_faired;
+    }
+
+    return nb_faired;
+  }
+
   /*!
   \ingroup PMP_hole_filling_grp
   creates triangles to fill the hole defined by points in the range `points`.
@@ -0,0 +1,212 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/nary_boolean_operations.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Epick;
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Epeck;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+namespace Corefinement = PMP::Corefinement;
+
+template <typename Mesh>
+double volume(const Mesh& m)
+{
+  assert(CGAL::is_valid_polygon_mesh(m));
+  if(is_empty(m))
+    return 0;
+  assert(CGAL::is_closed(m) && CGAL::is_triangle_mesh(m));
+  return CGAL::to_double(PMP::volume(m));
+}
+
+bool close(const double a, const double b)
+{
+  return std::abs(a - b) <= 1e-6 * (std::max)((std::max)(std::abs(a), std::abs(b)), 1.);
+}
+
+template <typename K>
+CGAL::Surface_mesh<typename K::Point_3> cube(const double x, const double y, const double z, const double size)
+{
+  typedef typename K::Point_3                                     Point_3;
+
+  const std::vector<Point_3> points = { Point_3(x, y, z), Point_3(x + size, y, z),
+                                        Point_3(x + size, y + size, z), Point_3(x, y + size, z),
+                                        Point_3(x, y, z + size), Point_3(x + size, y, z + size),
+                                        Point_3(x + size, y + size, z + size), Point_3(x, y + size, z + size) };
+  const std::vector<std::array<std::size_t, 3> > triangles = { { 0, 2, 1 }, { 0, 3, 2 }, { 4, 5, 6 }, { 4, 6, 7 },
+                                                               { 0, 1, 5 }, { 0, 5, 4 }, { 1, 2, 6 }, { 1, 6, 5 },
+                                                               { 2, 3, 7 }, { 2, 7, 6 }, { 3, 0, 4 }, { 3, 4, 7 } };
+  CGAL::Surface_mesh<Point_3> m;
+  PMP::polygon_soup_to_polygon_mesh(points, triangles, m);
+  return m;
+}
+
+// the result of the n-ary operations must match the one of chained binary operations
+template <typename K, typename Tag>
+void test_chained(const std::vector<CGAL::Surface_mesh<typename K::Point_3> >& meshes)
+{
+  typedef CGAL::Surface_mesh<typename K::Point_3>                 Mesh;
+
+  bool ok = false;
+  Mesh union_ref = meshes[0], inter_ref = meshes[0], diff_ref = meshes[0];
+  for(std::size_t i=1; i<meshes.size(); ++i)
+  {
+    Mesh tmp1 = meshes[i], tmp2 = meshes[i], tmp3 = meshes[i];
+    ok = PMP::corefine_and_compute_union(union_ref, tmp1, union_ref);
+    assert(ok);
+    ok = PMP::corefine_and_compute_intersection(inter_ref, tmp2, inter_ref);
+    assert(ok);
+    ok = PMP::corefine_and_compute_difference(diff_ref, tmp3, diff_ref);
+    assert(ok);
+  }
+
+  Mesh union_m, inter_m, diff_m;
+  ok = PMP::compute_nary_union(meshes, union_m, CGAL::parameters::concurrency_tag(Tag()));
+  assert(ok);
+  ok = PMP::compute_nary_intersection(meshes, inter_m, CGAL::parameters::concurrency_tag(Tag()));
+  assert(ok);
+  ok = PMP::compute_nary_difference(meshes, diff_m, CGAL::parameters::concurrency_tag(Tag()));
+  assert(ok);
+
+  std::cout << "  union: " << faces(union_m).size() << " faces, volume " << volume(union_m)
+            << " (" << volume(union_ref) << ")" << std::endl;
+  std::cout << "  intersection: " << faces(inter_m).size() << " faces, volume " << volume(inter_m)
+            << " (" << volume(inter_ref) << ")" << std::endl;
+  std::cout << "  difference: " << faces(diff_m).size() << " faces, volume " << volume(diff_m)
+            << " (" << volume(diff_ref) << ")" << std::endl;
+
+  assert(close(volume(union_m), volume(union_ref)));
+  assert(close(volume(inter_m), volume(inter_ref)));
+  assert(close(volume(diff_m), volume(diff_ref)));
+  assert(!PMP::does_self_intersect(union_m));
+  CGAL_USE(ok);
+}
+
+template <typename K, typename Tag>
+void test_meshes(const std::string& filename)
+{
+  typedef CGAL::Surface_mesh<typename K::Point_3>                 Mesh;
+  typedef typename K::Vector_3                                    Vector_3;
+
+  Mesh input;
+  if(!PMP::IO::read_polygon_mesh(filename, input))
+  {
+    std::cerr << "Error reading " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  std::cout << filename << std::endl;
+  const std::array<Vector_3, 4> translations = { Vector_3(0, 0, 0), Vector_3(0.05, 0.02, 0.03),
+                                                 Vector_3(-0.04, 0.03, 0.01), Vector_3(0.01, -0.05, -0.02) };
+  std::vector<Mesh> meshes;
+  for(const Vector_3& t : translations)
+  {
+    meshes.push_back(input);
+    PMP::transform(typename K::Aff_transformation_3(CGAL::TRANSLATION, t), meshes.back());
+  }
+  test_chained<K, Tag>(meshes);
+}
+
+template <typename K, typename Tag>
+void test_cubes()
+{
+  typedef CGAL::Surface_mesh<typename K::Point_3>                 Mesh;
+
+  const auto params = CGAL::parameters::concurrency_tag(Tag());
+  bool ok = false;
+
+  // overlapping cubes, with coplanar faces
+  std::cout << "overlapping cubes" << std::endl;
+  test_chained<K, Tag>({ cube<K>(0, 0, 0, 2), cube<K>(1, 1, 0, 2), cube<K>(1, 0, 1, 2), cube<K>(0.5, 0.5, 0.5, 1) });
+
+  // disjoint cubes
+  std::vector<Mesh> disjoint = { cube<K>(0, 0, 0, 1), cube<K>(2, 0, 0, 1), cube<K>(0, 2, 0, 2) };
+  Mesh out;
+  ok = PMP::compute_nary_union(disjoint, out, params);
+  assert(ok);
+  assert(faces(out).size() == 36 && close(volume(out), 10));
+  ok = PMP::compute_nary_intersection(disjoint, out, params);
+  assert(ok);
+  assert(is_empty(out));
+  ok = PMP::compute_nary_difference(disjoint, out, params);
+  assert(ok);
+  assert(faces(out).size() == 12 && close(volume(out), 1));
+
+  // cubes sharing faces: the shared faces are not part of the union
+  std::vector<Mesh> touching = { cube<K>(0, 0, 0, 1), cube<K>(1, 0, 0, 1), cube<K>(2, 0, 0, 1) };
+  ok = PMP::compute_nary_union(touching, out, params);
+  assert(ok);
+  assert(faces(out).size() == 28 && close(volume(out), 3));
+  // the diagonals of the shared faces differ: they are refined in four triangles
+  ok = PMP::compute_nary_difference(touching, out, params);
+  assert(ok);
+  assert(faces(out).size() == 14 && close(volume(out), 1));
+  ok = PMP::compute_nary_intersection(touching, out, params);
+  assert(ok);
+  assert(is_empty(out));
+
+  // identical cubes
+  std::vector<Mesh> identical = { cube<K>(0, 0, 0, 1), cube<K>(0, 0, 0, 1), cube<K>(0, 0, 0, 1) };
+  ok = PMP::compute_nary_union(identical, out, params);
+  assert(ok);
+  assert(faces(out).size() == 12 && close(volume(out), 1));
+  ok = PMP::compute_nary_intersection(identical, out, params);
+  assert(ok);
+  assert(faces(out).size() == 12 && close(volume(out), 1));
+  ok = PMP::compute_nary_difference(identical, out, params);
+  assert(ok);
+  assert(is_empty(out));
+
+  // a cavity: the inner cube is subtracted from the outer one
+  std::vector<Mesh> nested = { cube<K>(0, 0, 0, 3), cube<K>(1, 1, 1, 1) };
+  ok = PMP::compute_nary_difference(nested, out, params);
+  assert(ok);
+  assert(faces(out).size() == 24 && close(volume(out), 26));
+  ok = PMP::compute_nary_union(nested, out, params);
+  assert(ok);
+  assert(faces(out).size() == 12 && close(volume(out), 27));
+
+  // two cubes sharing an edge: the union is not manifold and the output is not modified
+  std::vector<Mesh> edge_sharing = { cube<K>(0, 0, 0, 1), cube<K>(1, 1, 0, 1) };
+  ok = PMP::compute_nary_union(edge_sharing, out, params);
+  assert(!ok);
+  assert(faces(out).size() == 12);
+  CGAL_USE(ok);
+}
+
+template <typename Tag>
+void test()
+{
+  test_cubes<Epick, Tag>();
+  test_cubes<Epeck, Tag>();
+  test_meshes<Epick, Tag>("data-coref/sphere.off");
+}
+
+int main()
+{
+  test<CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>();
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Epick;
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Epeck;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the two meshes must be the same, including the order of their elements
+template <typename Mesh>
+void check_identical(const Mesh& m1, const Mesh& m2)
+{
+  assert(CGAL::is_valid_polygon_mesh(m1) && CGAL::is_valid_polygon_mesh(m2));
+  assert(vertices(m1).size() == vertices(m2).size());
+  assert(faces(m1).size() == faces(m2).size());
+
+  auto vit = vertices(m2).begin();
+  for(auto v : vertices(m1))
+    assert(m1.point(v) == m2.point(*vit++));
+
+  auto fit = faces(m2).begin();
+  for(auto f : faces(m1))
+  {
+    auto f2 = *fit++;
+    auto h2 = halfedge(f2, m2);
+    for(auto h : halfedges_around_face(halfedge(f, m1), m1))
+    {
+      assert(std::size_t(target(h, m1)) == std::size_t(target(h2, m2)));
+      h2 = next(h2, m2);
+    }
+  }
+}
+
+// the two meshes must have the same faces, the order of their elements might differ
+template <typename Mesh>
+void check_same_faces(const Mesh& m1, const Mesh& m2)
+{
+  typedef typename Mesh::Point                                    Point;
+
+  assert(CGAL::is_valid_polygon_mesh(m1) && CGAL::is_valid_polygon_mesh(m2));
+  assert(vertices(m1).size() == vertices(m2).size());
+
+  auto sorted_faces = [](const Mesh& m)
+  {
+    std::vector<std::array<Point, 3> > triangles;
+    for(auto f : faces(m))
+    {
+      auto h = halfedge(f, m);
+      std::array<Point, 3> t = { m.point(source(h, m)), m.point(target(h, m)), m.point(target(next(h, m), m)) };
+      std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+      triangles.push_back(t);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  };
+  assert(sorted_faces(m1) == sorted_faces(m2));
+}
+
+template <typename K>
+void test(const std::string& f1, const std::string& f2, const typename K::Vector_3& translation)
+{
+  typedef CGAL::Surface_mesh<typename K::Point_3>                 Mesh;
+
+  Mesh tm1, tm2;
+  if(!PMP::IO::read_polygon_mesh(f1, tm1) || !PMP::IO::read_polygon_mesh(f2, tm2))
+  {
+    std::cerr << "Error reading " << f1 << " or " << f2 << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  PMP::transform(typename K::Aff_transformation_3(CGAL::TRANSLATION, translation), tm2);
+
+  std::cout << f1 << " and " << f2 << std::endl;
+
+  // Boolean operations
+  {
+    Mesh tm1_s = tm1, tm2_s = tm2, tm1_p = tm1, tm2_p = tm2;
+    Mesh union_s, inter_s, diff_s, union_p, inter_p, diff_p;
+    std::array<std::optional<Mesh*>, 4> output_s, output_p;
+    output_s[PMP::Corefinement::UNION] = &union_s;
+    output_s[PMP::Corefinement::INTERSECTION] = &inter_s;
+    output_s[PMP::Corefinement::TM1_MINUS_TM2] = &diff_s;
+    output_p[PMP::Corefinement::UNION] = &union_p;
+    output_p[PMP::Corefinement::INTERSECTION] = &inter_p;
+    output_p[PMP::Corefinement::TM1_MINUS_TM2] = &diff_p;
+
+    const std::array<bool, 4> res_s = PMP::corefine_and_compute_boolean_operations(tm1_s, tm2_s, output_s);
+    const std::array<bool, 4> res_p =
+      PMP::corefine_and_compute_boolean_operations(tm1_p, tm2_p, output_p,
+                                                   CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+    assert(res_s == res_p);
+    std::cout << "  union: " << faces(union_p).size() << " faces, intersection: " << faces(inter_p).size()
+              << " faces, difference: " << faces(diff_p).size() << " faces" << std::endl;
+
+    // the input meshes are corefined in place in the same way, the output meshes have the same faces
+    check_identical(tm1_s, tm1_p);
+    check_identical(tm2_s, tm2_p);
+    if(res_s[PMP::Corefinement::UNION])
+      check_same_faces(union_s, union_p);
+    if(res_s[PMP::Corefinement::INTERSECTION])
+      check_same_faces(inter_s, inter_p);
+    if(res_s[PMP::Corefinement::TM1_MINUS_TM2])
+      check_same_faces(diff_s, diff_p);
+  }
+
+  // corefinement only, one mesh being not modified
+  {
+    Mesh tm1_s = tm1, tm2_s = tm2, tm1_p = tm1, tm2_p = tm2;
+    PMP::corefine(tm1_s, tm2_s, CGAL::parameters::default_values(), CGAL::parameters::do_not_modify(true));
+    PMP::corefine(tm1_p, tm2_p, CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()),
+                                CGAL::parameters::do_not_modify(true));
+    check_identical(tm1_s, tm1_p);
+    check_identical(tm2_s, tm2_p);
+    assert(faces(tm1_p).size() >= faces(tm1).size());
+    assert(faces(tm2_p).size() == faces(tm2).size());
+  }
+}
+
+int main()
+{
+  test<Epick>(CGAL::data_file_path("meshes/elephant.off"), CGAL::data_file_path("meshes/elephant.off"),
+              Epick::Vector_3(0.05, 0.02, 0.03));
+  test<Epick>("data-coref/sphere.off", "data-coref/sphere-2.off", Epick::Vector_3(0, 0, 0));
+  // coplanar faces
+  test<Epick>("data-coref/large_cube_coplanar.off", "data-coref/small_cube_coplanar_inside.off",
+              Epick::Vector_3(0, 0, 0));
+  test<Epick>("data-coref/cube.off", "data-coref/cube_on_cube_edge.off", Epick::Vector_3(0, 0, 0));
+  test<Epeck>(CGAL::data_file_path("meshes/elephant.off"), CGAL::data_file_path("meshes/elephant.off"),
+              Epeck::Vector_3(0.05, 0.02, 0.03));
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+#include <CGAL/Polygon_mesh_processing/tangential_relaxation.h>
+#include <CGAL/Polygon_mesh_processing/detect_features.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+struct Stats
+{
+  std::size_t nb_faces;
+  double mean_edge_length;
+  double mean_min_angle;
+  double max_distance;
+};
+
+template <typename Mesh>
+Stats stats(const Mesh& mesh, const Mesh& input)
+{
+  typedef CGAL::AABB_face_graph_triangle_primitive<Mesh>      Primitive;
+  typedef CGAL::AABB_traits_3<K, Primitive>                   Traits;
+  typedef CGAL::AABB_tree<Traits>                             Tree;
+
+  Tree tree(faces(input).first, faces(input).second, input);
+
+  Stats s;
+  s.nb_faces = faces(mesh).size();
+  s.mean_edge_length = 0;
+  for(auto e : edges(mesh))
+    s.mean_edge_length += PMP::edge_length(e, mesh);
+  s.mean_edge_length /= edges(mesh).size();
+
+  s.mean_min_angle = 0;
+  for(auto f : faces(mesh))
+  {
+    const auto h = halfedge(f, mesh);
+    const Point_3& p = get(CGAL::vertex_point, mesh, source(h, mesh));
+    const Point_3& q = get(CGAL::vertex_point, mesh, target(h, mesh));
+    const Point_3& r = get(CGAL::vertex_point, mesh, target(next(h, mesh), mesh));
+    const double a = CGAL::approximate_angle(q, p, r), b = CGAL::approximate_angle(p, q, r);
+    s.mean_min_angle += (std::min)((std::min)(a, b), 180. - a - b);
+  }
+  s.mean_min_angle /= faces(mesh).size();
+
+  s.max_distance = 0;
+  for(auto v : vertices(mesh))
+    s.max_distance = (std::max)(s.max_distance, CGAL::to_double(tree.squared_distance(get(CGAL::vertex_point, mesh, v))));
+  s.max_distance = std::sqrt(s.max_distance);
+
+  std::cout << s.nb_faces << " faces, mean edge length " << s.mean_edge_length
+            << ", mean min angle " << s.mean_min_angle << ", max distance " << s.max_distance << std::endl;
+  return s;
+}
+
+bool close(const double a, const double b, const double tol)
+{
+  return std::abs(a - b) <= tol * (std::max)(std::abs(a), std::abs(b));
+}
+
+template <typename Mesh>
+void test_remeshing(const std::string& filename)
+{
+  Mesh input;
+  if(!PMP::IO::read_polygon_mesh(filename, input) || !CGAL::is_triangle_mesh(input))
+  {
+    std::cerr << "Error reading " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  const double target_edge_length = 0.5 * PMP::edge_length(*(edges(input).first), input)
+                                  + 0.5 * PMP::edge_length(*std::next(edges(input).first), input);
+
+  Mesh seq = input, par = input;
+  PMP::isotropic_remeshing(faces(seq), target_edge_length, seq,
+                           CGAL::parameters::number_of_iterations(3));
+  PMP::isotropic_remeshing(faces(par), target_edge_length, par,
+                           CGAL::parameters::number_of_iterations(3)
+                                            .concurrency_tag(CGAL::Parallel_tag()));
+  assert(CGAL::is_valid_polygon_mesh(par) && CGAL::is_triangle_mesh(par));
+
+  // the parallel version follows the same criteria
+  const Stats s = stats(seq, input), p = stats(par, input);
+  assert(close(s.nb_faces, p.nb_faces, 0.02));
+  assert(close(s.mean_edge_length, p.mean_edge_length, 0.02));
+  assert(close(s.mean_min_angle, p.mean_min_angle, 0.02));
+  assert(p.max_distance < 1e-6 * target_edge_length + 1e-10);
+
+  // a second run is identical
+  Mesh par2 = input;
+  PMP::isotropic_remeshing(faces(par2), target_edge_length, par2,
+                           CGAL::parameters::number_of_iterations(3)
+                                            .concurrency_tag(CGAL::Parallel_tag()));
+  assert(vertices(par2).size() == vertices(par).size());
+  auto vit = vertices(par2).begin();
+  for(auto v : vertices(par))
+    assert(get(CGAL::vertex_point, par, v) == get(CGAL::vertex_point, par2, *vit++));
+}
+
+void test_relaxation(const std::string& filename)
+{
+  typedef CGAL::Surface_mesh<Point_3>                         Mesh;
+  typedef boost::graph_traits<Mesh>::edge_descriptor          edge_descriptor;
+
+  Mesh seq;
+  if(!PMP::IO::read_polygon_mesh(filename, seq))
+  {
+    std::cerr << "Error reading " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // constrain sharp edges
+  auto eif = seq.add_property_map<edge_descriptor, bool>("e:is_feature", false).first;
+  PMP::detect_sharp_edges(seq, 60, eif);
+
+  Mesh par = seq;
+  auto eif_par = par.property_map<edge_descriptor, bool>("e:is_feature").first;
+
+  PMP::tangential_relaxation(seq, CGAL::parameters::number_of_iterations(5).edge_is_constrained_map(eif));
+  PMP::tangential_relaxation(par, CGAL::parameters::number_of_iterations(5).edge_is_constrained_map(eif_par)
+                                                   .concurrency_tag(CGAL::Parallel_tag()));
+  assert(CGAL::is_valid_polygon_mesh(par));
+
+  // vertices incident to constrained edges did not move
+  for(Mesh::Vertex_index v : vertices(par))
+    for(Mesh::Halfedge_index h : halfedges_around_target(v, par))
+      if(get(eif_par, edge(h, par)))
+        assert(par.point(v) == seq.point(v));
+
+  const double area = PMP::area(seq), area_par = PMP::area(par);
+  std::cout << "relaxation: area " << area << " (sequential), " << area_par << " (parallel)" << std::endl;
+  assert(close(area, area_par, 0.01));
+}
+
+int main()
+{
+  test_remeshing<CGAL::Surface_mesh<Point_3> >(CGAL::data_file_path("meshes/elephant.off"));
+  test_remeshing<CGAL::Polyhedron_3<K> >(CGAL::data_file_path("meshes/elephant.off"));
+  test_remeshing<CGAL::Surface_mesh<Point_3> >(CGAL::data_file_path("meshes/mech-holes-shark.off"));
+  test_relaxation(CGAL::data_file_path("meshes/fandisk.off"));
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
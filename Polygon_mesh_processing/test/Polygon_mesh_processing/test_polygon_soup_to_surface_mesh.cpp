@@ -0,0 +1,188 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+typedef CGAL::Surface_mesh<Point_3>                         Mesh;
+typedef Mesh::Vertex_index                                  vertex_descriptor;
+typedef Mesh::Halfedge_index                                halfedge_descriptor;
+typedef Mesh::Face_index                                    face_descriptor;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the vertices of the faces must be those of the polygons, in the same order
+void check_mesh(const std::vector<Point_3>& points,
+                const std::vector<std::vector<std::size_t> >& polygons,
+                const Mesh& sm)
+{
+  assert(CGAL::is_valid_polygon_mesh(sm));
+  assert(sm.number_of_vertices() == points.size());
+  assert(sm.number_of_faces() == polygons.size());
+
+  for(vertex_descriptor v : vertices(sm))
+    assert(sm.point(v) == points[v]);
+
+  for(face_descriptor f : faces(sm))
+  {
+    const std::vector<std::size_t>& polygon = polygons[f];
+    halfedge_descriptor h = halfedge(f, sm);
+    std::size_t i = 0;
+    while(std::size_t(target(h, sm)) != polygon[0])
+      h = next(h, sm);
+    for(vertex_descriptor v : vertices_around_face(h, sm))
+      assert(std::size_t(v) == polygon[i++]);
+    assert(i == polygon.size());
+  }
+}
+
+template <typename Tag>
+void test_soup(const std::string& fname)
+{
+  std::vector<Point_3> points;
+  std::vector<std::vector<std::size_t> > polygons;
+  if(!CGAL::IO::read_polygon_soup(fname, points, polygons))
+  {
+    std::cerr << "Error reading " << fname << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  const bool is_mesh = PMP::is_polygon_soup_a_polygon_mesh(polygons);
+
+  Mesh sm;
+  std::vector<std::pair<std::size_t, std::size_t> > bad_edges;
+  const bool built = PMP::polygon_soup_to_surface_mesh(points, polygons, sm,
+                                                       CGAL::parameters::concurrency_tag(Tag())
+                                                                        .output_iterator(std::back_inserter(bad_edges)));
+  std::cout << fname << ": " << std::boolalpha << built << " (" << bad_edges.size() << " bad edges)" << std::endl;
+  assert(built == is_mesh);
+
+  if(!built)
+  {
+    assert(sm.is_empty());
+    for(const std::pair<std::size_t, std::size_t>& e : bad_edges)
+      assert(e.first < e.second && e.second < points.size());
+
+    // once oriented, the soup might be a mesh
+    PMP::orient_polygon_soup(points, polygons);
+    if(PMP::is_polygon_soup_a_polygon_mesh(polygons))
+    {
+      const bool converted = PMP::polygon_soup_to_surface_mesh(points, polygons, sm, CGAL::parameters::concurrency_tag(Tag()));
+      assert(converted);
+      CGAL_USE(converted);
+      check_mesh(points, polygons, sm);
+    }
+    return;
+  }
+
+  check_mesh(points, polygons, sm);
+
+  // same mesh as the one built face by face
+  Mesh ref;
+  PMP::polygon_soup_to_polygon_mesh(points, polygons, ref);
+  assert(ref.number_of_edges() == sm.number_of_edges());
+  std::size_t nb_border = 0, nb_border_ref = 0;
+  for(halfedge_descriptor h : halfedges(sm))
+    if(is_border(h, sm))
+      ++nb_border;
+  for(halfedge_descriptor h : halfedges(ref))
+    if(is_border(h, ref))
+      ++nb_border_ref;
+  assert(nb_border == nb_border_ref);
+
+  // the halfedge of a border vertex must be a border halfedge
+  for(vertex_descriptor v : vertices(sm))
+    if(halfedge(v, sm) != Mesh::null_halfedge())
+      assert(sm.is_border(v) == is_border(halfedge(v, sm), sm));
+}
+
+void test_bad_edges()
+{
+  // three triangles sharing the edge (0,1), and an edge (3, 4) with the same orientation in two triangles
+  std::vector<Point_3> points(7, CGAL::ORIGIN);
+  std::vector<std::vector<std::size_t> > polygons = { { 0, 1, 2 }, { 1, 0, 3 }, { 0, 1, 4 },
+                                                      { 3, 4, 5 }, { 3, 4, 6 } };
+
+  Mesh sm;
+  std::vector<std::pair<std::size_t, std::size_t> > bad_edges;
+  bool ok = PMP::polygon_soup_to_surface_mesh(points, polygons, sm,
+                                              CGAL::parameters::output_iterator(std::back_inserter(bad_edges)));
+  assert(!ok);
+  assert(sm.is_empty());
+  assert(bad_edges.size() == 2);
+  assert(bad_edges[0] == std::make_pair(std::size_t(0), std::size_t(1)));
+  assert(bad_edges[1] == std::make_pair(std::size_t(3), std::size_t(4)));
+
+  // two triangles sharing a vertex, and nothing else
+  polygons = { { 0, 1, 2 }, { 0, 3, 4 } };
+  ok = PMP::polygon_soup_to_surface_mesh(points, polygons, sm);
+  assert(!ok);
+  assert(sm.is_empty());
+
+  // a polygon with twice the same vertex
+  polygons = { { 0, 1, 2, 0, 3, 4 } };
+  ok = PMP::polygon_soup_to_surface_mesh(points, polygons, sm);
+  assert(!ok);
+
+  // an out of range point
+  polygons = { { 0, 1, 7 } };
+  ok = PMP::polygon_soup_to_surface_mesh(points, polygons, sm);
+  assert(!ok);
+
+  // isolated points are vertices
+  polygons = { { 0, 1, 2 } };
+  ok = PMP::polygon_soup_to_surface_mesh(points, polygons, sm);
+  assert(ok);
+  assert(sm.number_of_vertices() == 7 && sm.number_of_faces() == 1 && sm.number_of_edges() == 3);
+  assert(CGAL::is_valid_polygon_mesh(sm));
+  CGAL_USE(ok);
+}
+
+template <typename Tag>
+void test()
+{
+  test_soup<Tag>("data_polygon_soup/bad_cube.off");
+  test_soup<Tag>("data_polygon_soup/isolated_singular_vertex_one_cc.off");
+  test_soup<Tag>("data_polygon_soup/isolated_vertices.off");
+  test_soup<Tag>("data_polygon_soup/nm_vertex_and_edge.off");
+  test_soup<Tag>("data_polygon_soup/one_duplicated_edge.off");
+  test_soup<Tag>("data_polygon_soup/one_duplicated_edge_sharing_vertex.off");
+  test_soup<Tag>("data_polygon_soup/partial_overlap.off");
+  test_soup<Tag>("data_polygon_soup/incompatible_orientation.off");
+
+  test_soup<Tag>(CGAL::data_file_path("meshes/blobby_3cc.off"));
+  test_soup<Tag>(CGAL::data_file_path("meshes/elephant.off"));
+  test_soup<Tag>("data/joint_refined.off");
+  test_soup<Tag>(CGAL::data_file_path("meshes/mech-holes-shark.off"));
+  test_soup<Tag>("data/non_manifold_vertex.off");
+  test_soup<Tag>("data/two_tris_collinear.off");
+  test_soup<Tag>("data/U.off");
+  test_soup<Tag>("data/cube_quad2.off");
+}
+
+int main()
+{
+  test_bad_edges();
+
+  test<CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>();
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Polygon_mesh_processing/triangulate_hole.h>
+#include <CGAL/Polygon_mesh_processing/border.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the two meshes must be the same, including the order of their elements
+template <typename Mesh>
+void check_identical(const Mesh& m1, const Mesh& m2)
+{
+  assert(CGAL::is_valid_polygon_mesh(m1) && CGAL::is_valid_polygon_mesh(m2));
+  assert(vertices(m1).size() == vertices(m2).size());
+  assert(faces(m1).size() == faces(m2).size());
+
+  auto vit = vertices(m2).begin();
+  for(auto v : vertices(m1))
+    assert(get(CGAL::vertex_point, m1, v) == get(CGAL::vertex_point, m2, *vit++));
+
+  auto fit = faces(m2).begin();
+  for(auto f : faces(m1))
+  {
+    auto f2 = *fit++;
+    auto h2 = halfedge(f2, m2);
+    for(auto h : halfedges_around_face(halfedge(f, m1), m1))
+    {
+      assert(get(CGAL::vertex_point, m1, target(h, m1)) == get(CGAL::vertex_point, m2, target(h2, m2)));
+      h2 = next(h2, m2);
+    }
+  }
+}
+
+template <typename Mesh>
+std::vector<typename boost::graph_traits<Mesh>::halfedge_descriptor> holes(const Mesh& mesh)
+{
+  std::vector<typename boost::graph_traits<Mesh>::halfedge_descriptor> border_cycles;
+  PMP::extract_boundary_cycles(mesh, std::back_inserter(border_cycles));
+  return border_cycles;
+}
+
+template <typename Mesh, typename NamedParameters>
+void test_triangulate_holes(const Mesh& input, const NamedParameters& np)
+{
+  typedef typename boost::graph_traits<Mesh>::face_descriptor       face_descriptor;
+
+  // reference: one hole after the other
+  Mesh ref = input;
+  std::size_t nb_filled_ref = 0;
+  std::vector<face_descriptor> patches_ref;
+  for(auto h : holes(ref))
+  {
+    const std::size_t nb_faces = patches_ref.size();
+    PMP::triangulate_hole(ref, h, np.face_output_iterator(std::back_inserter(patches_ref)));
+    if(patches_ref.size() != nb_faces)
+      ++nb_filled_ref;
+  }
+
+  Mesh seq = input;
+  std::vector<face_descriptor> patches_seq;
+  const std::size_t nb_filled_seq =
+    PMP::triangulate_holes(seq, holes(seq), np.face_output_iterator(std::back_inserter(patches_seq)));
+  std::cout << "  " << nb_filled_seq << " holes filled out of " << holes(input).size() << std::endl;
+  assert(nb_filled_seq == nb_filled_ref);
+  assert(patches_seq.size() == patches_ref.size());
+  check_identical(ref, seq);
+
+  Mesh par = input;
+  std::vector<face_descriptor> patches_par;
+  const std::size_t nb_filled_par =
+    PMP::triangulate_holes(par, holes(par), np.face_output_iterator(std::back_inserter(patches_par))
+                                              .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(nb_filled_par == nb_filled_ref);
+  assert(patches_par.size() == patches_ref.size());
+  check_identical(ref, par);
+}
+
+template <typename Mesh>
+void test_triangulate_refine_and_fair_holes(const Mesh& input)
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor   halfedge_descriptor;
+  typedef typename boost::graph_traits<Mesh>::face_descriptor       face_descriptor;
+  typedef typename boost::graph_traits<Mesh>::vertex_descriptor     vertex_descriptor;
+
+  Mesh seq = input;
+  std::vector<face_descriptor> faces_seq;
+  std::vector<vertex_descriptor> vertices_seq;
+  const std::size_t nb_faired_seq =
+    PMP::triangulate_refine_and_fair_holes(seq, holes(seq),
+                                           CGAL::parameters::face_output_iterator(std::back_inserter(faces_seq))
+                                                            .vertex_output_iterator(std::back_inserter(vertices_seq)));
+  std::cout << "  " << nb_faired_seq << " holes faired, " << vertices_seq.size() << " new vertices" << std::endl;
+  assert(nb_faired_seq > 0);
+  assert(faces(seq).size() == faces(input).size() + faces_seq.size());
+  assert(vertices(seq).size() == vertices(input).size() + vertices_seq.size());
+  assert(CGAL::is_triangle_mesh(seq));
+
+  // the patches are faired concurrently, with the same result
+  Mesh par = input;
+  std::vector<face_descriptor> faces_par;
+  std::vector<vertex_descriptor> vertices_par;
+  const std::size_t nb_faired_par =
+    PMP::triangulate_refine_and_fair_holes(par, holes(par),
+                                           CGAL::parameters::face_output_iterator(std::back_inserter(faces_par))
+                                                            .vertex_output_iterator(std::back_inserter(vertices_par))
+                                                            .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(nb_faired_par == nb_faired_seq);
+  assert(faces_par.size() == faces_seq.size() && vertices_par.size() == vertices_seq.size());
+  check_identical(seq, par);
+
+  // a single hole is processed as with `triangulate_refine_and_fair_hole()`
+  Mesh single = input, ref = input;
+  const bool success = std::get<0>(PMP::triangulate_refine_and_fair_hole(ref, holes(ref).front()));
+  const std::size_t nb_faired_single =
+    PMP::triangulate_refine_and_fair_holes(single, std::vector<halfedge_descriptor>(1, holes(single).front()));
+  assert(nb_faired_single == (success ? 1 : 0));
+  CGAL_USE(success);
+  CGAL_USE(nb_faired_single);
+  check_identical(ref, single);
+}
+
+template <typename Mesh>
+Mesh read(const std::string& filename)
+{
+  Mesh input;
+  if(!PMP::IO::read_polygon_mesh(filename, input) || !CGAL::is_triangle_mesh(input))
+  {
+    std::cerr << "Error reading " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  std::cout << filename << std::endl;
+  return input;
+}
+
+template <typename Mesh>
+void test(const std::string& filename)
+{
+  const Mesh input = read<Mesh>(filename);
+  test_triangulate_holes(input, CGAL::parameters::default_values());
+  test_triangulate_holes(input, CGAL::parameters::use_2d_constrained_delaunay_triangulation(true));
+  test_triangulate_holes(input, CGAL::parameters::use_delaunay_triangulation(false));
+}
+
+int main()
+{
+  typedef CGAL::Surface_mesh<K::Point_3>                            Surface_mesh;
+
+  test<Surface_mesh>(CGAL::data_file_path("meshes/mech-holes-shark.off"));
+  test<Surface_mesh>(CGAL::data_file_path("meshes/elephant-with-holes.off"));
+  test<CGAL::Polyhedron_3<K> >(CGAL::data_file_path("meshes/mech-holes-shark.off"));
+
+  // the vertices of a `Polyhedron_3` are ordered by address in the linear systems of the fairing,
+  // two copies of a mesh are thus not faired in the exact same way
+  test_triangulate_refine_and_fair_holes(read<Surface_mesh>(CGAL::data_file_path("meshes/mech-holes-shark.off")));
+  test_triangulate_refine_and_fair_holes(read<Surface_mesh>(CGAL::data_file_path("meshes/elephant-with-holes.off")));
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -29,13 +29,23 @@ increase memory consumption but provide better search performance.
 See also the `GeneralDistance` and `FuzzyQueryItem` concepts for
 additional requirements when using such a cache.
 
+\tparam EnableBlockedPointsCache can be `Tag_true` or `Tag_false`, and defaults to `Tag_false`.
+When set to `Tag_true`, another copy of the points coordinates is stored leaf by leaf
+and, inside each leaf, coordinate by coordinate (structure of arrays).
+`Orthogonal_k_neighbor_search` then computes the distances between the query and all the points
+of a leaf at once, in loops that the compiler can vectorize, provided that the distance
+offers the function `transformed_distances_from_blocked_coordinates()`, which is the case of
+`Euclidean_distance` and of `Distance_adapter` with a `Euclidean_distance`.
+This is mostly beneficial when the leaves contain many points, for example with a
+bucket size of 32 given to the splitter, and it increases the memory consumption.
+
 \sa `CGAL::Kd_tree_node<Traits>`
 \sa `CGAL::Search_traits_2<Kernel>`
 \sa `CGAL::Search_traits_3<Kernel>`
 \sa `CGAL::Search_traits<FT_,Point,CartesianIterator,ConstructCartesianIterator>`
 
 */
-template< typename Traits, typename Splitter, typename UseExtendedNode, typename EnablePointsCache >
+template< typename Traits, typename Splitter, typename UseExtendedNode, typename EnablePointsCache, typename EnableBlockedPointsCache >
 class Kd_tree {
 public:
 
@@ -160,6 +170,26 @@ The value type of the `InputIterator` must be `Point_d`.
 */
 template <class InputIterator> void insert(InputIterator first, InputIterator beyond);
 
+/*!
+Inserts the point `p` in the `k-d` tree. Contrary to `insert()`, if the internal
+data structure is already built, it is updated instead of being invalidated:
+`p` is added to the leaf containing it, and this leaf is replaced by a subtree
+if it then contains more than `bucket_size()` points.
+The tree is thus immediately ready for queries.
+To preserve the balance of the tree, the internal data structure is nevertheless
+invalidated once the number of points dynamically inserted reaches the number of points
+present at the last call to `build()`, so that the amortized cost of an insertion
+is in \cgalBigO{b \log n}, `b` being the bucket size.
+If the internal data structure is not built, this function is equivalent to `insert()`.
+*/
+void dynamic_insert(Point_d p);
+
+/*!
+Calls `dynamic_insert()` for each element of the sequence `[first, beyond)`.
+The value type of the `InputIterator` must be `Point_d`.
+*/
+template <class InputIterator> void dynamic_insert(InputIterator first, InputIterator beyond);
+
 /*!
 Removes the point `p` from the `k-d` tree. It uses `equal_to_p` to identify
 the point after locating it, which can matter in particular when 2 points are
@@ -85,6 +85,27 @@ Orthogonal_k_neighbor_search(SpatialTree tree, Query_item query, unsigned int k=
 bool search_nearest=true,
 OrthogonalDistance d=OrthogonalDistance(),bool sorted=true);
 
+/*!
+Computes, for each query item of the random access range `queries`, its `k'`
+approximate nearest neighbors in `tree`, with `k' = min(k, tree.size())`,
+using distance `d` and approximation factor `eps`. The neighbors of the `i`-th
+query item are written, sorted by increasing distance, in
+`neighbors[i*k'], ..., neighbors[i*k'+k'-1]`, and `k'` is returned.
+
+Contrary to the construction of one search object per query, the internal
+buffers of the search are allocated only once per thread.
+
+\tparam ConcurrencyTag enables sequential versus parallel computation. Possible values are `Sequential_tag`,
+`Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam QueryRange a model of `RandomAccessRange` whose value type is `Query_item`.
+\tparam RandomAccessIterator a random access output iterator with value type `Point_d`,
+for which `neighbors + queries.size()*k'` is valid.
+*/
+template <typename ConcurrencyTag = Sequential_tag, typename QueryRange, typename RandomAccessIterator>
+static std::size_t search_all(const SpatialTree& tree, const QueryRange& queries, unsigned int k,
+                              RandomAccessIterator neighbors, FT eps=FT(0.0),
+                              OrthogonalDistance d=OrthogonalDistance());
+
 /*!
 Returns a const iterator to the approximate nearest or furthest neighbor.
 */
@@ -79,6 +79,18 @@ template <typename Coord_iterator>
 FT interruptible_transformed_distance(
   Query_item q, Coord_iterator begin, Coord_iterator end, FT stop_if_geq_to_this) const;
 
+/*!
+Optional: must be defined when used with a `Kd_tree` where `EnableBlockedPointsCache`
+is set to `Tag_true`, for the distances to be computed leaf by leaf.
+
+Writes in `distances[j]`, for `j` in `[0, n)`, the transformed distance between `q`
+and the `j`-th point whose Cartesian coordinates are stored coordinate by coordinate
+from `begin`: the `i`-th coordinate of the `j`-th point is `begin[i*n + j]`.
+*/
+template <typename Coord_iterator>
+void transformed_distances_from_blocked_coordinates(
+  Query_item q, Coord_iterator begin, std::size_t n, FT* distances) const;
+
 /*!
 Returns the transformed distance between `q` and
 the point on the boundary of `r` closest to `q`.
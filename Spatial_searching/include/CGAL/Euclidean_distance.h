@@ -115,6 +115,79 @@ namespace CGAL {
       return distance;
     }
 
+    // Computes the transformed distances between `q` and the `n` points whose
+    // coordinates are stored coordinate by coordinate from `it_coord_begin`:
+    // the `i`-th coordinate of the `j`-th point is `it_coord_begin[i*n + j]`
+    template <typename Coord_iterator>
+    inline void transformed_distances_from_blocked_coordinates(const Query_item& q,
+                                                               Coord_iterator it_coord_begin,
+                                                               std::size_t n,
+                                                               FT* distances) const
+    {
+      transformed_distances_from_blocked_coordinates(q, &*it_coord_begin, n, distances, D());
+    }
+
+    // Static dim = 3, single pass
+    inline void transformed_distances_from_blocked_coordinates(const Query_item& q,
+                                                               const FT* coords,
+                                                               std::size_t n,
+                                                               FT* distances,
+                                                               Dimension_tag<3>) const
+    {
+      typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits.construct_cartesian_const_iterator_d_object();
+      typename SearchTraits::Cartesian_const_iterator_d qit = construct_it(q);
+      const FT qx = *qit++, qy = *qit++, qz = *qit;
+      const FT* xs = coords;
+      const FT* ys = coords + n;
+      const FT* zs = coords + 2*n;
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        const FT dx = qx - xs[j], dy = qy - ys[j], dz = qz - zs[j];
+        distances[j] = dx*dx + dy*dy + dz*dz;
+      }
+    }
+
+    // Static dim = 2, single pass
+    inline void transformed_distances_from_blocked_coordinates(const Query_item& q,
+                                                               const FT* coords,
+                                                               std::size_t n,
+                                                               FT* distances,
+                                                               Dimension_tag<2>) const
+    {
+      typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits.construct_cartesian_const_iterator_d_object();
+      typename SearchTraits::Cartesian_const_iterator_d qit = construct_it(q);
+      const FT qx = *qit++, qy = *qit;
+      const FT* xs = coords;
+      const FT* ys = coords + n;
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        const FT dx = qx - xs[j], dy = qy - ys[j];
+        distances[j] = dx*dx + dy*dy;
+      }
+    }
+
+    // Other cases: static dim > 3 or dynamic dim, one pass per coordinate
+    template <typename Dim>
+    inline void transformed_distances_from_blocked_coordinates(const Query_item& q,
+                                                               const FT* coords,
+                                                               std::size_t n,
+                                                               FT* distances,
+                                                               Dim) const
+    {
+      std::fill(distances, distances + n, FT(0));
+      typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits.construct_cartesian_const_iterator_d_object();
+      typename SearchTraits::Cartesian_const_iterator_d qit = construct_it(q), qe = construct_it(q, 1);
+      for (; qit != qe; ++qit, coords += n)
+      {
+        const FT qc = *qit;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+          const FT diff = qc - coords[j];
+          distances[j] += diff*diff;
+        }
+      }
+    }
+
     // During the computation, if the partially-computed distance `pcd` gets greater or equal
     // to `stop_if_geq_to_this`, the computation is stopped and `pcd` is returned
     template <typename Coord_iterator>
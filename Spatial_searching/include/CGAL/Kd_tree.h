@@ -68,7 +68,8 @@ template <
   class SearchTraits,
   class Splitter_=Sliding_midpoint<SearchTraits>,
   class UseExtendedNode = Tag_true,
-  class EnablePointsCache = Tag_false>
+  class EnablePointsCache = Tag_false,
+  class EnableBlockedPointsCache = Tag_false>
 class Kd_tree {
 
 public:
@@ -81,8 +82,8 @@ public:
   typedef Kd_tree_node<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Node;
   typedef Kd_tree_leaf_node<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Leaf_node;
   typedef Kd_tree_internal_node<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Internal_node;
-  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Tree;
-  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Self;
+  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache, EnableBlockedPointsCache> Tree;
+  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache, EnableBlockedPointsCache> Self;
 
   typedef Node* Node_handle;
   typedef const Node* Node_const_handle;
@@ -101,6 +102,7 @@ public:
   typedef typename internal::Get_dimension_tag<SearchTraits>::Dimension D;
 
   typedef EnablePointsCache Enable_points_cache;
+  typedef EnableBlockedPointsCache Enable_blocked_points_cache;
 
 private:
 
@@ -124,6 +126,12 @@ private:
   // for faster queries (reduce the number of cache misses)
   std::vector<FT> points_cache;
 
+  // Store another copy of the point coordinates, leaf by leaf and,
+  // in each leaf, coordinate by coordinate (structure of arrays), so that
+  // the distances between a query and all the points of a leaf can be
+  // computed with vector instructions
+  std::vector<FT> blocked_points_cache;
+
   // Instead of storing the points in arrays in the Kd_tree_node
   // we put all the data in a vector in the Kd_tree.
   // and we only store an iterator range in the Kd_tree_node.
@@ -139,6 +147,17 @@ private:
   bool built_;
   std::size_t removed_=0;
 
+  // Points inserted with `dynamic_insert()` are stored at the end of `pts`:
+  // when a leaf receives a new point, its points are moved there (unless
+  // they already are), leaving `relocated_` unused entries in `pts`.
+  std::size_t relocated_=0;
+  std::size_t dynamically_inserted_=0;
+  std::size_t built_size_=0;
+
+  // Leaves replaced by a subtree in `split_leaf()`: they stay in
+  // `leaf_nodes`, unused, until the next construction of the tree.
+  std::size_t dead_leaves_=0;
+
   // protected copy constructor
   Kd_tree(const Tree& tree)
     : traits_(tree.traits_),built_(tree.built_),dim_(-1)
@@ -148,13 +167,14 @@ private:
   // we do this in the tree class. The advantage is that we then can optimize
   // the allocation of the nodes.
 
-  // The leaf node
+  // The leaf node. `offset` is the position in `pts` of the point
+  // referenced by the first element of `data`.
   Node_handle
-  create_leaf_node(Point_container& c)
+  create_leaf_node(Point_container& c, std::ptrdiff_t offset = 0)
   {
     Leaf_node node(static_cast<unsigned int>(c.size()));
     std::ptrdiff_t tmp = c.begin() - data.begin();
-    node.data = pts.begin() + tmp;
+    node.data = pts.begin() + offset + tmp;
 
 #ifdef CGAL_TBB_STRUCTURE_IN_KD_TREE
     return &*(leaf_nodes.push_back(node));
@@ -181,7 +201,8 @@ private:
   //       a potential performance gain through the Compact_container
   template <typename ConcurrencyTag>
   void
-  create_internal_node(Node_handle n, Point_container& c, const ConcurrencyTag& tag)
+  create_internal_node(Node_handle n, Point_container& c, const ConcurrencyTag& tag,
+                       std::ptrdiff_t offset = 0)
   {
     Internal_node_handle nh = static_cast<Internal_node_handle>(n);
     CGAL_assertion (nh != nullptr);
@@ -193,24 +214,24 @@ private:
 
     handle_extended_node (nh, c, c_low, UseExtendedNode());
 
-    if (try_parallel_internal_node_creation (nh, c, c_low, tag))
+    if (try_parallel_internal_node_creation (nh, c, c_low, tag, offset))
       return;
 
     if (c_low.size() > split.bucket_size())
     {
       nh->lower_ch = new_internal_node();
-      create_internal_node (nh->lower_ch, c_low, tag);
+      create_internal_node (nh->lower_ch, c_low, tag, offset);
     }
     else
-      nh->lower_ch = create_leaf_node(c_low);
+      nh->lower_ch = create_leaf_node(c_low, offset);
 
     if (c.size() > split.bucket_size())
     {
       nh->upper_ch = new_internal_node();
-      create_internal_node (nh->upper_ch, c, tag);
+      create_internal_node (nh->upper_ch, c, tag, offset);
     }
     else
-      nh->upper_ch = create_leaf_node(c);
+      nh->upper_ch = create_leaf_node(c, offset);
   }
 
   void handle_extended_node (Internal_node_handle nh, Point_container& c, Point_container& c_low, const Tag_true&)
@@ -240,7 +261,7 @@ private:
   inline void handle_extended_node (Internal_node_handle, Point_container&, Point_container&, const Tag_false&) { }
 
   inline bool try_parallel_internal_node_creation (Internal_node_handle, Point_container&,
-                                                   Point_container&, const Sequential_tag&)
+                                                   Point_container&, const Sequential_tag&, std::ptrdiff_t)
   {
     return false;
   }
@@ -248,7 +269,8 @@ private:
 #ifdef CGAL_TBB_STRUCTURE_IN_KD_TREE
 
   inline bool try_parallel_internal_node_creation (Internal_node_handle nh, Point_container& c,
-                                                   Point_container& c_low, const Parallel_tag& tag)
+                                                   Point_container& c_low, const Parallel_tag& tag,
+                                                   std::ptrdiff_t offset)
   {
     /*
       The two child branches are computed in parallel if and only if:
@@ -265,8 +287,8 @@ private:
     {
       nh->lower_ch = new_internal_node();
       nh->upper_ch = new_internal_node();
-      tbb::parallel_invoke (std::bind (&Self::create_internal_node<Parallel_tag>, this, nh->lower_ch, std::ref(c_low), std::cref(tag)),
-                            std::bind (&Self::create_internal_node<Parallel_tag>, this, nh->upper_ch, std::ref(c), std::cref(tag)));
+      tbb::parallel_invoke (std::bind (&Self::create_internal_node<Parallel_tag>, this, nh->lower_ch, std::ref(c_low), std::cref(tag), offset),
+                            std::bind (&Self::create_internal_node<Parallel_tag>, this, nh->upper_ch, std::ref(c), std::cref(tag), offset));
       return true;
     }
 
@@ -378,9 +400,18 @@ public:
     }
     pts.swap(ptstmp);
 
+    if (Enable_blocked_points_cache::value)
+    {
+      blocked_points_cache.resize(dim_ * pts.size());
+      for(std::size_t i = 0; i < leaf_nodes.size(); ++i)
+        update_blocked_points_cache(leaf_nodes[i]);
+    }
+
     data.clear();
     data.shrink_to_fit();
 
+    built_size_ = pts.size();
+    dynamically_inserted_ = 0;
     built_ = true;
   }
 
@@ -424,6 +455,21 @@ public:
   }
 
 private:
+  // Fills the block of the blocked cache corresponding to the points of `node`
+  void update_blocked_points_cache(const Leaf_node& node)
+  {
+    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+    const std::size_t n = node.size();
+    typename std::vector<FT>::iterator block = blocked_points_cache.begin() + dim_ * (node.begin() - pts.begin());
+    std::size_t j = 0;
+    for (iterator it = node.begin(); it != node.end(); ++it, ++j)
+    {
+      typename std::vector<FT>::iterator out = block + j;
+      for (auto cit = construct_it(*it), end = construct_it(*it, 0); cit != end; ++cit, out += n)
+        *out = *cit;
+    }
+  }
+
   //any call to this function is for the moment not threadsafe
   void const_build() const {
     #ifdef CGAL_HAS_THREADS
@@ -442,7 +488,7 @@ public:
 
   void invalidate_build()
   {
-    if(removed_!=0){
+    if(removed_!=0 || relocated_!=0){
       // Walk the tree to collect the remaining points.
       // Writing directly to pts would likely work, but better be safe.
       std::vector<Point_d> ptstmp;
@@ -450,12 +496,16 @@ public:
       root()->tree_items(std::back_inserter(ptstmp));
       pts.swap(ptstmp);
       removed_=0;
+      relocated_=0;
       CGAL_assertion(is_built()); // the rest of the cleanup must happen
     }
     if(is_built()){
       internal_nodes.clear();
       leaf_nodes.clear();
+      dead_leaves_ = 0;
       data.clear();
+      points_cache.clear();
+      blocked_points_cache.clear();
       delete bbox;
       built_ = false;
     }
@@ -466,6 +516,7 @@ public:
     invalidate_build();
     pts.clear();
     removed_ = 0;
+    relocated_ = 0;
   }
 
   void
@@ -483,6 +534,155 @@ public:
     pts.insert(pts.end(),first, beyond);
   }
 
+  // Inserts `p` without invalidating the tree if it is already built:
+  // `p` is added to the leaf whose cell contains it, and the leaf is
+  // replaced by a subtree when it contains more than `bucket_size()` points.
+  // The tree is only invalidated, and rebuilt by the next query, when the
+  // number of points has doubled since the last construction, when
+  // two thirds of the storage are unused, or when half of the leaves
+  // have been replaced, so that the amortized cost of an insertion is
+  // in O(bucket_size() * log(n)).
+  void
+  dynamic_insert(const Point_d& p)
+  {
+    if(is_built() && (dynamically_inserted_ >= built_size_ || removed_ + relocated_ > 2*size() ||
+                      2*dead_leaves_ > leaf_nodes.size()))
+      invalidate_build();
+
+    if(!is_built()){
+      pts.push_back(p);
+      return;
+    }
+
+    ++dynamically_inserted_;
+    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+    typename SearchTraits::Cartesian_const_iterator_d pit = construct_it(p);
+
+    // extend the bounding box of the tree if needed
+    for(int i = 0; i < dim_; ++i){
+      const FT c = pit[i];
+      if(c < bbox->min_coord(i))
+        bbox->set_lower_bound(i, c);
+      if(c > bbox->max_coord(i))
+        bbox->set_upper_bound(i, c);
+    }
+
+    // locate the leaf, following the convention of `remove()` for points on a cutting plane
+    Internal_node_handle parent = nullptr;
+    bool islower = false;
+    Node_handle node = tree_root;
+    while(!node->is_leaf()){
+      parent = static_cast<Internal_node_handle>(node);
+      const FT c = pit[parent->cutting_dimension()];
+      islower = (c <= parent->cutting_value());
+      extend_extended_node(parent, c, islower, UseExtendedNode());
+      node = islower ? parent->lower() : parent->upper();
+    }
+    Leaf_node_handle leaf = static_cast<Leaf_node_handle>(node);
+
+    // the points of the leaf must be consecutive: move them at the end of `pts`
+    std::vector<Point_d> new_points;
+    std::size_t leaf_begin = leaf->begin() - pts.begin();
+    if(leaf->end() != pts.end()){
+      new_points.assign(leaf->begin(), leaf->end());
+      relocated_ += leaf->size();
+      leaf_begin = pts.size();
+    }
+    new_points.push_back(p);
+    append_points(new_points);
+    leaf->data = pts.begin() + leaf_begin;
+    ++(leaf->n);
+
+    if(leaf->size() > split.bucket_size())
+      split_leaf(leaf, parent, islower);
+    else if(Enable_blocked_points_cache::value)
+      update_blocked_points_cache(*leaf);
+  }
+
+  template <class InputIterator>
+  void
+  dynamic_insert(InputIterator first, InputIterator beyond)
+  {
+    for(; first != beyond; ++first)
+      dynamic_insert(*first);
+  }
+
+private:
+  void extend_extended_node(Internal_node_handle nh, const FT& c, bool islower, const Tag_true&)
+  {
+    if(islower){
+      if(c < nh->lower_low_val) nh->lower_low_val = c;
+      if(c > nh->lower_high_val) nh->lower_high_val = c;
+    }else{
+      if(c < nh->upper_low_val) nh->upper_low_val = c;
+      if(c > nh->upper_high_val) nh->upper_high_val = c;
+    }
+  }
+
+  inline void extend_extended_node(Internal_node_handle, const FT&, bool, const Tag_false&) { }
+
+  // Appends points at the end of `pts` and of the caches, keeping the leaves valid
+  void append_points(const std::vector<Point_d>& new_points)
+  {
+    if(pts.size() + new_points.size() > pts.capacity()){
+      std::vector<std::ptrdiff_t> offsets(leaf_nodes.size());
+      for(std::size_t i = 0; i < leaf_nodes.size(); ++i)
+        offsets[i] = leaf_nodes[i].data - pts.begin();
+      pts.reserve(2 * (pts.size() + new_points.size()));
+      for(std::size_t i = 0; i < leaf_nodes.size(); ++i)
+        leaf_nodes[i].data = pts.begin() + offsets[i];
+    }
+    pts.insert(pts.end(), new_points.begin(), new_points.end());
+
+    if(Enable_points_cache::value){
+      typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+      for(const Point_d& p : new_points)
+        points_cache.insert(points_cache.end(), construct_it(p), construct_it(p, 0));
+    }
+    if(Enable_blocked_points_cache::value)
+      blocked_points_cache.resize(dim_ * pts.size());
+  }
+
+  // Replaces a leaf containing too many points by a subtree
+  void split_leaf(Leaf_node_handle leaf, Internal_node_handle parent, bool islower)
+  {
+    const std::size_t first = leaf->begin() - pts.begin();
+    const std::size_t n = leaf->size();
+    const std::size_t first_new_leaf = leaf_nodes.size();
+
+    data.clear();
+    for(std::size_t i = 0; i < n; ++i)
+      data.push_back(&pts[first + i]);
+    Point_container c(dim_, data.begin(), data.end(), traits_);
+    Node_handle subtree = new_internal_node();
+    create_internal_node(subtree, c, Sequential_tag(), static_cast<std::ptrdiff_t>(first));
+
+    // reorder the points of the leaf as in `build()`
+    std::vector<Point_d> ptstmp(n);
+    for(std::size_t i = 0; i < n; ++i)
+      ptstmp[i] = *data[i];
+    std::copy(ptstmp.begin(), ptstmp.end(), pts.begin() + first);
+    data.clear();
+
+    if(Enable_points_cache::value){
+      typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+      typename std::vector<FT>::iterator out = points_cache.begin() + dim_ * first;
+      for(const Point_d& p : ptstmp)
+        out = std::copy(construct_it(p), construct_it(p, 0), out);
+    }
+    if(Enable_blocked_points_cache::value)
+      for(std::size_t i = first_new_leaf; i < leaf_nodes.size(); ++i)
+        update_blocked_points_cache(leaf_nodes[i]);
+
+    if(parent == nullptr)
+      tree_root = subtree;
+    else if(islower)
+      parent->lower_ch = subtree;
+    else
+      parent->upper_ch = subtree;
+    ++dead_leaves_;
+  }
+
 private:
   struct Equal_by_coordinates {
     SearchTraits const* traits;
@@ -553,9 +753,16 @@ private:
       iterator lasti = lnode->end() - 1;
       if (pi != lasti) {
         // Hack to get a non-const iterator
-        std::iter_swap(pts.begin()+(pi-pts.begin()), pts.begin()+(lasti-pts.begin()));
+        const std::size_t i = pi - pts.begin(), lasti_index = lasti - pts.begin();
+        std::iter_swap(pts.begin()+i, pts.begin()+lasti_index);
+        if (Enable_points_cache::value)
+          std::swap_ranges(points_cache.begin() + dim_*i, points_cache.begin() + dim_*(i+1),
+                           points_cache.begin() + dim_*lasti_index);
       }
       lnode->drop_last_point();
+      // the layout of the block of the leaf depends on its size
+      if (Enable_blocked_points_cache::value)
+        update_blocked_points_cache(*lnode);
     } else if (!equal_to_p(*lnode->begin())) {
       // FIXME: we should ensure this never happens
       return false;
@@ -679,6 +886,14 @@ public:
     return points_cache.begin();
   }
 
+  // If the `j`-th point of the leaf `node` of size `n` is the `i`-th point of the tree,
+  // its `d`-th coordinate is `blocked_cache_begin(node)[d*n + j]`
+  typename std::vector<FT>::const_iterator
+    blocked_cache_begin(Leaf_node_const_handle node) const
+  {
+    return blocked_points_cache.begin() + dim_ * (node->begin() - pts.begin());
+  }
+
   const_iterator
   begin() const
   {
@@ -694,7 +909,7 @@ public:
   size_type
   size() const
   {
-    return pts.size()-removed_;
+    return pts.size()-removed_-relocated_;
   }
 
   // Print statistics of the tree.
@@ -28,15 +28,15 @@ namespace CGAL {
 
   CGAL_GENERATE_MEMBER_DETECTOR(contains_point_given_as_coordinates);
 
-  template <class SearchTraits, class Splitter, class UseExtendedNode, class EnablePointsCache>
+  template <class SearchTraits, class Splitter, class UseExtendedNode, class EnablePointsCache, class EnableBlockedPointsCache>
   class Kd_tree;
 
   template < class TreeTraits, class Splitter, class UseExtendedNode, class EnablePointsCache >
   class Kd_tree_node {
 
-    friend class Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache>;
+    template <class, class, class, class, class> friend class Kd_tree;
 
-    typedef Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache> Kdt;
+    typedef Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache, Tag_false> Kdt;
 
     typedef typename Kdt::Node_handle Node_handle;
     typedef typename Kdt::Node_const_handle Node_const_handle;
@@ -426,9 +426,9 @@ namespace CGAL {
   template < class TreeTraits, class Splitter, class UseExtendedNode, class EnablePointsCache >
   class Kd_tree_leaf_node : public Kd_tree_node< TreeTraits, Splitter, UseExtendedNode, EnablePointsCache >{
 
-    friend class Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache>;
+    template <class, class, class, class, class> friend class Kd_tree;
 
-    typedef typename Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache>::iterator iterator;
+    typedef typename Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache, Tag_false>::iterator iterator;
     typedef Kd_tree_node< TreeTraits, Splitter, UseExtendedNode, EnablePointsCache> Base;
     typedef typename TreeTraits::Point_d Point_d;
 
@@ -488,9 +488,9 @@ namespace CGAL {
   template < class TreeTraits, class Splitter, class UseExtendedNode, class EnablePointsCache>
   class Kd_tree_internal_node : public Kd_tree_node< TreeTraits, Splitter, UseExtendedNode, EnablePointsCache >{
 
-    friend class Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache>;
+    template <class, class, class, class, class> friend class Kd_tree;
 
-    typedef Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache> Kdt;
+    typedef Kd_tree<TreeTraits, Splitter, UseExtendedNode, EnablePointsCache, Tag_false> Kdt;
 
     typedef Kd_tree_node< TreeTraits, Splitter, UseExtendedNode, EnablePointsCache> Base;
     typedef typename Kdt::Node_handle Node_handle;
@@ -638,9 +638,9 @@ namespace CGAL {
  class Kd_tree_internal_node<TreeTraits,Splitter,Tag_false,EnablePointsCache>
    : public Kd_tree_node< TreeTraits, Splitter, Tag_false, EnablePointsCache >
  {
-    friend class Kd_tree<TreeTraits, Splitter, Tag_false, EnablePointsCache>;
+    template <class, class, class, class, class> friend class Kd_tree;
 
-    typedef Kd_tree<TreeTraits, Splitter, Tag_false, EnablePointsCache> Kdt;
+    typedef Kd_tree<TreeTraits, Splitter, Tag_false, EnablePointsCache, Tag_false> Kdt;
 
     typedef Kd_tree_node< TreeTraits, Splitter, Tag_false, EnablePointsCache> Base;
     typedef typename Kdt::Node_handle Node_handle;
@@ -22,7 +22,17 @@
 #include <CGAL/Spatial_searching/internal/K_neighbor_search.h>
 #include <CGAL/Spatial_searching/internal/Search_helpers.h>
 
+#include <CGAL/tags.h>
+
 #include <iterator> // for std::distance
+#include <optional>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
 
 namespace CGAL {
 
@@ -43,6 +53,7 @@ private:
 
   internal::Distance_helper<Distance, SearchTraits> m_distance_helper;
   std::vector<FT> dists;
+  std::vector<FT> m_leaf_distances; // only used with a blocked cache of the points
   int m_dim;
   Tree const& m_tree;
 
@@ -54,30 +65,101 @@ public:
     m_distance_helper(this->distance_instance, tree.traits()),
     m_tree(tree)
   {
-    if (tree.empty()) return;
+    compute_neighbors(sorted);
+  }
+
+  // Computes, for each query item of the random access range `queries`, its `k'` nearest
+  // neighbors in `tree`, sorted by increasing distance, with `k' = min(k, tree.size())`.
+  // The neighbors of the `i`-th query are written in `neighbors[i*k'], ..., neighbors[i*k'+k'-1]`,
+  // and `k'` is returned. The internal buffers of the search are reused from one query
+  // to the next one, and the queries are processed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  template <typename ConcurrencyTag = Sequential_tag, typename QueryRange, typename RandomAccessIterator>
+  static std::size_t
+  search_all(const Tree& tree, const QueryRange& queries, unsigned int k,
+             RandomAccessIterator neighbors, FT Eps=FT(0.0), const Distance& d=Distance())
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const std::size_t nb_neighbors = (std::min)(std::size_t(k), std::size_t(tree.size()));
+    if (nb_neighbors == 0)
+      return 0;
+
+    tree.root(); // triggers the construction of the tree before any concurrent access
+
+    auto first = std::begin(queries);
+    const std::size_t nb_queries = static_cast<std::size_t>(std::distance(first, std::end(queries)));
+
+    auto search_range = [&](std::optional<Orthogonal_k_neighbor_search>& search,
+                            std::size_t begin, std::size_t end)
+    {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const typename Base::Query_item& q = *(first + i);
+        if (search)
+          search->compute_neighbors(q);
+        else
+          search.emplace(tree, q, k, Eps, true, d, true);
+
+        RandomAccessIterator out = neighbors + i * nb_neighbors;
+        for (typename Base::advanced_iterator it = search->advanced_begin(); it != search->advanced_end(); ++it)
+          *out++ = *(it->first);
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::enumerable_thread_specific<std::optional<Orthogonal_k_neighbor_search> > searches;
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_queries),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          search_range(searches.local(), r.begin(), r.end());
+                        });
+      return nb_neighbors;
+    }
+#endif
+
+    std::optional<Orthogonal_k_neighbor_search> search;
+    search_range(search, 0, nb_queries);
+    return nb_neighbors;
+  }
 
-    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it=tree.traits().construct_cartesian_const_iterator_d_object();
+private:
+
+  // Searches the neighbors of a new query item, reusing the memory allocated by the previous search
+  void compute_neighbors(const typename Base::Query_item& q)
+  {
+    this->reset(q);
+    compute_neighbors(true);
+  }
+
+  void compute_neighbors(bool sorted)
+  {
+    if (m_tree.empty()) return;
+
+    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it=m_tree.traits().construct_cartesian_const_iterator_d_object();
     query_object_it = construct_it(this->query_object);
 
     m_dim = static_cast<int>(std::distance(query_object_it, construct_it(this->query_object,0)));
 
-    dists.resize(m_dim);
-    for(int i=0;i<m_dim;i++)
-        dists[i]=0;
+    dists.assign(m_dim, FT(0));
 
     FT distance_to_root;
     if (this->search_nearest){
-      distance_to_root = this->distance_instance.min_distance_to_rectangle(q, tree.bounding_box(),dists);
-      compute_nearest_neighbors_orthogonally(tree.root(), distance_to_root);
+      distance_to_root = this->distance_instance.min_distance_to_rectangle(this->query_object, m_tree.bounding_box(),dists);
+      compute_nearest_neighbors_orthogonally(m_tree.root(), distance_to_root);
     }
     else {
-      distance_to_root = this->distance_instance.max_distance_to_rectangle(q, tree.bounding_box(),dists);
-      compute_furthest_neighbors_orthogonally(tree.root(), distance_to_root);
+      distance_to_root = this->distance_instance.max_distance_to_rectangle(this->query_object, m_tree.bounding_box(),dists);
+      compute_furthest_neighbors_orthogonally(m_tree.root(), distance_to_root);
     }
 
     if (sorted) this->queue.sort();
   }
-private:
+
 
   // With cache
   void search_nearest_in_leaf(typename Tree::Leaf_node_const_handle node, Tag_true)
@@ -149,6 +231,24 @@ private:
     }
   }
 
+  // With blocked cache: the distances to all the points of the leaf are computed at once
+  void search_nearest_in_leaf_by_blocks(typename Tree::Leaf_node_const_handle node)
+  {
+    const std::size_t n = node->size();
+    if (m_leaf_distances.size() < n)
+      m_leaf_distances.resize(n);
+    this->distance_instance.transformed_distances_from_blocked_coordinates(
+      this->query_object, m_tree.blocked_cache_begin(node), n, m_leaf_distances.data());
+
+    typename Tree::iterator it_node_point = node->begin();
+    for (std::size_t j = 0; j < n; ++j, ++it_node_point)
+    {
+      this->number_of_items_visited++;
+      if (!this->queue.full() || m_leaf_distances[j] < this->queue.top().second)
+        this->queue.insert(std::make_pair(&(*it_node_point), m_leaf_distances[j]));
+    }
+  }
+
   void compute_nearest_neighbors_orthogonally(typename Base::Node_const_handle N, FT rd)
   {
     if (N->is_leaf())
@@ -159,8 +259,13 @@ private:
       this->number_of_leaf_nodes_visited++;
       if (node->size() > 0)
       {
-        typename internal::Has_points_cache<Tree, internal::has_Enable_points_cache<Tree>::type::value>::type dummy;
-        search_nearest_in_leaf(node, dummy);
+        if constexpr (internal::Use_blocked_points_cache<Tree, Distance>::type::value)
+          search_nearest_in_leaf_by_blocks(node);
+        else
+        {
+          typename internal::Has_points_cache<Tree, internal::has_Enable_points_cache<Tree>::type::value>::type dummy;
+          search_nearest_in_leaf(node, dummy);
+        }
       }
     }
     else
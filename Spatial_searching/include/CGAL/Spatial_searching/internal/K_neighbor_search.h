@@ -137,6 +137,16 @@ protected:
         return (distance > queue.top().second*multiplication_factor);
   }
 
+  // Prepares a new search for the query item `q`, reusing the memory of the queue
+  void reset(const Query_item& q)
+  {
+    number_of_internal_nodes_visited = 0;
+    number_of_leaf_nodes_visited = 0;
+    number_of_items_visited = 0;
+    query_object = q;
+    queue.clear();
+  }
+
 public:
 
   iterator begin() const
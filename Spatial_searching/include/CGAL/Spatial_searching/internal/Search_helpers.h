@@ -43,7 +43,25 @@ struct Has_points_cache<Tree, false>
 
 CGAL_GENERATE_MEMBER_DETECTOR(transformed_distance_from_coordinates);
 CGAL_GENERATE_MEMBER_DETECTOR(interruptible_transformed_distance);
+CGAL_GENERATE_MEMBER_DETECTOR(transformed_distances_from_blocked_coordinates);
 BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(has_Enable_points_cache, Enable_points_cache, false)
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(has_Enable_blocked_points_cache, Enable_blocked_points_cache, false)
+
+// Helper struct to know at compile-time if the tree stores a blocked cache of the points
+// and if the distance can use it
+template <typename Tree, typename Distance,
+          bool has_enable_blocked_points_cache = has_Enable_blocked_points_cache<Tree>::value>
+struct Use_blocked_points_cache
+{
+  typedef Tag_false type;
+};
+
+template <typename Tree, typename Distance>
+struct Use_blocked_points_cache<Tree, Distance, true>
+{
+  typedef Boolean_tag<Tree::Enable_blocked_points_cache::value &&
+                      has_transformed_distances_from_blocked_coordinates<Distance>::value> type;
+};
 
 
 
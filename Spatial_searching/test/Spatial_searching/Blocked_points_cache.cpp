@@ -0,0 +1,127 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Cartesian_d.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/point_generators_d.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_d.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/property_map.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                    K;
+typedef K::Point_3                                                        Point_3;
+typedef CGAL::Search_traits_3<K>                                          Traits_3;
+
+typedef CGAL::Cartesian_d<double>                                         Kd;
+typedef Kd::Point_d                                                       Point_d;
+typedef CGAL::Search_traits_d<Kd>                                         Traits_d;
+
+// Compares the neighbors found using a tree with a blocked cache
+// to the ones found using a tree without cache
+template <typename Traits, typename BlockedTree, typename Tree, typename Point>
+void compare(const BlockedTree& blocked_tree, const Tree& tree, const std::vector<Point>& queries, unsigned int k,
+             const typename CGAL::Orthogonal_k_neighbor_search<Traits, typename CGAL::internal::Spatial_searching_default_distance<Traits>::type,
+                                                               typename Tree::Splitter, Tree>::Distance& distance
+               = typename CGAL::internal::Spatial_searching_default_distance<Traits>::type())
+{
+  typedef typename CGAL::internal::Spatial_searching_default_distance<Traits>::type Distance;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits, Distance, typename Tree::Splitter, Tree> Search;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits, Distance, typename Tree::Splitter, BlockedTree> Blocked_search;
+
+  for(const Point& q : queries)
+  {
+    Search search(tree, q, k, 0, true, distance);
+    Blocked_search blocked_search(blocked_tree, q, k, 0, true, distance);
+    assert(std::distance(search.begin(), search.end()) == std::distance(blocked_search.begin(), blocked_search.end()));
+    typename Blocked_search::iterator bit = blocked_search.begin();
+    for(typename Search::iterator it = search.begin(); it != search.end(); ++it, ++bit)
+      assert(it->second == bit->second);
+  }
+}
+
+void test_3()
+{
+  typedef CGAL::Kd_tree<Traits_3, CGAL::Sliding_midpoint<Traits_3>, CGAL::Tag_true, CGAL::Tag_false, CGAL::Tag_true> Blocked_tree;
+  typedef CGAL::Kd_tree<Traits_3, CGAL::Sliding_midpoint<Traits_3>, CGAL::Tag_true, CGAL::Tag_false> Tree;
+
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point_3> gen(1., rng);
+  std::vector<Point_3> points, queries;
+  for(int i=0; i<3000; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i<300; ++i)
+    queries.push_back(*gen++);
+
+  Blocked_tree blocked_tree(points.begin(), points.end());
+  Tree tree(points.begin(), points.end());
+  compare<Traits_3>(blocked_tree, tree, queries, 1);
+  compare<Traits_3>(blocked_tree, tree, queries, 10);
+
+  // the blocked cache is kept consistent when points are removed
+  for(std::size_t i=0; i<points.size(); i+=3)
+  {
+    blocked_tree.remove(points[i]);
+    tree.remove(points[i]);
+  }
+  compare<Traits_3>(blocked_tree, tree, queries, 10);
+
+  // ... and rebuilt when points are inserted
+  blocked_tree.insert(queries.begin(), queries.end());
+  tree.insert(queries.begin(), queries.end());
+  compare<Traits_3>(blocked_tree, tree, queries, 10);
+}
+
+void test_3_with_indices()
+{
+  typedef CGAL::Pointer_property_map<Point_3>::const_type Point_map;
+  typedef CGAL::Search_traits_adapter<std::size_t, Point_map, Traits_3> Traits;
+  typedef CGAL::Distance_adapter<std::size_t, Point_map, CGAL::Euclidean_distance<Traits_3> > Distance;
+  typedef CGAL::Kd_tree<Traits, CGAL::Sliding_midpoint<Traits>, CGAL::Tag_true, CGAL::Tag_false, CGAL::Tag_true> Blocked_tree;
+  typedef CGAL::Kd_tree<Traits, CGAL::Sliding_midpoint<Traits>, CGAL::Tag_true, CGAL::Tag_false> Tree;
+
+  CGAL::Random rng(1);
+  CGAL::Random_points_in_cube_3<Point_3> gen(1., rng);
+  std::vector<Point_3> points, queries;
+  for(int i=0; i<3000; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i<300; ++i)
+    queries.push_back(*gen++);
+
+  const std::vector<Point_3>& const_points = points;
+  Point_map point_map = CGAL::make_property_map(const_points);
+  Blocked_tree blocked_tree(CGAL::make_counting_range<std::size_t>(0, points.size()), Blocked_tree::Splitter(), Traits(point_map));
+  Tree tree(CGAL::make_counting_range<std::size_t>(0, points.size()), Tree::Splitter(), Traits(point_map));
+  compare<Traits>(blocked_tree, tree, queries, 10, Distance(point_map));
+}
+
+void test_d()
+{
+  typedef CGAL::Kd_tree<Traits_d, CGAL::Sliding_midpoint<Traits_d>, CGAL::Tag_true, CGAL::Tag_true, CGAL::Tag_true> Blocked_tree;
+  typedef CGAL::Kd_tree<Traits_d, CGAL::Sliding_midpoint<Traits_d>, CGAL::Tag_true, CGAL::Tag_false> Tree;
+
+  CGAL::Random rng(2);
+  CGAL::Random_points_in_cube_d<Point_d> gen(5, 1., rng);
+  std::vector<Point_d> points, queries;
+  for(int i=0; i<2000; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i<200; ++i)
+    queries.push_back(*gen++);
+
+  Blocked_tree blocked_tree(points.begin(), points.end());
+  Tree tree(points.begin(), points.end());
+  compare<Traits_d>(blocked_tree, tree, queries, 10);
+}
+
+int main()
+{
+  test_3();
+  test_3_with_indices();
+  test_d();
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
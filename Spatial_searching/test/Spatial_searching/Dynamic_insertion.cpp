@@ -0,0 +1,106 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/K_neighbor_search.h>
+#include <CGAL/Fuzzy_sphere.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                    K;
+typedef K::Point_3                                                        Point;
+typedef CGAL::Search_traits_3<K>                                          Traits;
+typedef CGAL::Sliding_midpoint<Traits>                                    Splitter;
+typedef CGAL::Euclidean_distance<Traits>                                  Distance;
+typedef CGAL::Fuzzy_sphere<Traits>                                        Sphere;
+
+// Checks the results of queries against a brute force computation
+template <typename Search, typename Tree>
+void check(const Tree& tree, const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  assert(tree.size() == points.size());
+  for(const Point& q : queries)
+  {
+    std::vector<double> distances;
+    for(const Point& p : points)
+      distances.push_back(CGAL::squared_distance(p, q));
+    std::sort(distances.begin(), distances.end());
+
+    Search search(tree, q, 5);
+    std::size_t i = 0;
+    for(typename Search::iterator it = search.begin(); it != search.end(); ++it, ++i)
+      assert(it->second == distances[i]);
+    assert(i == (std::min)(std::size_t(5), points.size()));
+
+    std::vector<Point> in_sphere;
+    tree.search(std::back_inserter(in_sphere), Sphere(q, 0.3));
+    assert(in_sphere.size() == std::size_t(std::upper_bound(distances.begin(), distances.end(), 0.09) - distances.begin()));
+  }
+}
+
+template <typename Tree, typename Search>
+void test()
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rng);
+  std::vector<Point> points, queries;
+  for(int i=0; i<2000; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i<100; ++i)
+    queries.push_back(*gen++);
+
+  Tree tree(points.begin(), points.end(), Splitter(10));
+  tree.build();
+
+  // insertions inside and outside the bounding box of the tree do not trigger a rebuild
+  for(int i=0; i<500; ++i)
+  {
+    const Point p = (i % 2 == 0) ? *gen++ : Point(1.5 + rng.get_double(), rng.get_double(), -2 * rng.get_double());
+    tree.dynamic_insert(p);
+    points.push_back(p);
+  }
+  assert(tree.is_built());
+  check<Search>(tree, points, queries);
+
+  // removals and insertions interleaved
+  for(int i=0; i<300; ++i)
+  {
+    tree.remove(points[i]);
+    const Point p = *gen++;
+    tree.dynamic_insert(p);
+    points.push_back(p);
+  }
+  points.erase(points.begin(), points.begin() + 300);
+  check<Search>(tree, points, queries);
+
+  // the tree is eventually rebuilt when it grows too much
+  std::vector<Point> more_points;
+  for(int i=0; i<5000; ++i)
+    more_points.push_back(*gen++);
+  tree.dynamic_insert(more_points.begin(), more_points.end());
+  points.insert(points.end(), more_points.begin(), more_points.end());
+  check<Search>(tree, points, queries);
+
+  // dynamic insertion in a tree that is not built
+  Tree other_tree;
+  other_tree.dynamic_insert(points.begin(), points.end());
+  check<Search>(other_tree, points, queries);
+}
+
+int main()
+{
+  typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_false> Tree;
+  typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_true, CGAL::Tag_true> Cached_tree;
+  typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_false, CGAL::Tag_false> Non_extended_tree;
+
+  test<Tree, CGAL::Orthogonal_k_neighbor_search<Traits, Distance, Splitter, Tree> >();
+  test<Cached_tree, CGAL::Orthogonal_k_neighbor_search<Traits, Distance, Splitter, Cached_tree> >();
+  test<Non_extended_tree, CGAL::K_neighbor_search<Traits, Distance, Splitter, Non_extended_tree> >();
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
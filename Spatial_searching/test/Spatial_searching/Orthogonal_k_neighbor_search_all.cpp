@@ -0,0 +1,63 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/property_map.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                  K;
+typedef K::Point_3                                                      Point;
+typedef CGAL::Random_points_in_cube_3<Point>                            Random_points_iterator;
+typedef CGAL::Search_traits_3<K>                                        Traits_base;
+typedef CGAL::Pointer_property_map<Point>::const_type                   Point_map;
+typedef CGAL::Search_traits_adapter<std::size_t, Point_map, Traits_base> Traits;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits>                      Neighbor_search;
+typedef Neighbor_search::Tree                                           Tree;
+typedef Neighbor_search::Distance                                       Distance;
+
+template <typename ConcurrencyTag>
+void test(const std::vector<Point>& points, const std::vector<Point>& queries, unsigned int k)
+{
+  Point_map point_map = CGAL::make_property_map(points);
+  Distance distance(point_map);
+  Tree tree(CGAL::make_counting_range<std::size_t>(0, points.size()), Tree::Splitter(), Traits(point_map));
+
+  std::vector<std::size_t> neighbors(queries.size() * k);
+  const std::size_t nb = Neighbor_search::search_all<ConcurrencyTag>(tree, queries, k, neighbors.begin(), 0., distance);
+  assert(nb == (std::min)(std::size_t(k), points.size()));
+
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    Neighbor_search search(tree, queries[i], k, 0., true, distance);
+    std::size_t j = 0;
+    for(Neighbor_search::iterator it = search.begin(); it != search.end(); ++it, ++j)
+      assert(CGAL::squared_distance(points[neighbors[i*nb + j]], queries[i]) ==
+             CGAL::squared_distance(points[it->first], queries[i]));
+    assert(j == nb);
+  }
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+  Random_points_iterator rpit(1.0, rng);
+  std::vector<Point> points, queries;
+  for(int i=0; i<5000; ++i)
+    points.push_back(*rpit++);
+  for(int i=0; i<2000; ++i)
+    queries.push_back(*rpit++);
+
+  test<CGAL::Sequential_tag>(points, queries, 12);
+  test<CGAL::Parallel_if_available_tag>(points, queries, 12);
+
+  // more neighbors than points
+  std::vector<Point> few_points(points.begin(), points.begin() + 5);
+  test<CGAL::Sequential_tag>(few_points, queries, 12);
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
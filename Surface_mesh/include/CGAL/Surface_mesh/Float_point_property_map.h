@@ -0,0 +1,150 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_SURFACE_MESH_FLOAT_POINT_PROPERTY_MAP_H
+#define CGAL_SURFACE_MESH_FLOAT_POINT_PROPERTY_MAP_H
+
+#include <CGAL/license/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include <boost/property_map/property_map.hpp>
+
+#include <tuple>
+
+namespace CGAL {
+
+  /// \ingroup PkgSurface_mesh
+  /// This class is a property map that stores the coordinates of the vertices of a
+  /// `Surface_mesh` in three vertex properties of type `float`, named `"v:float_x"`,
+  /// `"v:float_y"`, and `"v:float_z"`: each coordinate is a consecutive block of memory
+  /// (structure of arrays) with half the size of the corresponding coordinates of
+  /// the \c "v:point" property when it uses double precision.
+  ///
+  /// It is meant for read-mostly pipelines (rendering, bounding boxes, normals, areas,
+  /// construction of AABB trees, ...) on very large meshes, in which the memory bandwidth
+  /// spent on reading points dominates: it can be passed as the named parameter
+  /// `vertex_point_map` to the functions of the BGL and of \ref PkgPolygonMeshProcessing
+  /// that use inexact constructions.
+  ///
+  /// The float coordinates are a copy of the points of the mesh at the time of the creation
+  /// of the property map, or of the last call to `update()`: they are not modified when the
+  /// points of the mesh are modified, and the coordinates of vertices added to the mesh
+  /// afterwards are zero until they are set with `put()`. As other properties, they are
+  /// preserved by `Surface_mesh::collect_garbage()`.
+  ///
+  /// @tparam P the point type of the mesh, which must be a 3D point type providing
+  ///         the functions `x()`, `y()`, and `z()`
+  /// @tparam Point_3 the value type of the property map, which must be constructible
+  ///         from three `float`s. It is the type of the points seen by algorithms
+  ///         using the property map.
+  ///
+  /// \cgalModels{ReadWritePropertyMap}
+template <typename P, typename Point_3 = P>
+class Surface_mesh_float_point_map
+{
+public:
+  typedef Surface_mesh<P>                                                      Mesh;
+
+  typedef typename Mesh::Vertex_index                                          key_type;
+  typedef Point_3                                                              value_type;
+  typedef value_type                                                           reference;
+  typedef boost::read_write_property_map_tag                                   category;
+
+  /// The type of the property map of a single coordinate.
+  typedef typename Mesh::template Property_map<key_type, float>                Coordinate_map;
+
+  /// default constructor, the property map cannot be used.
+  Surface_mesh_float_point_map() { }
+
+  /// adds the float coordinate properties to `sm`, and fills them with the points of `sm`.
+  /// If the properties already exist, they are reused as they are.
+  explicit Surface_mesh_float_point_map(Mesh& sm)
+  {
+    bool created;
+    std::tie(m_x, created) = sm.template add_property_map<key_type, float>("v:float_x", 0.f);
+    m_y = sm.template add_property_map<key_type, float>("v:float_y", 0.f).first;
+    m_z = sm.template add_property_map<key_type, float>("v:float_z", 0.f).first;
+
+    if(created)
+      update(sm);
+  }
+
+  /// copies the points of `sm` into the float coordinates.
+  /// \pre The property map was created from `sm`.
+  void update(const Mesh& sm)
+  {
+    for(key_type v : sm.vertices())
+    {
+      const P& p = sm.point(v);
+      m_x[v] = float(CGAL::to_double(p.x()));
+      m_y[v] = float(CGAL::to_double(p.y()));
+      m_z[v] = float(CGAL::to_double(p.z()));
+    }
+  }
+
+  /// removes the float coordinate properties from `sm`, freeing their memory.
+  /// The property map cannot be used afterwards.
+  /// \pre The property map was created from `sm`.
+  void remove(Mesh& sm)
+  {
+    sm.remove_property_map(m_x);
+    sm.remove_property_map(m_y);
+    sm.remove_property_map(m_z);
+  }
+
+  /// returns `true` if the property map can be used.
+  explicit operator bool() const
+  {
+    return bool(m_x);
+  }
+
+  /// \name Coordinate Arrays
+  /// The coordinates of the vertex with index `i` are at position `i` of each array,
+  /// including for removed vertices. These arrays are invalidated when vertices are
+  /// added to the mesh.
+  /// @{
+  const float* x_data() const { return m_x.data(); }
+  const float* y_data() const { return m_y.data(); }
+  const float* z_data() const { return m_z.data(); }
+  /// @}
+
+  /// returns the point of `v`, constructed from its float coordinates.
+  friend value_type get(const Surface_mesh_float_point_map& pm, const key_type& v)
+  {
+    return value_type(pm.m_x[v], pm.m_y[v], pm.m_z[v]);
+  }
+
+  /// sets the float coordinates of `v` to those of `p`, rounded to the nearest `float`.
+  friend void put(const Surface_mesh_float_point_map& pm, const key_type& v, const value_type& p)
+  {
+    pm.m_x[v] = float(CGAL::to_double(p.x()));
+    pm.m_y[v] = float(CGAL::to_double(p.y()));
+    pm.m_z[v] = float(CGAL::to_double(p.z()));
+  }
+
+private:
+  Coordinate_map m_x, m_y, m_z;
+};
+
+/// \ingroup PkgSurface_mesh
+/// returns `Surface_mesh_float_point_map<P>(sm)`.
+template <typename P>
+Surface_mesh_float_point_map<P>
+make_float_point_map(Surface_mesh<P>& sm)
+{
+  return Surface_mesh_float_point_map<P>(sm);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_FLOAT_POINT_PROPERTY_MAP_H
@@ -1398,6 +1398,24 @@ public:
     template <typename Visitor>
     void collect_garbage(Visitor& visitor);
 
+    /// permutes the elements of the mesh: the vertex `vertex_order[i]` gets the index `i`,
+    /// and the face `face_order[i]` gets the index `i`. The edges are ordered as they
+    /// are first met when walking around the faces in their new order, followed by the edges
+    /// not incident to any face; the two halfedges of an edge keep their relative order.
+    /// The values of all the properties are moved along with their elements.
+    /// Garbage is collected first.
+    ///
+    /// This is useful to improve the locality of memory accesses of algorithms
+    /// traversing the mesh, see `CGAL::hilbert_sort_elements()`.
+    ///
+    /// \pre `vertex_order` and `face_order` are permutations of the vertices and faces of the mesh,
+    ///      after garbage collection.
+    /// \attention As for garbage collection, elements get new indices:
+    /// indices stored in an auxiliary data structure or in a property
+    /// are no longer referring to the right elements.
+    void permute_elements(const std::vector<Vertex_index>& vertex_order,
+                          const std::vector<Face_index>& face_order);
+
     /// controls the recycling or not of simplices previously marked as removed
     /// upon addition of new elements.
     /// When set to `true` (default value), new elements are first picked in the garbage (if any)
@@ -2207,6 +2225,11 @@ private: //--------------------------------------------------- helper functions
     /// if `v` is a border vertex.
     void adjust_incoming_halfedge(Vertex_index v);
 
+    /// moves the element of index `order[i]` to index `i`, using `swap(i0, i1)`
+    /// to exchange two elements. Returns the map from the old to the new indices.
+    template <typename Index, typename Swap>
+    std::vector<size_type> apply_permutation(const std::vector<Index>& order, const Swap& swap);
+
 private: //------------------------------------------------------- private data
     Properties::Property_container<Self, Vertex_index> vprops_;
     Properties::Property_container<Self, Halfedge_index> hprops_;
@@ -2714,6 +2737,110 @@ collect_garbage(Visitor &visitor)
     garbage_ = false;
 }
 
+template <typename P>
+template <typename Index, typename Swap>
+std::vector<typename Surface_mesh<P>::size_type>
+Surface_mesh<P>::
+apply_permutation(const std::vector<Index>& order, const Swap& swap)
+{
+    // the permutation is applied in place with transpositions: `current[i]` is the
+    // original index of the element at position `i`, and `position` is its inverse
+    const size_type n = static_cast<size_type>(order.size());
+    std::vector<size_type> current(n), position(n);
+    for (size_type i=0; i<n; ++i)
+        current[i] = position[i] = i;
+
+    for (size_type i=0; i<n; ++i)
+    {
+        const size_type j = position[size_type(order[i])];
+        if (j == i)
+            continue;
+
+        swap(i, j);
+        position[current[i]] = j;
+        current[j] = current[i];
+        current[i] = size_type(order[i]);
+        position[current[i]] = i;
+    }
+
+    // old index -> new index
+    return position;
+}
+
+template <typename P>
+void
+Surface_mesh<P>::
+permute_elements(const std::vector<Vertex_index>& vertex_order,
+                 const std::vector<Face_index>& face_order)
+{
+    collect_garbage();
+
+    const size_type nV = num_vertices(), nE = num_edges(), nF = num_faces();
+    CGAL_precondition(vertex_order.size() == nV);
+    CGAL_precondition(face_order.size() == nF);
+
+    // order the edges as they are met around the faces
+    std::vector<Edge_index> edge_order;
+    edge_order.reserve(nE);
+    std::vector<bool> is_ordered(nE, false);
+    for (Face_index f : face_order)
+    {
+        Halfedge_index h = halfedge(f), done = h;
+        do {
+            const size_type e = size_type(h) / 2;
+            if (!is_ordered[e])
+            {
+                is_ordered[e] = true;
+                edge_order.push_back(Edge_index(e));
+            }
+            h = next(h);
+        } while (h != done);
+    }
+    for (size_type e=0; e<nE; ++e)
+        if (!is_ordered[e])
+            edge_order.push_back(Edge_index(e));
+
+    const std::vector<size_type> vmap =
+      apply_permutation(vertex_order, [this](size_type i0, size_type i1) { vprops_.swap(i0, i1); });
+    const std::vector<size_type> emap =
+      apply_permutation(edge_order, [this](size_type i0, size_type i1) {
+                                      eprops_.swap(i0, i1);
+                                      hprops_.swap(2*i0,   2*i1);
+                                      hprops_.swap(2*i0+1, 2*i1+1);
+                                    });
+    const std::vector<size_type> fmap =
+      apply_permutation(face_order, [this](size_type i0, size_type i1) { fprops_.swap(i0, i1); });
+
+    auto hmap = [&emap](Halfedge_index h) {
+      return Halfedge_index(2 * emap[size_type(h) / 2] + size_type(h) % 2);
+    };
+
+    // update vertex connectivity
+    for (size_type i=0; i<nV; ++i)
+    {
+        const Vertex_index v(i);
+        if (!is_isolated(v))
+            set_halfedge(v, hmap(halfedge(v)));
+    }
+
+    // update halfedge connectivity
+    for (size_type i=0; i<2*nE; ++i)
+    {
+        const Halfedge_index h(i);
+        set_target(h, Vertex_index(vmap[size_type(target(h))]));
+        set_next(h, hmap(next(h)));
+        if (!is_border(h))
+            set_face(h, Face_index(fmap[size_type(face(h))]));
+    }
+
+    // update face connectivity
+    for (size_type i=0; i<nF; ++i)
+    {
+        const Face_index f(i);
+        set_halfedge(f, hmap(halfedge(f)));
+    }
+}
+
 #ifndef DOXYGEN_RUNNING
 namespace collect_garbage_internal {
 struct Dummy_visitor{
@@ -0,0 +1,132 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_SURFACE_MESH_HILBERT_SORT_H
+#define CGAL_SURFACE_MESH_HILBERT_SORT_H
+
+#include <CGAL/license/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include <CGAL/Dimension.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace CGAL {
+namespace Surface_mesh_internal {
+
+// sorts `indices` along a Hilbert curve, `points` being a property map from the indices to the points
+template <typename Index, typename PointMap, typename Policy>
+void hilbert_sort_indices(std::vector<Index>& indices, const PointMap points, const Policy policy)
+{
+  typedef typename boost::property_traits<PointMap>::value_type                Point;
+  typedef typename Kernel_traits<Point>::Kernel                                Kernel;
+
+  if constexpr(Ambient_dimension<Point>::value == 2)
+  {
+    typedef Spatial_sort_traits_adapter_2<Kernel, PointMap>                    Search_traits;
+    hilbert_sort(indices.begin(), indices.end(), Search_traits(points), policy);
+  }
+  else
+  {
+    typedef Spatial_sort_traits_adapter_3<Kernel, PointMap>                    Search_traits;
+    hilbert_sort(indices.begin(), indices.end(), Search_traits(points), policy);
+  }
+}
+
+// the centroid of the vertices of `f`
+template <typename P>
+P face_centroid(const Surface_mesh<P>& sm, typename Surface_mesh<P>::Face_index f)
+{
+  typedef typename Kernel_traits<P>::Kernel::FT                                FT;
+
+  constexpr int dim = Ambient_dimension<P>::value;
+
+  FT c[3] = { FT(0), FT(0), FT(0) };
+  int n = 0;
+  for(typename Surface_mesh<P>::Vertex_index v : vertices_around_face(sm.halfedge(f), sm))
+  {
+    const P& p = sm.point(v);
+    for(int i=0; i<dim; ++i)
+      c[i] += p[i];
+    ++n;
+  }
+
+  if constexpr(dim == 2)
+    return P(c[0] / n, c[1] / n);
+  else
+    return P(c[0] / n, c[1] / n, c[2] / n);
+}
+
+} // namespace Surface_mesh_internal
+
+/// \ingroup PkgSurface_mesh
+/// reorders the elements of `sm` along a Hilbert curve, so that elements that are close
+/// in space get close indices, and are thus close in memory: vertices are sorted along
+/// the curve according to their points, faces according to the centroids of their vertices,
+/// and edges follow the order of the faces (see `Surface_mesh::permute_elements()`).
+///
+/// Meshes read from files or produced by algorithms such as remeshing have elements
+/// in an order that is mostly unrelated to their position: reordering them improves the
+/// locality of the memory accesses of algorithms that traverse the mesh, as well as
+/// the construction of spatial search structures such as AABB trees.
+///
+/// Garbage is collected first, and the values of all properties are moved along with
+/// their elements. As for garbage collection, indices stored in auxiliary data structures
+/// or in properties are no longer referring to the right elements.
+///
+/// @tparam P the point type of the mesh, a 2D or 3D point type of a \cgal kernel
+/// @tparam Policy either `Hilbert_sort_median_policy` (default), which splits the point
+///         sets at their medians and adapts to the distribution of the points, or
+///         `Hilbert_sort_middle_policy`, which splits the bounding box in its middle,
+///         following a Hilbert curve of the regular grid.
+///
+/// \sa `hilbert_sort()`
+template <typename P, typename Policy = Hilbert_sort_median_policy>
+void hilbert_sort_elements(Surface_mesh<P>& sm, const Policy policy = Policy())
+{
+  typedef Surface_mesh<P>                                                      Mesh;
+  typedef typename Mesh::Vertex_index                                          Vertex_index;
+  typedef typename Mesh::Face_index                                            Face_index;
+
+  sm.collect_garbage();
+
+  std::vector<Vertex_index> vertex_order(sm.vertices().begin(), sm.vertices().end());
+  Surface_mesh_internal::hilbert_sort_indices(vertex_order, sm.points(), policy);
+
+  std::vector<P> centroids;
+  centroids.reserve(sm.number_of_faces());
+  for(Face_index f : sm.faces())
+    centroids.push_back(Surface_mesh_internal::face_centroid(sm, f));
+
+  std::vector<std::size_t> face_ids(centroids.size());
+  for(std::size_t i=0; i<face_ids.size(); ++i)
+    face_ids[i] = i;
+  Surface_mesh_internal::hilbert_sort_indices(face_ids, make_property_map(centroids), policy);
+
+  std::vector<Face_index> face_order;
+  face_order.reserve(face_ids.size());
+  for(std::size_t i : face_ids)
+    face_order.push_back(Face_index(static_cast<typename Mesh::size_type>(i)));
+
+  sm.permute_elements(vertex_order, face_order);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_HILBERT_SORT_H
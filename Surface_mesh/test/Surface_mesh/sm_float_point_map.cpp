@@ -0,0 +1,133 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh/Float_point_property_map.h>
+
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+typedef K::Vector_3                                         Vector_3;
+typedef CGAL::Surface_mesh<Point_3>                         Mesh;
+typedef Mesh::Vertex_index                                  vertex_descriptor;
+typedef Mesh::Face_index                                    face_descriptor;
+typedef CGAL::Surface_mesh_float_point_map<Point_3>         Float_point_map;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+bool close(const double a, const double b)
+{
+  return std::abs(a - b) <= 1e-5 * (std::max)(1., (std::max)(std::abs(a), std::abs(b)));
+}
+
+void test_properties(Mesh& m)
+{
+  Float_point_map fpm = CGAL::make_float_point_map(m);
+  assert(bool(fpm));
+
+  for(vertex_descriptor v : vertices(m))
+  {
+    const Point_3& p = m.point(v);
+    const Point_3 fp = get(fpm, v);
+    assert(fp.x() == double(float(p.x())) && fp.y() == double(float(p.y())) && fp.z() == double(float(p.z())));
+    assert(fpm.x_data()[v] == float(p.x()));
+  }
+
+  // the properties are found by name, and reused by a second map
+  assert((m.property_map<vertex_descriptor, float>("v:float_x").second));
+  Float_point_map fpm2(m);
+  assert(fpm2.x_data() == fpm.x_data());
+
+  // the float coordinates are a copy
+  const vertex_descriptor v0 = *(vertices(m).begin());
+  const Point_3 p0 = m.point(v0);
+  m.point(v0) = Point_3(10, 20, 30);
+  assert(get(fpm, v0) == Point_3(float(p0.x()), float(p0.y()), float(p0.z())));
+  fpm.update(m);
+  assert(get(fpm, v0) == Point_3(10, 20, 30));
+  put(fpm, v0, p0);
+  m.point(v0) = p0;
+
+  // new vertices and garbage collection
+  const vertex_descriptor nv = m.add_vertex(Point_3(1, 2, 3));
+  put(fpm, nv, Point_3(1, 2, 3));
+  m.remove_vertex(v0);
+  m.collect_garbage();
+  for(vertex_descriptor v : vertices(m))
+  {
+    const Point_3& p = m.point(v);
+    assert(get(fpm, v) == Point_3(float(p.x()), float(p.y()), float(p.z())));
+  }
+
+  fpm.remove(m);
+  assert(!(m.property_map<vertex_descriptor, float>("v:float_x").second));
+}
+
+void test_algorithms(Mesh& m)
+{
+  Float_point_map fpm(m);
+
+  // bounding box
+  const CGAL::Bbox_3 bb = PMP::bbox(m);
+  const CGAL::Bbox_3 fbb = PMP::bbox(m, CGAL::parameters::vertex_point_map(fpm));
+  for(int i=0; i<3; ++i)
+  {
+    assert(close(bb.min(i), fbb.min(i)));
+    assert(close(bb.max(i), fbb.max(i)));
+  }
+
+  // area
+  const double area = PMP::area(m);
+  const double farea = PMP::area(m, CGAL::parameters::vertex_point_map(fpm));
+  assert(close(area, farea));
+
+  // normals
+  for(face_descriptor f : faces(m))
+  {
+    const Vector_3 n = PMP::compute_face_normal(f, m);
+    const Vector_3 fn = PMP::compute_face_normal(f, m, CGAL::parameters::vertex_point_map(fpm));
+    assert(n * fn > 0.999);
+  }
+
+  // AABB tree
+  typedef CGAL::AABB_face_graph_triangle_primitive<Mesh, Float_point_map>   Primitive;
+  typedef CGAL::AABB_traits_3<K, Primitive>                                 Traits;
+  typedef CGAL::AABB_tree<Traits>                                           Tree;
+
+  Tree tree(faces(m).first, faces(m).second, m, fpm);
+  const Point_3 query(2, 2, 2);
+  const Point_3 closest = tree.closest_point(query);
+  assert(close(CGAL::squared_distance(query, closest), tree.squared_distance(query)));
+  assert(tree.size() == faces(m).size());
+
+  // a float point map with a different value type
+  typedef CGAL::Simple_cartesian<float>                                     Kf;
+  CGAL::Surface_mesh_float_point_map<Point_3, Kf::Point_3> fpm_f(m);
+  const double farea_f = PMP::area(m, CGAL::parameters::vertex_point_map(fpm_f));
+  assert(close(area, farea_f));
+}
+
+int main()
+{
+  Mesh m;
+  CGAL::make_icosahedron(m, Point_3(0.1, 0.2, 0.3), 1.5);
+  assert(CGAL::is_valid_polygon_mesh(m));
+
+  test_algorithms(m);
+  test_properties(m);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh/hilbert_sort.h>
+
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point_2;
+typedef K::Point_3                                          Point_3;
+typedef CGAL::Surface_mesh<Point_3>                         Mesh;
+typedef Mesh::Vertex_index                                  vertex_descriptor;
+typedef Mesh::Halfedge_index                                halfedge_descriptor;
+typedef Mesh::Edge_index                                    edge_descriptor;
+typedef Mesh::Face_index                                    face_descriptor;
+
+// the median over the edges of the differences of the indices of their vertices
+template <typename SM>
+std::size_t index_spread(const SM& m)
+{
+  std::vector<std::size_t> gaps;
+  for(typename SM::Edge_index e : edges(m))
+  {
+    const std::size_t i = source(e, m), j = target(e, m);
+    gaps.push_back((i < j) ? j - i : i - j);
+  }
+  std::nth_element(gaps.begin(), gaps.begin() + gaps.size() / 2, gaps.end());
+  return gaps[gaps.size() / 2];
+}
+
+// the properties must follow their elements
+void attach_properties(Mesh& m)
+{
+  Mesh::Property_map<vertex_descriptor, Point_3> vp = m.add_property_map<vertex_descriptor, Point_3>("v:copy").first;
+  Mesh::Property_map<halfedge_descriptor, std::pair<Point_3, Point_3> > hp =
+    m.add_property_map<halfedge_descriptor, std::pair<Point_3, Point_3> >("h:copy").first;
+  Mesh::Property_map<edge_descriptor, Point_3> ep = m.add_property_map<edge_descriptor, Point_3>("e:copy").first;
+  Mesh::Property_map<face_descriptor, Point_3> fp = m.add_property_map<face_descriptor, Point_3>("f:copy").first;
+
+  for(vertex_descriptor v : vertices(m))
+    vp[v] = m.point(v);
+  for(halfedge_descriptor h : halfedges(m))
+    hp[h] = std::make_pair(m.point(source(h, m)), m.point(target(h, m)));
+  for(edge_descriptor e : edges(m))
+    ep[e] = (std::min)(m.point(source(e, m)), m.point(target(e, m)));
+  for(face_descriptor f : faces(m))
+    fp[f] = m.point(target(halfedge(f, m), m));
+}
+
+void check_properties(const Mesh& m)
+{
+  assert(CGAL::is_valid_polygon_mesh(m));
+  assert(!m.has_garbage());
+
+  Mesh::Property_map<vertex_descriptor, Point_3> vp = m.property_map<vertex_descriptor, Point_3>("v:copy").first;
+  Mesh::Property_map<halfedge_descriptor, std::pair<Point_3, Point_3> > hp =
+    m.property_map<halfedge_descriptor, std::pair<Point_3, Point_3> >("h:copy").first;
+  Mesh::Property_map<edge_descriptor, Point_3> ep = m.property_map<edge_descriptor, Point_3>("e:copy").first;
+  Mesh::Property_map<face_descriptor, Point_3> fp = m.property_map<face_descriptor, Point_3>("f:copy").first;
+
+  for(vertex_descriptor v : vertices(m))
+    assert(vp[v] == m.point(v));
+  for(halfedge_descriptor h : halfedges(m))
+    assert(hp[h] == std::make_pair(m.point(source(h, m)), m.point(target(h, m))));
+  for(edge_descriptor e : edges(m))
+    assert(ep[e] == (std::min)(m.point(source(e, m)), m.point(target(e, m))));
+
+  // the halfedge of a face might have changed, but the point must be one of its vertices
+  for(face_descriptor f : faces(m))
+  {
+    bool found = false;
+    for(vertex_descriptor v : vertices_around_face(halfedge(f, m), m))
+      found = found || (m.point(v) == fp[f]);
+    assert(found);
+  }
+}
+
+void test_3(CGAL::Random& rnd)
+{
+  // a piece of torus
+  Mesh m;
+  CGAL::make_grid(60, 40, m, [](int i, int j) {
+                               const double u = 0.1 * i, v = 0.1 * j;
+                               return Point_3((2 + std::cos(v)) * std::cos(u), (2 + std::cos(v)) * std::sin(u), std::sin(v));
+                             }, true /*triangulated*/);
+
+  // an isolated vertex, and some garbage
+  m.add_vertex(Point_3(-1, -1, -1));
+  CGAL::Euler::remove_face(halfedge(*(faces(m).begin()), m), m);
+  assert(m.has_garbage());
+
+  const std::size_t nv = m.number_of_vertices(), ne = m.number_of_edges(), nf = m.number_of_faces();
+
+  attach_properties(m);
+
+  // shuffle the elements
+  m.collect_garbage();
+  std::vector<vertex_descriptor> vertex_order(vertices(m).begin(), vertices(m).end());
+  std::vector<face_descriptor> face_order(faces(m).begin(), faces(m).end());
+  std::mt19937 gen(rnd.get_seed());
+  std::shuffle(vertex_order.begin(), vertex_order.end(), gen);
+  std::shuffle(face_order.begin(), face_order.end(), gen);
+  m.permute_elements(vertex_order, face_order);
+  check_properties(m);
+  assert(face_descriptor(0) == *(faces(m).begin()));
+
+  const std::size_t shuffled_spread = index_spread(m);
+
+  CGAL::hilbert_sort_elements(m);
+  check_properties(m);
+  assert(m.number_of_vertices() == nv && m.number_of_edges() == ne && m.number_of_faces() == nf);
+
+  const std::size_t sorted_spread = index_spread(m);
+  std::cout << "index spread: " << shuffled_spread << " (shuffled) -> " << sorted_spread << " (sorted)" << std::endl;
+  assert(20 * sorted_spread < shuffled_spread);
+
+  // the edges are ordered as met around the faces
+  const halfedge_descriptor h0 = halfedge(face_descriptor(0), m);
+  assert(edge(h0, m) == edge_descriptor(0) || edge(next(h0, m), m) == edge_descriptor(0) ||
+         edge(prev(h0, m), m) == edge_descriptor(0));
+
+  CGAL::hilbert_sort_elements(m, CGAL::Hilbert_sort_middle_policy());
+  check_properties(m);
+}
+
+void test_2()
+{
+  typedef CGAL::Surface_mesh<Point_2>                        Mesh_2;
+
+  Mesh_2 m;
+  CGAL::make_grid(20, 20, m, [](int i, int j) { return Point_2(j, i); });
+  const std::size_t nv = m.number_of_vertices();
+
+  CGAL::hilbert_sort_elements(m);
+  assert(CGAL::is_valid_polygon_mesh(m));
+  assert(m.number_of_vertices() == nv);
+}
+
+int main()
+{
+  CGAL::Random rnd = CGAL::get_default_random();
+  std::cout << "Seed: " << rnd.get_seed() << std::endl;
+
+  test_3(rnd);
+  test_2();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
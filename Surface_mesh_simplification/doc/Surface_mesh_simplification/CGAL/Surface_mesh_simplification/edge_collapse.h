@@ -96,6 +96,20 @@ the number of edges effectively removed.
                      However, the ordering of the priority queue is no longer strict and there is a possibility
                      that some elements that ought to have been collapsed are not actually collapsed.}
    \cgalParamNEnd
+
+  \cgalParamNBegin{concurrency_tag}
+     \cgalParamDescription{a tag indicating if the simplification should be done using one or several threads.}
+     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+     \cgalParamDefault{`CGAL::Sequential_tag`}
+     \cgalParamExtra{In parallel mode, the edges are processed by rounds: each round selects, among the edges of lowest cost,
+                     a set of edges whose vertices have pairwise disjoint one-ring neighborhoods. The validity tests and
+                     the placements of these edges, as well as the costs of the edges modified by the collapses, are then
+                     computed concurrently, while the collapses themselves, the stop predicate, the filter, and the visitor
+                     are called sequentially. The order of the collapses is thus only approximately that of increasing costs.
+                     The cost and placement policies must support concurrent calls, which is the case of all the policies
+                     provided by \cgal when used with a kernel whose number type is not lazily evaluated (such as
+                     `CGAL::Exact_predicates_inexact_constructions_kernel`).}
+   \cgalParamNEnd
 \cgalNamedParamsEnd
 
 \cgalHeading{Semantics}
@@ -0,0 +1,66 @@
+namespace CGAL {
+namespace Surface_mesh_simplification {
+
+/*!
+\ingroup PkgSurfaceMeshSimplificationRef
+
+Simplifies the triangle mesh stored in the file `input_filename`, which can be larger than
+the available memory, and writes the result in the file `output_filename`.
+
+The input is streamed and split in cells, which are boxes of a grid containing at most
+a given number of faces. The faces of each cell are then loaded and simplified using `edge_collapse()`,
+one cell at a time, the vertices on the boundary of the cell being locked.
+Finally, the simplified cells are stitched along their boundaries.
+The peak memory is thus bounded by the size of a cell rather than the size of the input,
+the input and intermediate results being stored in temporary files.
+
+The faces of the input that are not triangles are triangulated. As the boundaries of the cells are not simplified,
+the number of faces of the output might be larger than the requested one. The vertices on the border of the input mesh
+are also kept.
+
+@tparam Policies a class regrouping the cost and placement policies, such as `GarlandHeckbert_plane_policies`.
+                 It must be constructible from a `CGAL::Surface_mesh<GeomTraits::Point_3>&`, and provide the member functions `get_cost()`
+                 and `get_placement()`, returning models of `GetCost` and `GetPlacement`. If `Default`,
+                 the `LindstromTurk_cost` and `LindstromTurk_placement` policies are used.
+@tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+@param input_filename the name of the input file, in the \ref IOStreamOFF (`.off`) or the \ref IOStreamPLY (`.ply`)
+@param output_filename the name of the output file, written in the \ref IOStreamOFF
+@param ratio the ratio between the number of faces of the output and of the input targeted in each cell
+@param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+\cgalNamedParamsBegin
+  \cgalParamNBegin{geom_traits}
+    \cgalParamDescription{an instance of a geometric traits class}
+    \cgalParamType{a class model of `Kernel`. The meshes simplified are of type `CGAL::Surface_mesh<GeomTraits::Point_3>`.}
+    \cgalParamDefault{`CGAL::Exact_predicates_inexact_constructions_kernel`}
+  \cgalParamNEnd
+
+  \cgalParamNBegin{maximum_number_of_faces}
+    \cgalParamDescription{the targeted maximal number of faces in a cell}
+    \cgalParamType{`std::size_t`}
+    \cgalParamDefault{`2^20`}
+    \cgalParamExtra{The cells are obtained by recursively cutting in two halves the boxes of a `64 x 64 x 64` grid,
+                    according to the number of vertices they contain. A cell made of a single box of the grid
+                    might thus contain more faces.}
+  \cgalParamNEnd
+
+  \cgalParamNBegin{stream_precision}
+    \cgalParamDescription{a parameter used to set the precision (i.e. how many digits are generated) of the output stream}
+    \cgalParamType{int}
+    \cgalParamDefault{the precision of the stream `std::ofstream`}
+  \cgalParamNEnd
+\cgalNamedParamsEnd
+
+\returns `true` if the input could be read and the output could be written, `false` otherwise.
+
+\sa `edge_collapse()`
+*/
+template<class Policies = Default, class NamedParameters = parameters::Default_named_parameters>
+bool edge_collapse_out_of_core(const std::string& input_filename,
+                               const std::string& output_filename,
+                               const double ratio,
+                               const NamedParameters& np = parameters::default_values());
+
+} // namespace Surface_mesh_simplification
+} // namespace CGAL
@@ -26,6 +26,7 @@ namespace internal {
 template <typename TriangleMesh, typename GeomTraits>
 class Plane_quadric_calculator
 {
+  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric           Quadric;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
@@ -70,7 +71,7 @@ public:
     return row.transpose() * row;
   }
 
-  Col_4 construct_optimal_point(const Mat_4& quadric,
+  Col_4 construct_optimal_point(const Quadric& quadric,
                                 const Col_4& p0,
                                 const Col_4& p1) const
   {
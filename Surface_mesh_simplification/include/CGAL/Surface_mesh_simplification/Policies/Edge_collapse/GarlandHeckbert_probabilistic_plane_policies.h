@@ -40,6 +40,7 @@ class Probabilistic_plane_quadric_calculator
   typedef Constant_property_map<face_descriptor, std::pair<FT, FT> >           Default_FVM;
   typedef typename Default::Get<FaceVarianceMap, Default_FVM>::type            Face_variance_map;
 
+  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric           Quadric;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
@@ -112,7 +113,7 @@ public:
     return construct_prob_plane_quadric_from_normal(normal, p, gt, n_variance, p_variance);
   }
 
-  Col_4 construct_optimal_point(const Mat_4& quadric,
+  Col_4 construct_optimal_point(const Quadric& quadric,
                                 const Col_4& /*p0*/,
                                 const Col_4& /*p1*/) const
   {
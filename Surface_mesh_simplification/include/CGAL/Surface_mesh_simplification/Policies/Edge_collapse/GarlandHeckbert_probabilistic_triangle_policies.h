@@ -39,6 +39,7 @@ class Probabilistic_triangle_quadric_calculator
   typedef Constant_property_map<face_descriptor, FT>                           Default_FVM;
   typedef typename Default::Get<FaceVarianceMap, Default_FVM>::type            Face_variance_map;
 
+  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric           Quadric;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
@@ -104,7 +105,7 @@ public:
     return construct_prob_triangle_quadric_from_face(f, variance, tmesh, point_map, gt);
   }
 
-  Col_4 construct_optimal_point(const Mat_4& quadric, const Col_4& /*p0*/, const Col_4& /*p1*/) const
+  Col_4 construct_optimal_point(const Quadric& quadric, const Col_4& /*p0*/, const Col_4& /*p1*/) const
   {
     // @fixme check this
     return construct_optimal_point_invertible<GeomTraits>(quadric);
@@ -26,6 +26,7 @@ namespace internal {
 template <typename TriangleMesh, typename GeomTraits>
 class Triangle_quadric_calculator
 {
+  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric           Quadric;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
@@ -51,7 +52,7 @@ public:
     return construct_classic_triangle_quadric_from_face(f, tmesh, point_map, gt);
   }
 
-  Col_4 construct_optimal_point(const Mat_4& quadric,
+  Col_4 construct_optimal_point(const Quadric& quadric,
                                 const Col_4& p0,
                                 const Col_4& p1) const
   {
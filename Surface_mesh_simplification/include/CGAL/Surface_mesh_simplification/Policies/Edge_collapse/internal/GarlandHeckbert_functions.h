@@ -19,67 +19,42 @@
 
 #include <CGAL/Origin.h>
 
+#include <array>
 #include <iostream>
 
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
 
-// taken from https://stackoverflow.com/questions/1148309/inverting-a-4x4-matrix/
-template <typename Matrix>
-bool invert_matrix_4(const Matrix& m, Matrix& im)
+// The optimal point of a quadric Q = | A  b | minimizes p^T * Q * p, that is: A * x = -b.
+//                                    | b^T c |
+// Since A is symmetric, so is its adjugate, and the (3 x 3) system is solved in closed form
+// with Cramer's rule rather than by inverting the full (4 x 4) matrix.
+// Returns `false` if A is singular.
+template <typename FT, typename Vector>
+bool solve_quadric_minimizer(const GarlandHeckbert_symmetric_quadric<FT>& quadric,
+                             Vector& opt_pt)
 {
-  typedef typename Matrix::value_type                                          FT;
-
-  FT det;
-
-  FT A2323 = m(2, 2) * m(3, 3) - m(2, 3) * m(3, 2);
-  FT A1323 = m(2, 1) * m(3, 3) - m(2, 3) * m(3, 1);
-  FT A1223 = m(2, 1) * m(3, 2) - m(2, 2) * m(3, 1);
-  FT A0323 = m(2, 0) * m(3, 3) - m(2, 3) * m(3, 0);
-  FT A0223 = m(2, 0) * m(3, 2) - m(2, 2) * m(3, 0);
-  FT A0123 = m(2, 0) * m(3, 1) - m(2, 1) * m(3, 0);
-  // FT A2313 = m(1, 2) * m(3, 3) - m(1, 3) * m(3, 2);
-  // FT A1313 = m(1, 1) * m(3, 3) - m(1, 3) * m(3, 1);
-  // FT A1213 = m(1, 1) * m(3, 2) - m(1, 2) * m(3, 1);
-  FT A2312 = m(1, 2) * m(2, 3) - m(1, 3) * m(2, 2);
-  FT A1312 = m(1, 1) * m(2, 3) - m(1, 3) * m(2, 1);
-  FT A1212 = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
-  // FT A0313 = m(1, 0) * m(3, 3) - m(1, 3) * m(3, 0);
-  // FT A0213 = m(1, 0) * m(3, 2) - m(1, 2) * m(3, 0);
-  FT A0312 = m(1, 0) * m(2, 3) - m(1, 3) * m(2, 0);
-  FT A0212 = m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0);
-  // FT A0113 = m(1, 0) * m(3, 1) - m(1, 1) * m(3, 0);
-  FT A0112 = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
-
-  det = m(0, 0) * ( m(1, 1) * A2323 - m(1, 2) * A1323 + m(1, 3) * A1223 )
-      - m(0, 1) * ( m(1, 0) * A2323 - m(1, 2) * A0323 + m(1, 3) * A0223 )
-      + m(0, 2) * ( m(1, 0) * A1323 - m(1, 1) * A0323 + m(1, 3) * A0123 )
-      - m(0, 3) * ( m(1, 0) * A1223 - m(1, 1) * A0223 + m(1, 2) * A0123 );
+  const std::array<FT, 10>& q = quadric.q;
 
+  const FT c00 = q[4] * q[7] - q[5] * q[5];
+  const FT c01 = q[2] * q[5] - q[1] * q[7];
+  const FT c02 = q[1] * q[5] - q[2] * q[4];
+
+  FT det = q[0] * c00 + q[1] * c01 + q[2] * c02;
   if(is_zero(det))
     return false;
 
   det = 1 / det;
 
-  // we never actually use values other than those in the third column,
-  // so might as well not calculate them
-  // im(0, 0) = det *   ( m(1, 1) * A2323 - m(1, 2) * A1323 + m(1, 3) * A1223 );
-  // im(0, 1) = det * - ( m(0, 1) * A2323 - m(0, 2) * A1323 + m(0, 3) * A1223 );
-  // im(0, 2) = det *   ( m(0, 1) * A2313 - m(0, 2) * A1313 + m(0, 3) * A1213 );
-  im(0, 3) = det * - ( m(0, 1) * A2312 - m(0, 2) * A1312 + m(0, 3) * A1212 );
-  // im(1, 0) = det * - ( m(1, 0) * A2323 - m(1, 2) * A0323 + m(1, 3) * A0223 );
-  // im(1, 1) = det *   ( m(0, 0) * A2323 - m(0, 2) * A0323 + m(0, 3) * A0223 );
-  // im(1, 2) = det * - ( m(0, 0) * A2313 - m(0, 2) * A0313 + m(0, 3) * A0213 );
-  im(1, 3) = det *   ( m(0, 0) * A2312 - m(0, 2) * A0312 + m(0, 3) * A0212 );
-  // im(2, 0) = det *   ( m(1, 0) * A1323 - m(1, 1) * A0323 + m(1, 3) * A0123 );
-  // im(2, 1) = det * - ( m(0, 0) * A1323 - m(0, 1) * A0323 + m(0, 3) * A0123 );
-  // im(2, 2) = det *   ( m(0, 0) * A1313 - m(0, 1) * A0313 + m(0, 3) * A0113 );
-  im(2, 3) = det * - ( m(0, 0) * A1312 - m(0, 1) * A0312 + m(0, 3) * A0112 );
-  // im(3, 0) = det * - ( m(1, 0) * A1223 - m(1, 1) * A0223 + m(1, 2) * A0123 );
-  // im(3, 1) = det *   ( m(0, 0) * A1223 - m(0, 1) * A0223 + m(0, 2) * A0123 );
-  // im(3, 2) = det * - ( m(0, 0) * A1213 - m(0, 1) * A0213 + m(0, 2) * A0113 );
-  im(3, 3) = det *   ( m(0, 0) * A1212 - m(0, 1) * A0212 + m(0, 2) * A0112 );
+  const FT c11 = q[0] * q[7] - q[2] * q[2];
+  const FT c12 = q[1] * q[2] - q[0] * q[5];
+  const FT c22 = q[0] * q[4] - q[1] * q[1];
+
+  opt_pt(0) = - det * (c00 * q[3] + c01 * q[6] + c02 * q[8]);
+  opt_pt(1) = - det * (c01 * q[3] + c11 * q[6] + c12 * q[8]);
+  opt_pt(2) = - det * (c02 * q[3] + c12 * q[6] + c22 * q[8]);
+  opt_pt(3) = FT(1);
 
   return true;
 }
@@ -199,48 +174,38 @@ skew_sym_mat_cross_product(const typename GeomTraits::Vector_3& v)
 
 template <typename GeomTraits>
 typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4
-construct_optimal_point_invertible(const typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4& quadric)
+construct_optimal_point_invertible(const typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric& quadric)
 {
-  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
-  Mat_4 x;
-  x << quadric.block(0, 0, 3, 4), 0, 0, 0, 1;
-
-  Col_4 opt_pt;
-  opt_pt = x.inverse().col(3); // == X.inverse() * (0 0 0 1)
+  Col_4 opt_pt = Col_4::Zero();
+  const bool invertible = solve_quadric_minimizer(quadric, opt_pt);
+  CGAL_assertion(invertible);
+  CGAL_USE(invertible);
 
   return opt_pt;
 }
 
 template <typename GeomTraits>
 typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4
-construct_optimal_point_singular(const typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4& quadric,
+construct_optimal_point_singular(const typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric& quadric,
                                  const typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4& p0,
                                  const typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4& p1)
 {
   typedef typename GeomTraits::FT                                              FT;
-  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
-  // In this case, the matrix mat may no be invertible, so we save the result to check
-  Mat_4 mat;
-  mat << quadric.block(0, 0, 3, 4), 0, 0, 0, 1;
-
-  Mat_4 inverse;
-  bool invertible = invert_matrix_4(mat, inverse);
-
-  if(invertible)
+  // In this case, the quadric may not be invertible, so we check the result
+  Col_4 opt_pt;
+  if(solve_quadric_minimizer(quadric, opt_pt))
   {
-    return inverse.col(3);
+    return opt_pt;
   }
   else
   {
-    Col_4 opt_pt;
-
     const Col_4 p1mp0 = p1 - p0;
-    const FT a = (p1mp0.transpose() * quadric * p1mp0)(0, 0);
-    const FT b = 2 * (p0.transpose() * quadric * p1mp0)(0, 0);
+    const FT a = quadric.bilinear_form(p1mp0, p1mp0);
+    const FT b = 2 * quadric.bilinear_form(p0, p1mp0);
 
     if(is_zero(a))
     {
@@ -257,8 +222,8 @@ construct_optimal_point_singular(const typename GarlandHeckbert_matrix_types<Geo
       if(ext_t < 0 || ext_t > 1 || a < 0)
       {
         // one of endpoints
-        FT p0_cost = (p0.transpose() * quadric * p0)(0, 0);
-        FT p1_cost = (p1.transpose() * quadric * p1)(0, 0);
+        FT p0_cost = quadric.bilinear_form(p0, p0);
+        FT p1_cost = quadric.bilinear_form(p1, p1);
 
         if(p0_cost > p1_cost)
           opt_pt = p1;
@@ -22,6 +22,7 @@
 
 #include <Eigen/Dense>
 
+#include <array>
 #include <optional>
 
 namespace CGAL {
@@ -34,11 +35,104 @@ Mat combine_matrices(const Mat& a, const Mat& b)
   return a + b;
 }
 
+// Symmetric (4 x 4) quadric, stored as the 10 coefficients of its upper triangle:
+//
+//   | q0 q1 q2 q3 |
+//   |    q4 q5 q6 |
+//   |       q7 q8 |
+//   |          q9 |
+//
+// This is what is stored per vertex: it is smaller than a full Eigen matrix, and the sums
+// computed after each collapse as well as the evaluation of a cost (a dot product between
+// the coefficients and the monomials of the point) are flat loops that compilers vectorize.
+template <typename FT>
+struct GarlandHeckbert_symmetric_quadric
+{
+  std::array<FT, 10> q;
+
+  GarlandHeckbert_symmetric_quadric() { q.fill(FT(0)); }
+
+  // only the upper triangle of `m` is read
+  template <typename Matrix>
+  explicit GarlandHeckbert_symmetric_quadric(const Matrix& m)
+    : q {{ m(0, 0), m(0, 1), m(0, 2), m(0, 3),
+                    m(1, 1), m(1, 2), m(1, 3),
+                             m(2, 2), m(2, 3),
+                                      m(3, 3) }}
+  { }
+
+  template <typename Matrix>
+  Matrix to_matrix() const
+  {
+    Matrix m;
+    m << q[0], q[1], q[2], q[3],
+         q[1], q[4], q[5], q[6],
+         q[2], q[5], q[7], q[8],
+         q[3], q[6], q[8], q[9];
+    return m;
+  }
+
+  bool is_zero() const
+  {
+    for(int i=0; i<10; ++i)
+      if(!CGAL::is_zero(q[i]))
+        return false;
+    return true;
+  }
+
+  GarlandHeckbert_symmetric_quadric& operator+=(const GarlandHeckbert_symmetric_quadric& other)
+  {
+    for(int i=0; i<10; ++i)
+      q[i] += other.q[i];
+    return *this;
+  }
+
+  friend GarlandHeckbert_symmetric_quadric operator+(GarlandHeckbert_symmetric_quadric a,
+                                                     const GarlandHeckbert_symmetric_quadric& b)
+  {
+    return a += b;
+  }
+
+  friend GarlandHeckbert_symmetric_quadric operator*(const FT s,
+                                                     GarlandHeckbert_symmetric_quadric a)
+  {
+    for(int i=0; i<10; ++i)
+      a.q[i] *= s;
+    return a;
+  }
+
+  // p^T * Q * p, with p = (x, y, z, 1)
+  FT evaluate(const FT x, const FT y, const FT z) const
+  {
+    const std::array<FT, 10> monomials {{ x * x, 2 * x * y, 2 * x * z, 2 * x,
+                                                 y * y,     2 * y * z, 2 * y,
+                                                            z * z,     2 * z,
+                                                                       FT(1) }};
+    FT res = 0;
+    for(int i=0; i<10; ++i)
+      res += q[i] * monomials[i];
+
+    return res;
+  }
+
+  // a^T * Q * b, for homogeneous vectors `a` and `b`
+  template <typename Vector>
+  FT bilinear_form(const Vector& a, const Vector& b) const
+  {
+    return a(0) * (q[0] * b(0) + q[1] * b(1) + q[2] * b(2) + q[3] * b(3))
+         + a(1) * (q[1] * b(0) + q[4] * b(1) + q[5] * b(2) + q[6] * b(3))
+         + a(2) * (q[2] * b(0) + q[5] * b(1) + q[7] * b(2) + q[8] * b(3))
+         + a(3) * (q[3] * b(0) + q[6] * b(1) + q[8] * b(2) + q[9] * b(3));
+  }
+};
+
 template <typename GeomTraits>
 struct GarlandHeckbert_matrix_types
 {
   typedef typename GeomTraits::FT                                               FT;
 
+  typedef GarlandHeckbert_symmetric_quadric<FT>                                 Quadric;
+
   typedef Eigen::Matrix<FT, 3, 3, Eigen::DontAlign>                             Mat_3;
   typedef Eigen::Matrix<FT, 3, 1>                                               Col_3;
   typedef Eigen::Matrix<FT, 4, 4, Eigen::DontAlign>                             Mat_4;
@@ -50,10 +144,11 @@ struct GarlandHeckbert_matrix_types
 template <typename QuadricCalculator, typename TriangleMesh, typename GeomTraits>
 struct GarlandHeckbert_quadrics_storage
 {
+  typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Quadric           Quadric;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4             Mat_4;
   typedef typename GarlandHeckbert_matrix_types<GeomTraits>::Col_4             Col_4;
 
-  typedef Mat_4                                                                Cost_matrix;
+  typedef Quadric                                                              Cost_matrix;
   typedef CGAL::dynamic_vertex_property_t<Cost_matrix>                         Cost_property;
   typedef typename boost::property_map<TriangleMesh, Cost_property>::type      Vertex_cost_map;
 
@@ -95,6 +190,7 @@ public:
   typedef typename GeomTraits::Point_3                                         Point_3;
   typedef typename GeomTraits::Vector_3                                        Vector_3;
 
+  typedef typename Base::Quadric                                               Quadric;
   typedef typename Base::Mat_4                                                 Mat_4;
   typedef typename Base::Col_4                                                 Col_4;
 
@@ -117,9 +213,9 @@ public:
     return Col_4 { point.x(), point.y(), point.z(), FT(1) };
   }
 
-  Col_4 construct_optimum(const Mat_4& mat, const Col_4& p0, const Col_4& p1) const
+  Col_4 construct_optimum(const Quadric& quadric, const Col_4& p0, const Col_4& p1) const
   {
-    return quadric_calculator().construct_optimal_point(mat, p0, p1);
+    return quadric_calculator().construct_optimal_point(quadric, p0, p1);
   }
 
   static bool is_discontinuity_edge(const halfedge_descriptor h,
@@ -130,21 +226,21 @@ public:
 
 public:
   template <typename VertexPointMap>
-  Mat_4 construct_quadric(const halfedge_descriptor he,
-                          const TriangleMesh& tmesh,
-                          const VertexPointMap vpm,
-                          const GeomTraits& gt) const
+  Quadric construct_quadric(const halfedge_descriptor he,
+                            const TriangleMesh& tmesh,
+                            const VertexPointMap vpm,
+                            const GeomTraits& gt) const
   {
-    return quadric_calculator().construct_quadric_from_edge(he, tmesh, vpm, gt);
+    return Quadric(quadric_calculator().construct_quadric_from_edge(he, tmesh, vpm, gt));
   }
 
   template <typename VertexPointMap>
-  Mat_4 construct_quadric(const face_descriptor f,
-                          const TriangleMesh& tmesh,
-                          const VertexPointMap vpm,
-                          const GeomTraits& gt) const
+  Quadric construct_quadric(const face_descriptor f,
+                            const TriangleMesh& tmesh,
+                            const VertexPointMap vpm,
+                            const GeomTraits& gt) const
   {
-    return quadric_calculator().construct_quadric_from_face(f, tmesh, vpm, gt);
+    return Quadric(quadric_calculator().construct_quadric_from_face(f, tmesh, vpm, gt));
   }
 
 public:
@@ -154,10 +250,10 @@ public:
                   const VertexPointMap vpm,
                   const GeomTraits& gt) const
   {
-    Mat_4 zero_mat = Mat_4::Zero();
+    const Quadric zero_quadric;
 
     for(vertex_descriptor v : vertices(tmesh))
-      put(vcm(), v, zero_mat);
+      put(vcm(), v, zero_quadric);
 
     for(face_descriptor f : faces(tmesh))
     {
@@ -167,7 +263,7 @@ public:
       const halfedge_descriptor h = halfedge(f, tmesh);
 
       // construtct the (4 x 4) matrix representing the plane quadric
-      const Mat_4 quadric = construct_quadric(f, tmesh, vpm, gt);
+      const Quadric quadric = construct_quadric(f, tmesh, vpm, gt);
 
       for(halfedge_descriptor shd : halfedges_around_face(h, tmesh))
       {
@@ -179,7 +275,7 @@ public:
         if(!is_discontinuity_edge(shd, tmesh))
           continue;
 
-        const Mat_4 discontinuous_quadric =
+        const Quadric discontinuous_quadric =
           discontinuity_multiplier * construct_quadric(shd, tmesh, vpm, gt);
 
         put(vcm(), vs, combine_matrices(get(vcm(), vs), discontinuous_quadric));
@@ -208,13 +304,12 @@ public:
     if(!placement)
       return std::optional<typename Profile::FT>();
 
-    CGAL_precondition(!get(vcm(), profile.v0()).isZero(0));
-    CGAL_precondition(!get(vcm(), profile.v1()).isZero(0));
+    CGAL_precondition(!get(vcm(), profile.v0()).is_zero());
+    CGAL_precondition(!get(vcm(), profile.v1()).is_zero());
 
-    const Mat_4 combined_matrix = combine_matrices(get(vcm(), profile.v0()),
-                                                   get(vcm(), profile.v1()));
-    const Col_4 pt = point_to_homogenous_column(*placement);
-    const Optional_FT cost = (pt.transpose() * combined_matrix * pt)(0, 0);
+    const Quadric combined_quadric = combine_matrices(get(vcm(), profile.v0()),
+                                                      get(vcm(), profile.v1()));
+    const Optional_FT cost = combined_quadric.evaluate(placement->x(), placement->y(), placement->z());
 
     return cost;
   }
@@ -224,17 +319,17 @@ public:
   template <typename Profile>
   std::optional<typename Profile::Point> operator()(const Profile& profile) const
   {
-    CGAL_precondition(!get(vcm(), profile.v0()).isZero(0));
-    CGAL_precondition(!get(vcm(), profile.v1()).isZero(0));
+    CGAL_precondition(!get(vcm(), profile.v0()).is_zero());
+    CGAL_precondition(!get(vcm(), profile.v1()).is_zero());
 
-    // the combined matrix has already been computed in the evaluation of the cost...
-    const Mat_4 combined_matrix = combine_matrices(get(vcm(), profile.v0()),
-                                                   get(vcm(), profile.v1()));
+    // the combined quadric has already been computed in the evaluation of the cost...
+    const Quadric combined_quadric = combine_matrices(get(vcm(), profile.v0()),
+                                                      get(vcm(), profile.v1()));
 
     const Col_4 p0 = point_to_homogenous_column(profile.p0());
     const Col_4 p1 = point_to_homogenous_column(profile.p1());
 
-    const Col_4 opt = construct_optimum(combined_matrix, p0, p1);
+    const Col_4 opt = construct_optimum(combined_quadric, p0, p1);
 
     std::optional<typename Profile::Point> pt = typename Profile::Point(opt(0) / opt(3),
                                                                           opt(1) / opt(3),
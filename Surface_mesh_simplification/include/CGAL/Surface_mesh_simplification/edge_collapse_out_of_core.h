@@ -0,0 +1,903 @@
+// Copyright (c) 2024 GeometryFactory (France). All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+//
+#ifndef CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_OUT_OF_CORE_H
+#define CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_OUT_OF_CORE_H
+
+#include <CGAL/license/Surface_mesh_simplification.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Edge_collapse_visitor_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Constrained_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_placement.h>
+
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/OFF.h>
+#include <CGAL/IO/PLY.h>
+#include <CGAL/IO/helpers.h>
+#include <CGAL/Default.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Surface_mesh_simplification {
+namespace internal {
+
+// An anonymous binary file, removed when closed.
+class Temporary_file
+{
+  std::FILE* m_file;
+
+public:
+  Temporary_file() : m_file(std::tmpfile()) { }
+  ~Temporary_file() { if(m_file != nullptr) std::fclose(m_file); }
+
+  Temporary_file(const Temporary_file&) = delete;
+  Temporary_file& operator=(const Temporary_file&) = delete;
+
+  bool is_valid() const { return m_file != nullptr; }
+
+  template <typename T>
+  bool write(const T* data, const std::size_t n)
+  {
+    return std::fwrite(data, sizeof(T), n, m_file) == n;
+  }
+
+  template <typename T>
+  std::size_t read(T* data, const std::size_t n)
+  {
+    return std::fread(data, sizeof(T), n, m_file);
+  }
+
+  bool seek(const std::uint64_t offset)
+  {
+#ifdef _MSC_VER
+    return _fseeki64(m_file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(m_file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+  }
+
+  void rewind() { std::rewind(m_file); }
+};
+
+typedef std::array<double, 3>                                            Coordinates;
+
+struct Triangle_record
+{
+  std::uint64_t region;
+  std::uint64_t ids[3];
+  Coordinates points[3];
+};
+
+struct Vertex_record
+{
+  std::uint64_t global_id; // `unlocked_vertex` if the vertex does not lie on the boundary of its cell
+  Coordinates point;
+};
+
+static constexpr std::uint64_t unlocked_vertex = (std::numeric_limits<std::uint64_t>::max)();
+
+// The input is spread in a grid of `grid_size^3` cells, which are then grouped in boxes.
+static constexpr int grid_size = 64;
+
+// The number of triangles handled at once when the input is streamed.
+static constexpr std::size_t chunk_size = std::size_t(1) << 18;
+
+// The maximal number of cells whose triangles are distributed during a pass over the input.
+static constexpr std::size_t max_open_cells = 64;
+
+// Fetches the coordinates of the vertices of indices `ids`, sorted and without duplicates,
+// from the file `vertices`. Close indices are read in a single request.
+inline bool read_points(Temporary_file& vertices,
+                        const std::vector<std::uint64_t>& ids,
+                        std::vector<Coordinates>& points)
+{
+  points.resize(ids.size());
+  std::vector<Coordinates> buffer;
+  for(std::size_t i=0; i<ids.size(); )
+  {
+    std::size_t j = i + 1;
+    while(j < ids.size() && ids[j] - ids[j-1] <= 64 && ids[j] - ids[i] < 4096)
+      ++j;
+
+    buffer.resize(std::size_t(ids[j-1] - ids[i] + 1));
+    if(!vertices.seek(ids[i] * sizeof(Coordinates)) ||
+       vertices.read(buffer.data(), buffer.size()) != buffer.size())
+      return false;
+
+    for(std::size_t k=i; k<j; ++k)
+      points[k] = buffer[std::size_t(ids[k] - ids[i])];
+    i = j;
+  }
+  return true;
+}
+
+// Writes the points of the input in `vertices`, and its faces (triangulated as fans) in `triangles`.
+class Out_of_core_input
+{
+  Temporary_file& m_vertices;
+  Temporary_file& m_triangles;
+  std::uint64_t m_number_of_vertices = 0;
+  std::uint64_t m_number_of_triangles = 0;
+  Bbox_3 m_bbox;
+
+public:
+  Out_of_core_input(Temporary_file& vertices, Temporary_file& triangles)
+    : m_vertices(vertices), m_triangles(triangles)
+  { }
+
+  std::uint64_t number_of_vertices() const { return m_number_of_vertices; }
+  std::uint64_t number_of_triangles() const { return m_number_of_triangles; }
+  const Bbox_3& bbox() const { return m_bbox; }
+
+  bool add_vertex(const double x, const double y, const double z)
+  {
+    const Coordinates c = {{ x, y, z }};
+    m_bbox += Bbox_3(x, y, z, x, y, z);
+    ++m_number_of_vertices;
+    return m_vertices.write(&c, 1);
+  }
+
+  template <typename IndexRange>
+  bool add_face(const IndexRange& face)
+  {
+    const std::size_t n = face.size();
+    for(std::size_t i=1; i+1<n; ++i)
+    {
+      const std::array<std::uint64_t, 3> t = {{ std::uint64_t(face[0]), std::uint64_t(face[i]), std::uint64_t(face[i+1]) }};
+      if(!m_triangles.write(&t, 1))
+        return false;
+      ++m_number_of_triangles;
+    }
+    return true;
+  }
+
+  bool read_OFF(std::istream& is)
+  {
+    File_scanner_OFF scanner(is);
+    if(is.fail())
+      return false;
+
+    for(std::size_t i=0; i<scanner.size_of_vertices(); ++i)
+    {
+      double x(0), y(0), z(0), w(0);
+      scanner.scan_vertex(x, y, z, w);
+      if(w == 0 || !add_vertex(x/w, y/w, z/w))
+        return false;
+
+      if(scanner.has_normals())
+      {
+        double nx, ny, nz;
+        scanner.scan_normal(nx, ny, nz);
+      }
+      if(scanner.has_vcolors())
+      {
+        unsigned char r=0, g=0, b=0;
+        scanner.scan_color(r, g, b);
+      }
+      if(scanner.has_textures())
+      {
+        double u, v;
+        scanner.scan_texture(u, v);
+      }
+      if(!is.good())
+        return false;
+    }
+
+    std::vector<std::size_t> face;
+    for(std::size_t i=0; i<scanner.size_of_facets(); ++i)
+    {
+      std::size_t no(-1);
+      scanner.scan_facet(no, i);
+      if((!is.eof() && !is.good()) || no == std::size_t(-1))
+        return false;
+
+      face.resize(no);
+      for(std::size_t j=0; j<no; ++j)
+      {
+        scanner.scan_facet_vertex_index(face[j], j+1, i);
+        if(!is || face[j] >= scanner.size_of_vertices())
+          return false;
+      }
+      if(scanner.has_fcolors())
+      {
+        unsigned char r=0, g=0, b=0;
+        scanner.scan_color(r, g, b);
+      }
+      if(!add_face(face))
+        return false;
+    }
+
+    return !is.fail();
+  }
+
+  template <typename Integer>
+  bool read_PLY_faces(std::istream& is, IO::internal::PLY_element& element, const char* tag)
+  {
+    std::vector<Integer> face;
+    for(std::size_t j=0; j<element.number_of_items(); ++j)
+    {
+      for(std::size_t k=0; k<element.number_of_properties(); ++k)
+      {
+        element.property(k)->get(is);
+        if(is.fail())
+          return false;
+      }
+
+      element.assign(face, tag);
+      for(const Integer id : face)
+        if(static_cast<std::int64_t>(id) < 0 || std::uint64_t(id) >= m_number_of_vertices)
+          return false;
+      if(!add_face(face))
+        return false;
+    }
+    return true;
+  }
+
+  bool read_PLY(std::istream& is)
+  {
+    typedef Exact_predicates_inexact_constructions_kernel::Point_3      Point_3;
+
+    IO::internal::PLY_reader reader(false);
+    if(!reader.init(is))
+      return false;
+
+    for(std::size_t i=0; i<reader.number_of_elements(); ++i)
+    {
+      IO::internal::PLY_element& element = reader.element(i);
+
+      if(element.name() == "vertex" || element.name() == "vertices")
+      {
+        for(std::size_t j=0; j<element.number_of_items(); ++j)
+        {
+          for(std::size_t k=0; k<element.number_of_properties(); ++k)
+          {
+            element.property(k)->get(is);
+            if(is.fail())
+              return false;
+          }
+
+          std::tuple<Point_3> new_vertex;
+          IO::internal::process_properties(element, new_vertex,
+                                           IO::make_ply_point_reader(CGAL::make_nth_of_tuple_property_map<0>(new_vertex)));
+          const Point_3& p = std::get<0>(new_vertex);
+          if(!add_vertex(p.x(), p.y(), p.z()))
+            return false;
+        }
+      }
+      else if(element.name() == "face" || element.name() == "faces")
+      {
+        bool ok = false;
+        if(element.has_property<std::vector<std::int32_t> >("vertex_indices"))
+          ok = read_PLY_faces<std::int32_t>(is, element, "vertex_indices");
+        else if(element.has_property<std::vector<std::uint32_t> >("vertex_indices"))
+          ok = read_PLY_faces<std::uint32_t>(is, element, "vertex_indices");
+        else if(element.has_property<std::vector<std::int32_t> >("vertex_index"))
+          ok = read_PLY_faces<std::int32_t>(is, element, "vertex_index");
+        else if(element.has_property<std::vector<std::uint32_t> >("vertex_index"))
+          ok = read_PLY_faces<std::uint32_t>(is, element, "vertex_index");
+        if(!ok)
+          return false;
+      }
+      else // other elements are ignored
+      {
+        for(std::size_t j=0; j<element.number_of_items(); ++j)
+        {
+          for(std::size_t k=0; k<element.number_of_properties(); ++k)
+          {
+            element.property(k)->get(is);
+            if(is.fail())
+              return false;
+          }
+        }
+      }
+    }
+    return !is.fail();
+  }
+};
+
+// A box of cells of the grid, [lo, hi[.
+struct Grid_box
+{
+  std::array<int, 3> lo, hi;
+};
+
+// Groups the cells of the grid in boxes containing at most `max_size` points (unless a box
+// is reduced to a single cell), by recursively cutting the boxes in two halves of similar sizes.
+// Returns the number of boxes, and fills `box_of_cell`.
+inline std::size_t partition_grid(const std::vector<std::uint64_t>& histogram,
+                                  const std::uint64_t max_size,
+                                  std::vector<std::uint32_t>& box_of_cell)
+{
+  auto cell_index = [](const int i, const int j, const int k) -> std::size_t
+  {
+    return (std::size_t(i) * grid_size + std::size_t(j)) * grid_size + std::size_t(k);
+  };
+
+  box_of_cell.assign(histogram.size(), 0);
+  std::uint32_t nb_boxes = 0;
+
+  std::vector<Grid_box> queue(1, Grid_box{ {{ 0, 0, 0 }}, {{ grid_size, grid_size, grid_size }} });
+  std::vector<std::uint64_t> slabs;
+  while(!queue.empty())
+  {
+    const Grid_box box = queue.back();
+    queue.pop_back();
+
+    // the longest axis of the box
+    int axis = 0;
+    for(int a=1; a<3; ++a)
+      if(box.hi[a] - box.lo[a] > box.hi[axis] - box.lo[axis])
+        axis = a;
+
+    // the number of points in each slab of the box orthogonal to `axis`
+    slabs.assign(std::size_t(box.hi[axis] - box.lo[axis]), 0);
+    std::uint64_t size = 0;
+    for(int i=box.lo[0]; i<box.hi[0]; ++i)
+      for(int j=box.lo[1]; j<box.hi[1]; ++j)
+        for(int k=box.lo[2]; k<box.hi[2]; ++k)
+        {
+          const std::uint64_t n = histogram[cell_index(i, j, k)];
+          const int ijk[3] = { i, j, k };
+          slabs[std::size_t(ijk[axis] - box.lo[axis])] += n;
+          size += n;
+        }
+
+    if(size == 0)
+      continue;
+
+    if(size <= max_size || slabs.size() == 1)
+    {
+      for(int i=box.lo[0]; i<box.hi[0]; ++i)
+        for(int j=box.lo[1]; j<box.hi[1]; ++j)
+          for(int k=box.lo[2]; k<box.hi[2]; ++k)
+            box_of_cell[cell_index(i, j, k)] = nb_boxes;
+      ++nb_boxes;
+      continue;
+    }
+
+    // cut where the points are split evenly
+    std::size_t cut = 1;
+    std::uint64_t acc = slabs[0];
+    while(cut + 1 < slabs.size() && 2 * (acc + slabs[cut]) <= size)
+      acc += slabs[cut++];
+
+    Grid_box low = box, high = box;
+    low.hi[axis] = high.lo[axis] = box.lo[axis] + int(cut);
+    queue.push_back(low);
+    queue.push_back(high);
+  }
+
+  return nb_boxes;
+}
+
+class Grid_locator
+{
+  Bbox_3 m_bbox;
+
+  static int coordinate(const double c, const double cmin, const double cmax)
+  {
+    if(cmax <= cmin)
+      return 0;
+    const double t = (c - cmin) / (cmax - cmin) * grid_size;
+    if(!(t > 0.))
+      return 0;
+    return (std::min)(int(t), grid_size - 1);
+  }
+
+public:
+  Grid_locator(const Bbox_3& bbox) : m_bbox(bbox) { }
+
+  std::size_t operator()(const double x, const double y, const double z) const
+  {
+    return (std::size_t(coordinate(x, m_bbox.xmin(), m_bbox.xmax())) * grid_size +
+            std::size_t(coordinate(y, m_bbox.ymin(), m_bbox.ymax()))) * grid_size +
+            std::size_t(coordinate(z, m_bbox.zmin(), m_bbox.zmax()));
+  }
+};
+
+// Records the points duplicated by `orient_polygon_soup()`: they keep the global index of the original point,
+// and both must be kept to be able to stitch the cells back.
+struct Cell_orientation_visitor
+  : public Polygon_mesh_processing::Default_orientation_visitor
+{
+  std::vector<std::uint64_t>* global_ids;
+  std::vector<std::size_t>* duplicated;
+
+  void duplicated_vertex(std::size_t v1, std::size_t v2)
+  {
+    if(global_ids->size() <= v2)
+      global_ids->resize(v2 + 1);
+    (*global_ids)[v2] = (*global_ids)[v1];
+    duplicated->push_back(v1);
+    duplicated->push_back(v2);
+  }
+};
+
+// The vertex kept by a collapse is not necessarily the one that is locked:
+// its global index is transferred to the vertex kept.
+template <typename TriangleMesh, typename GlobalIdMap>
+struct Cell_collapse_visitor
+  : public Edge_collapse_visitor_base<TriangleMesh>
+{
+  typedef Edge_collapse_visitor_base<TriangleMesh>                      Base;
+  typedef typename Base::Profile                                        Profile;
+  typedef typename Base::Point                                          Point;
+  typedef typename Base::vertex_descriptor                              vertex_descriptor;
+
+  Cell_collapse_visitor(const GlobalIdMap& global_id) : m_global_id(global_id) { }
+
+  void OnCollapsing(const Profile& profile, const std::optional<Point>&)
+  {
+    m_collapsed_id = get(m_global_id, profile.v0());
+    if(m_collapsed_id == unlocked_vertex)
+      m_collapsed_id = get(m_global_id, profile.v1());
+  }
+
+  void OnCollapsed(const Profile&, const vertex_descriptor v)
+  {
+    put(m_global_id, v, m_collapsed_id);
+  }
+
+private:
+  GlobalIdMap m_global_id;
+  std::uint64_t m_collapsed_id = unlocked_vertex;
+};
+
+// Rejects the collapses that would create an edge between two locked vertices: such an edge
+// might also be created in the neighboring cell, resulting in a non-manifold edge.
+template <typename GlobalIdMap>
+struct Cell_boundary_filter
+{
+  Cell_boundary_filter(const GlobalIdMap& global_id) : m_global_id(global_id) { }
+
+  template <typename Profile>
+  std::optional<typename Profile::Point>
+  operator()(const Profile& profile, const std::optional<typename Profile::Point>& op) const
+  {
+    typedef typename Profile::TM                                        TM;
+    typedef typename boost::graph_traits<TM>::vertex_descriptor         vertex_descriptor;
+
+    const TM& tm = profile.surface_mesh();
+    const bool is_v0_locked = (get(m_global_id, profile.v0()) != unlocked_vertex);
+    const bool is_v1_locked = (get(m_global_id, profile.v1()) != unlocked_vertex);
+    if(is_v0_locked == is_v1_locked)
+      return op;
+
+    const vertex_descriptor locked = is_v0_locked ? profile.v0() : profile.v1();
+    const vertex_descriptor removed = is_v0_locked ? profile.v1() : profile.v0();
+    for(vertex_descriptor v : vertices_around_target(removed, tm))
+    {
+      if(v == locked || get(m_global_id, v) == unlocked_vertex)
+        continue;
+      bool is_adjacent = false;
+      for(vertex_descriptor w : vertices_around_target(locked, tm))
+      {
+        if(w == v)
+        {
+          is_adjacent = true;
+          break;
+        }
+      }
+      if(!is_adjacent)
+        return std::nullopt;
+    }
+    return op;
+  }
+
+private:
+  GlobalIdMap m_global_id;
+};
+
+// Same as `Face_count_ratio_stop_predicate`, using the constant time face count of `Surface_mesh`.
+struct Cell_face_count_ratio_stop_predicate
+{
+  Cell_face_count_ratio_stop_predicate(const double ratio, const std::size_t initial_face_count)
+    : m_ratio(ratio), m_initial_face_count(initial_face_count)
+  { }
+
+  template <typename F, typename Profile, typename size_type>
+  bool operator()(const F& /*current_cost*/,
+                  const Profile& profile,
+                  size_type /*initial_edge_count*/,
+                  size_type /*current_edge_count*/) const
+  {
+    const std::size_t current_face_count = profile.surface_mesh().number_of_faces();
+    return static_cast<double>(current_face_count) < m_ratio * static_cast<double>(m_initial_face_count);
+  }
+
+private:
+  const double m_ratio;
+  const std::size_t m_initial_face_count;
+};
+
+template <typename TriangleMesh>
+struct Out_of_core_default_policies
+{
+  typedef LindstromTurk_cost<TriangleMesh>                              Get_cost;
+  typedef LindstromTurk_placement<TriangleMesh>                         Get_placement;
+
+  Out_of_core_default_policies(TriangleMesh&) { }
+
+  const Get_cost& get_cost() const { return m_get_cost; }
+  const Get_placement& get_placement() const { return m_get_placement; }
+
+private:
+  Get_cost m_get_cost;
+  Get_placement m_get_placement;
+};
+
+// Simplifies the triangles of a cell, keeping the vertices on the boundary of the cell,
+// and appends the result to `results`.
+template <typename Policies, typename GeomTraits>
+bool simplify_cell(const std::vector<Triangle_record>& triangles,
+                   const double ratio,
+                   const GeomTraits& gt,
+                   Temporary_file& results)
+{
+  typedef typename GeomTraits::Point_3                                     Point_3;
+  typedef CGAL::Surface_mesh<Point_3>                                      Mesh;
+  typedef typename Mesh::Vertex_index                                      vertex_descriptor;
+  typedef typename Mesh::Halfedge_index                                    halfedge_descriptor;
+  typedef typename Mesh::Edge_index                                        edge_descriptor;
+
+  // (A) gather the triangles of the cell in a polygon soup
+  std::unordered_map<std::uint64_t, std::size_t> local_ids;
+  std::vector<Point_3> points;
+  std::vector<std::uint64_t> global_ids;
+  std::vector<std::array<std::size_t, 3> > polygons;
+  polygons.reserve(triangles.size());
+  for(const Triangle_record& t : triangles)
+  {
+    if(t.ids[0] == t.ids[1] || t.ids[1] == t.ids[2] || t.ids[2] == t.ids[0])
+      continue;
+
+    std::array<std::size_t, 3> polygon;
+    for(int i=0; i<3; ++i)
+    {
+      auto res = local_ids.emplace(t.ids[i], points.size());
+      if(res.second)
+      {
+        points.emplace_back(t.points[i][0], t.points[i][1], t.points[i][2]);
+        global_ids.push_back(t.ids[i]);
+      }
+      polygon[i] = res.first->second;
+    }
+    polygons.push_back(polygon);
+  }
+
+  std::vector<std::size_t> duplicated;
+  Cell_orientation_visitor visitor;
+  visitor.global_ids = &global_ids;
+  visitor.duplicated = &duplicated;
+  Polygon_mesh_processing::orient_polygon_soup(points, polygons, parameters::visitor(visitor));
+
+  Mesh mesh;
+  std::vector<std::pair<std::size_t, vertex_descriptor> > point_to_vertex;
+  Polygon_mesh_processing::polygon_soup_to_polygon_mesh(points, polygons, mesh,
+                                                        parameters::point_to_vertex_output_iterator(std::back_inserter(point_to_vertex)));
+
+  // (B) lock the boundary of the cell: the edges on the border of the mesh are constrained,
+  // and so are the edges incident to the points that have been duplicated.
+  // Only the locked vertices keep their global index.
+  auto ecm = mesh.template add_property_map<edge_descriptor, bool>("e:sms_locked", false).first;
+  auto global_id = mesh.template add_property_map<vertex_descriptor, std::uint64_t>("v:sms_global_id", unlocked_vertex).first;
+
+  std::vector<vertex_descriptor> point_vertices(points.size());
+  for(const auto& pv : point_to_vertex)
+    point_vertices[pv.first] = pv.second;
+
+  for(halfedge_descriptor h : halfedges(mesh))
+  {
+    if(is_border(h, mesh))
+    {
+      put(ecm, edge(h, mesh), true);
+      put(global_id, target(h, mesh), std::uint64_t(0)); // marked, set below
+    }
+  }
+  for(std::size_t p : duplicated)
+  {
+    for(halfedge_descriptor h : halfedges_around_target(point_vertices[p], mesh))
+      put(ecm, edge(h, mesh), true);
+    put(global_id, point_vertices[p], std::uint64_t(0));
+  }
+  for(const auto& pv : point_to_vertex)
+    if(get(global_id, pv.second) != unlocked_vertex)
+      put(global_id, pv.second, global_ids[pv.first]);
+
+  // (C) simplify
+  Policies policies(mesh);
+  typedef Constrained_placement<typename Policies::Get_placement, decltype(ecm)>  Placement;
+  Cell_face_count_ratio_stop_predicate stop(ratio, mesh.number_of_faces());
+  edge_collapse(mesh, stop,
+                parameters::edge_is_constrained_map(ecm)
+                           .get_cost(policies.get_cost())
+                           .get_placement(Placement(ecm, policies.get_placement()))
+                           .filter(Cell_boundary_filter<decltype(global_id)>(global_id))
+                           .visitor(Cell_collapse_visitor<Mesh, decltype(global_id)>(global_id))
+                           .geom_traits(gt));
+
+  // (D) write the result
+  std::vector<Vertex_record> vertex_records;
+  std::unordered_map<vertex_descriptor, std::uint64_t> output_ids;
+  for(vertex_descriptor v : vertices(mesh))
+  {
+    const Point_3& p = mesh.point(v);
+    output_ids.emplace(v, vertex_records.size());
+    vertex_records.push_back(Vertex_record{ get(global_id, v),
+                                            {{ to_double(p.x()), to_double(p.y()), to_double(p.z()) }} });
+  }
+
+  std::vector<std::array<std::uint64_t, 3> > face_records;
+  face_records.reserve(faces(mesh).size());
+  for(typename Mesh::Face_index f : faces(mesh))
+  {
+    std::array<std::uint64_t, 3> face;
+    int i = 0;
+    for(vertex_descriptor v : vertices_around_face(halfedge(f, mesh), mesh))
+      face[i++] = output_ids[v];
+    face_records.push_back(face);
+  }
+
+  const std::uint64_t sizes[2] = { vertex_records.size(), face_records.size() };
+  return results.write(sizes, 2) &&
+         results.write(vertex_records.data(), vertex_records.size()) &&
+         results.write(face_records.data(), face_records.size());
+}
+
+// Reads the next cell written by `simplify_cell()`.
+inline bool read_cell(Temporary_file& results,
+                      std::vector<Vertex_record>& vertex_records,
+                      std::vector<std::array<std::uint64_t, 3> >& face_records)
+{
+  std::uint64_t sizes[2];
+  if(results.read(sizes, 2) != 2)
+    return false;
+  vertex_records.resize(std::size_t(sizes[0]));
+  face_records.resize(std::size_t(sizes[1]));
+  return results.read(vertex_records.data(), vertex_records.size()) == vertex_records.size() &&
+         results.read(face_records.data(), face_records.size()) == face_records.size();
+}
+
+} // namespace internal
+
+template <typename Policies = Default, typename NamedParameters = parameters::Default_named_parameters>
+bool edge_collapse_out_of_core(const std::string& input_filename,
+                               const std::string& output_filename,
+                               const double ratio,
+                               const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::geom_traits_t,
+                                                       NamedParameters,
+                                                       Exact_predicates_inexact_constructions_kernel>::type Geom_traits;
+  typedef CGAL::Surface_mesh<typename Geom_traits::Point_3>                           Mesh;
+  typedef typename Default::Get<Policies, internal::Out_of_core_default_policies<Mesh> >::type Policies_;
+
+  using internal::Temporary_file;
+  using internal::Triangle_record;
+  using internal::Vertex_record;
+  using internal::Coordinates;
+
+  const Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(np, internal_np::geom_traits));
+  const std::uint64_t max_faces = choose_parameter(get_parameter(np, internal_np::maximum_number_of_faces), std::size_t(1) << 20);
+
+  Temporary_file vertices, triangles, located_triangles, results;
+  if(!vertices.is_valid() || !triangles.is_valid() || !located_triangles.is_valid() || !results.is_valid())
+    return false;
+
+  // (A) stream the input
+  internal::Out_of_core_input input(vertices, triangles);
+  {
+    const std::string ext = IO::internal::get_file_extension(input_filename);
+    if(ext == "off")
+    {
+      std::ifstream is(input_filename);
+      if(!input.read_OFF(is))
+        return false;
+    }
+    else if(ext == "ply")
+    {
+      std::ifstream is(input_filename, std::ios::binary);
+      if(!input.read_PLY(is))
+        return false;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  // (B) distribute the points in a grid, and group its cells in boxes of bounded size,
+  // assuming that there are about twice as many faces as vertices
+  const internal::Grid_locator locate(input.bbox());
+  std::vector<std::uint64_t> histogram(std::size_t(internal::grid_size) * internal::grid_size * internal::grid_size, 0);
+  {
+    std::vector<Coordinates> buffer(internal::chunk_size);
+    vertices.rewind();
+    std::size_t n;
+    while((n = vertices.read(buffer.data(), buffer.size())) > 0)
+      for(std::size_t i=0; i<n; ++i)
+        ++histogram[locate(buffer[i][0], buffer[i][1], buffer[i][2])];
+  }
+
+  std::vector<std::uint32_t> box_of_cell;
+  const std::size_t nb_boxes = internal::partition_grid(histogram, (std::max)(std::uint64_t(1), max_faces / 2), box_of_cell);
+
+  // (C) assign each triangle to the box containing its centroid, and store its coordinates
+  std::vector<std::uint64_t> box_sizes(nb_boxes, 0);
+  {
+    std::vector<std::array<std::uint64_t, 3> > chunk(internal::chunk_size);
+    std::vector<std::uint64_t> ids;
+    std::vector<Coordinates> points;
+    std::vector<Triangle_record> records;
+    triangles.rewind();
+    std::size_t n;
+    while((n = triangles.read(chunk.data(), chunk.size())) > 0)
+    {
+      ids.clear();
+      for(std::size_t i=0; i<n; ++i)
+        ids.insert(ids.end(), chunk[i].begin(), chunk[i].end());
+      std::sort(ids.begin(), ids.end());
+      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+      if(!internal::read_points(vertices, ids, points))
+        return false;
+
+      records.resize(n);
+      for(std::size_t i=0; i<n; ++i)
+      {
+        Triangle_record& r = records[i];
+        double centroid[3] = { 0., 0., 0. };
+        for(int k=0; k<3; ++k)
+        {
+          r.ids[k] = chunk[i][k];
+          r.points[k] = points[std::size_t(std::lower_bound(ids.begin(), ids.end(), chunk[i][k]) - ids.begin())];
+          for(int c=0; c<3; ++c)
+            centroid[c] += r.points[k][c] / 3.;
+        }
+        r.region = box_of_cell[locate(centroid[0], centroid[1], centroid[2])];
+        ++box_sizes[std::size_t(r.region)];
+      }
+      if(!located_triangles.write(records.data(), n))
+        return false;
+    }
+  }
+
+  // (D) simplify the boxes, a group at a time to bound the number of open files
+  for(std::size_t first_box=0; first_box<nb_boxes; first_box+=internal::max_open_cells)
+  {
+    const std::size_t last_box = (std::min)(nb_boxes, first_box + internal::max_open_cells);
+
+    std::vector<Temporary_file> box_files(last_box - first_box);
+    std::vector<std::vector<Triangle_record> > buffers(last_box - first_box);
+    std::vector<Triangle_record> chunk(internal::chunk_size);
+    located_triangles.rewind();
+    std::size_t n;
+    while((n = located_triangles.read(chunk.data(), chunk.size())) > 0)
+    {
+      for(std::size_t i=0; i<n; ++i)
+        if(chunk[i].region >= first_box && chunk[i].region < last_box)
+          buffers[std::size_t(chunk[i].region) - first_box].push_back(chunk[i]);
+
+      for(std::size_t b=0; b<buffers.size(); ++b)
+      {
+        if(!box_files[b].is_valid() || !box_files[b].write(buffers[b].data(), buffers[b].size()))
+          return false;
+        buffers[b].clear();
+      }
+    }
+
+    std::vector<Triangle_record> box_triangles;
+    for(std::size_t b=0; b<box_files.size(); ++b)
+    {
+      box_triangles.resize(std::size_t(box_sizes[first_box + b]));
+      box_files[b].rewind();
+      if(box_files[b].read(box_triangles.data(), box_triangles.size()) != box_triangles.size())
+        return false;
+      if(!internal::simplify_cell<Policies_>(box_triangles, ratio, gt, results))
+        return false;
+    }
+  }
+
+  // (E) stitch the simplified boxes: the vertices that have been kept on the boundaries of the boxes
+  // are merged using their index in the input
+  std::unordered_map<std::uint64_t, std::uint64_t> locked_vertices;
+  std::vector<Vertex_record> vertex_records;
+  std::vector<std::array<std::uint64_t, 3> > face_records;
+  std::uint64_t nb_vertices = 0, nb_faces = 0;
+
+  results.rewind();
+  for(std::size_t b=0; b<nb_boxes; ++b)
+  {
+    if(!internal::read_cell(results, vertex_records, face_records))
+      return false;
+    for(const Vertex_record& v : vertex_records)
+      if(v.global_id == internal::unlocked_vertex || locked_vertices.emplace(v.global_id, nb_vertices).second)
+        ++nb_vertices;
+    nb_faces += face_records.size();
+  }
+
+  std::ofstream os(output_filename);
+  if(!os)
+    return false;
+  set_stream_precision_from_NP(os, np);
+
+  os << "OFF\n" << nb_vertices << " " << nb_faces << " 0\n";
+
+  std::uint64_t next_id = 0;
+  results.rewind();
+  for(std::size_t b=0; b<nb_boxes; ++b)
+  {
+    if(!internal::read_cell(results, vertex_records, face_records))
+      return false;
+    for(const Vertex_record& v : vertex_records)
+    {
+      if(v.global_id == internal::unlocked_vertex || locked_vertices[v.global_id] == next_id)
+      {
+        os << v.point[0] << " " << v.point[1] << " " << v.point[2] << "\n";
+        ++next_id;
+      }
+    }
+  }
+
+  next_id = 0;
+  std::vector<std::uint64_t> output_ids;
+  results.rewind();
+  for(std::size_t b=0; b<nb_boxes; ++b)
+  {
+    if(!internal::read_cell(results, vertex_records, face_records))
+      return false;
+
+    output_ids.resize(vertex_records.size());
+    for(std::size_t i=0; i<vertex_records.size(); ++i)
+    {
+      const Vertex_record& v = vertex_records[i];
+      if(v.global_id == internal::unlocked_vertex)
+        output_ids[i] = next_id++;
+      else
+      {
+        output_ids[i] = locked_vertices[v.global_id];
+        if(output_ids[i] == next_id)
+          ++next_id;
+      }
+    }
+
+    for(const std::array<std::uint64_t, 3>& f : face_records)
+      os << "3 " << output_ids[std::size_t(f[0])] << " " << output_ids[std::size_t(f[1])] << " " << output_ids[std::size_t(f[2])] << "\n";
+  }
+
+  return !os.fail();
+}
+
+} // namespace Surface_mesh_simplification
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_OUT_OF_CORE_H
@@ -19,10 +19,20 @@
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <boost/scoped_array.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
@@ -91,11 +101,25 @@ template<class TM_,
          class GetPlacement_,
          class ShouldIgnore_,
          class VisitorT_,
-         bool use_relaxed_heap>
+         bool use_relaxed_heap,
+         class ConcurrencyTag_ = Sequential_tag>
 class EdgeCollapse
 {
   typedef EdgeCollapse                                                    Self;
 
+#ifdef CGAL_LINKED_WITH_TBB
+  static constexpr bool is_parallel = std::is_convertible<ConcurrencyTag_, Parallel_tag>::value;
+#else
+  static_assert(!std::is_convertible<ConcurrencyTag_, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+  static constexpr bool is_parallel = false;
+#endif
+
+  // In parallel mode, the edges are collapsed by rounds: each round selects among the edges
+  // of lowest cost a set of edges whose 1-ring neighborhoods are disjoint. Their number is
+  // at most the current number of edges divided by this ratio.
+  static constexpr std::size_t parallel_round_ratio = 64;
+
 public:
   typedef TM_                                                             Triangle_mesh;
   typedef GeomTraits_                                                     Geom_traits;
@@ -223,12 +247,18 @@ public:
 private:
   void collect();
   void loop();
+#ifdef CGAL_LINKED_WITH_TBB
+  void compute_costs_in_parallel(const std::vector<halfedge_descriptor>& edges, std::vector<Cost_type>& costs);
+  bool mark_neighborhood(const halfedge_descriptor h, std::vector<unsigned int>& marks, const unsigned int round) const;
+  void loop_in_parallel();
+  void update_neighbors_in_parallel(const std::vector<vertex_descriptor>& kept_vertices);
+#endif
 
   bool is_collapse_topologically_valid(const Profile& profile);
   bool is_tetrahedron(const halfedge_descriptor h);
   bool is_open_triangle(const halfedge_descriptor h1);
   bool is_collapse_geometrically_valid(const Profile& profile, Placement_type placement);
-  void collapse(const Profile& profile, Placement_type placement);
+  vertex_descriptor collapse(const Profile& profile, Placement_type placement);
   void update_neighbors(const vertex_descriptor v_kept);
 
   Profile create_profile(const halfedge_descriptor h) {
@@ -403,8 +433,8 @@ private:
   CGAL_SMS_DEBUG_CODE(unsigned m_step;)
 };
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 EdgeCollapse(Triangle_mesh& tmesh,
              const Geom_traits& traits,
              const Should_stop& should_stop,
@@ -445,9 +475,9 @@ EdgeCollapse(Triangle_mesh& tmesh,
 #endif
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 int
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 run()
 {
   CGAL_expensive_precondition(is_valid_polygon_mesh(m_tm) && CGAL::is_triangle_mesh(m_tm));
@@ -461,7 +491,12 @@ run()
   collect();
 
   // Then proceed to collapse each edge in turn
-  loop();
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr(is_parallel)
+    loop_in_parallel();
+  else
+#endif
+    loop();
 
   CGAL_SMS_TRACE(0, "Finished: " << (m_initial_edge_count - m_current_edge_count) << " edges removed.");
 
@@ -472,9 +507,9 @@ run()
   return r;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collect()
 {
   CGAL_SMS_TRACE(0, "collecting edges...");
@@ -492,6 +527,20 @@ collect()
 
   std::set<halfedge_descriptor> zero_length_edges;
 
+  // in parallel mode, the costs are computed beforehand
+  std::vector<halfedge_descriptor> collected_edges;
+  std::vector<Cost_type> collected_costs;
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr(is_parallel)
+  {
+    for(edge_descriptor e : edges(m_tm))
+      if(!is_constrained(halfedge(e, m_tm)))
+        collected_edges.push_back(halfedge(e, m_tm));
+    compute_costs_in_parallel(collected_edges, collected_costs);
+  }
+#endif
+  std::size_t collected_index = 0;
+
   for(edge_descriptor e : edges(m_tm))
   {
     const halfedge_descriptor h = halfedge(e, m_tm);
@@ -503,11 +552,12 @@ collect()
     }
 
     const Profile profile = create_profile(h);
+    const std::size_t edge_index = collected_index++;
     if(!m_traits.equal_3_object()(profile.p0(), profile.p1()))
     {
       Edge_data& data = get_data(h);
 
-      data.cost() = cost(profile);
+      data.cost() = collected_costs.empty() ? cost(profile) : collected_costs[edge_index];
       insert_in_PQ(h, data);
 
       m_visitor.OnCollected(profile, data.cost());
@@ -581,9 +631,9 @@ collect()
   CGAL_SMS_TRACE(0, "Initial edge count: " << m_initial_edge_count);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 loop()
 {
   CGAL_SMS_TRACE(0, "Collapsing edges...");
@@ -631,7 +681,7 @@ loop()
                                        << " " << get(m_vpm, target(*h, m_tm)) << "\n";
 #endif
           if(m_should_ignore(profile, placement)!= std::nullopt){
-            collapse(profile, placement);
+            update_neighbors(collapse(profile, placement));
           }
           else
           {
@@ -670,9 +720,233 @@ loop()
   }
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+#ifdef CGAL_LINKED_WITH_TBB
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+compute_costs_in_parallel(const std::vector<halfedge_descriptor>& edges,
+                          std::vector<Cost_type>& costs)
+{
+  costs.resize(edges.size());
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, edges.size()),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+                    {
+                      for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                        costs[i] = cost(create_profile(edges[i]));
+                    });
+}
+
+// Marks the vertices of the edge 'h' and their neighbors with 'round', unless one of them is already marked,
+// in which case nothing is marked and 'false' is returned.
+// Two edges whose neighborhoods are disjoint can be handled independently: collapsing one of them
+// does not modify any element used to evaluate the collapse of the other.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+bool
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+mark_neighborhood(const halfedge_descriptor h,
+                  std::vector<unsigned int>& marks,
+                  const unsigned int round) const
+{
+  const vertex_descriptor vs[2] = { source(h, m_tm), target(h, m_tm) };
+
+  for(vertex_descriptor v : vs)
+  {
+    if(marks[get(m_vim, v)] == round)
+      return false;
+    for(halfedge_descriptor h2 : halfedges_around_target(v, m_tm))
+      if(marks[get(m_vim, source(h2, m_tm))] == round)
+        return false;
+  }
+
+  for(vertex_descriptor v : vs)
+  {
+    marks[get(m_vim, v)] = round;
+    for(halfedge_descriptor h2 : halfedges_around_target(v, m_tm))
+      marks[get(m_vim, source(h2, m_tm))] = round;
+  }
+
+  return true;
+}
+
+// Parallel version of `loop()`.
+// The edges are processed by rounds. Each round pops from the PQ a batch of edges of low cost
+// with pairwise disjoint neighborhoods (the edges conflicting with an edge already in the batch are
+// put back in the PQ). The profiles, validity tests, and placements of the edges of the batch are then
+// computed in parallel. The stop predicate, the filter, the visitor, and the collapses themselves
+// are then handled sequentially, in increasing order of cost. Finally, the costs of the edges
+// around the vertices kept are updated in parallel.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+loop_in_parallel()
+{
+  CGAL_SMS_TRACE(0, "Collapsing edges in parallel...");
+
+  struct Candidate
+  {
+    halfedge_descriptor h;
+    std::optional<Profile> profile;
+    Placement_type placement;
+    bool is_topologically_valid = false;
+    bool is_geometrically_valid = false;
+  };
+
+  std::vector<unsigned int> vertex_marks(num_vertices(m_tm), 0);
+  unsigned int round = 0;
+
+  std::vector<Candidate> batch;
+  std::vector<halfedge_descriptor> deferred;
+  std::vector<vertex_descriptor> kept_vertices;
+
+  for(;;)
+  {
+    // (A) select the edges of the batch
+    const std::size_t max_batch_size = (std::max)(std::size_t(1), std::size_t(m_current_edge_count / parallel_round_ratio));
+
+    ++round;
+    batch.clear();
+    deferred.clear();
+
+    std::optional<halfedge_descriptor> opt_h;
+    while(batch.size() < max_batch_size && deferred.size() < max_batch_size && (opt_h = pop_from_PQ()))
+    {
+      CGAL_assertion(!is_constrained(*opt_h));
+
+      if(!get_data(*opt_h).cost())
+      {
+        CGAL_SMS_TRACE(1, edge_to_string(*opt_h) << " uncomputable cost." );
+        continue;
+      }
+
+      if(mark_neighborhood(*opt_h, vertex_marks, round))
+        batch.push_back(Candidate{*opt_h, std::nullopt, std::nullopt});
+      else
+        deferred.push_back(*opt_h);
+    }
+
+    for(halfedge_descriptor h : deferred)
+      insert_in_PQ(h, get_data(h));
+
+    if(batch.empty())
+      break;
+
+    // (B) evaluate the collapses of the edges of the batch
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                        {
+                          Candidate& c = batch[i];
+                          c.profile.emplace(create_profile(c.h));
+                          c.is_topologically_valid = is_collapse_topologically_valid(*c.profile);
+                          if(c.is_topologically_valid)
+                          {
+                            c.placement = get_placement(*c.profile);
+                            c.is_geometrically_valid = is_collapse_geometrically_valid(*c.profile, c.placement);
+                          }
+                        }
+                      });
+
+    // (C) collapse the edges of the batch
+    kept_vertices.clear();
+    for(const Candidate& c : batch)
+    {
+      const Profile& profile = *c.profile;
+      const Cost_type cost = get_data(c.h).cost();
+
+      m_visitor.OnSelected(profile, cost, m_initial_edge_count, m_current_edge_count);
+
+      if(m_should_stop(*cost, profile, m_initial_edge_count, m_current_edge_count))
+      {
+        m_visitor.OnStopConditionReached(profile);
+
+        CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                            << " current edge count=" << m_current_edge_count
+                            << " current edge: " << edge_to_string(c.h));
+        return;
+      }
+
+      if(!c.is_topologically_valid)
+      {
+        m_visitor.OnNonCollapsable(profile);
+
+        CGAL_SMS_TRACE(1, edge_to_string(c.h) << " NOT Collapsible" );
+      }
+      else if(c.is_geometrically_valid)
+      {
+        if(m_should_ignore(profile, c.placement) != std::nullopt)
+        {
+          kept_vertices.push_back(collapse(profile, c.placement));
+        }
+        else
+        {
+          m_visitor.OnNonCollapsable(profile);
+
+          CGAL_SMS_TRACE(1, edge_to_string(c.h) << " NOT Collapsible" );
+        }
+      }
+    }
+
+    // (D) update the costs of the edges around the vertices kept
+    update_neighbors_in_parallel(kept_vertices);
+  }
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+update_neighbors_in_parallel(const std::vector<vertex_descriptor>& kept_vertices)
+{
+  CGAL_SMS_TRACE(3,"Updating cost of neighboring edges...");
+
+  // (A) collect all edges around each vertex adjacent to a vertex kept
+  std::vector<halfedge_descriptor> edges_to_update;
+  for(vertex_descriptor v_kept : kept_vertices)
+    for(halfedge_descriptor h : halfedges_around_target(v_kept, m_tm))
+      for(halfedge_descriptor h2 : halfedges_around_target(source(h, m_tm), m_tm))
+        edges_to_update.push_back(primary_edge(h2));
+
+  std::sort(edges_to_update.begin(), edges_to_update.end(), Compare_id(this));
+  edges_to_update.erase(std::unique(edges_to_update.begin(), edges_to_update.end()), edges_to_update.end());
+
+  // do not insert constrained edges
+  edges_to_update.erase(std::remove_if(edges_to_update.begin(), edges_to_update.end(),
+                                       [this](const halfedge_descriptor h)
+                                       {
+                                         return !get_data(h).is_in_PQ() && is_constrained(h);
+                                       }),
+                        edges_to_update.end());
+
+  // (B) compute the new costs
+  std::vector<Cost_type> costs;
+  compute_costs_in_parallel(edges_to_update, costs);
+
+  // (C) update the PQ
+  for(std::size_t i=0; i<edges_to_update.size(); ++i)
+  {
+    const halfedge_descriptor h = edges_to_update[i];
+    Edge_data& data = get_data(h);
+    data.cost() = costs[i];
+
+    if(data.is_in_PQ())
+    {
+      CGAL_SMS_TRACE(3, edge_to_string(h) << " updated in the PQ");
+      update_in_PQ(h, data);
+    }
+    else
+    {
+      CGAL_SMS_TRACE(3, edge_to_string(h) << " re-inserted in the PQ");
+      insert_in_PQ(h, data);
+    }
+  }
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_border_or_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -684,9 +958,9 @@ is_border_or_constrained(const vertex_descriptor v) const
   return false;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -705,9 +979,9 @@ is_constrained(const vertex_descriptor v) const
 // The link condition is as follows: for every vertex 'k' adjacent to both 'p and 'q',
 // "p,k,q" is a facet of the mesh.
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_topologically_valid(const Profile& profile)
 {
   bool res = true;
@@ -873,17 +1147,17 @@ is_collapse_topologically_valid(const Profile& profile)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_tetrahedron(const halfedge_descriptor h)
 {
   return CGAL::is_tetrahedron(h, m_tm);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_open_triangle(const halfedge_descriptor h1)
 {
   bool res = false;
@@ -912,9 +1186,9 @@ is_open_triangle(const halfedge_descriptor h1)
 // respective areas is no greater than a max value and the internal
 // dihedral angle formed by their supporting planes is no greater than
 // a given threshold
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, const Point& p3) const
 {
   bool res = false;
@@ -964,9 +1238,9 @@ are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, co
 }
 
 // Returns the directed halfedge connecting v0 to v1, if exists.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::halfedge_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::halfedge_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_connection(const vertex_descriptor v0,
                 const vertex_descriptor v1) const
 {
@@ -981,9 +1255,9 @@ find_connection(const vertex_descriptor v0,
 
 // Given the edge 'e' around the link for the collapsinge edge "v0-v1", finds the vertex that makes a triangle adjacent to 'e' but exterior to the link (i.e not containing v0 nor v1)
 // If 'e' is a null handle OR 'e' is a border edge, there is no such triangle and a null handle is returned.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::vertex_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
                                        const vertex_descriptor v0,
                                        const vertex_descriptor v1) const
@@ -1017,9 +1291,9 @@ find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
 // A collapse is geometrically valid if, in the resulting local mesh no two adjacent triangles form an internal dihedral angle
 // greater than a fixed threshold (i.e. triangles do not "fold" into each other)
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
 {
   bool res = false;
@@ -1116,9 +1390,9 @@ is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collapse(const Profile& profile,
          Placement_type placement)
 {
@@ -1214,14 +1488,14 @@ collapse(const Profile& profile,
   m_visitor.OnCollapsed(profile, v_res);
   internal::After_collapse_oracles_updater<Self>(*this)(profile, v_res);
 
-  update_neighbors(v_res);
-
   CGAL_SMS_DEBUG_CODE(++m_step;)
+
+  return v_res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 update_neighbors(const vertex_descriptor v_kept)
 {
   CGAL_SMS_TRACE(3,"Updating cost of neighboring edges...");
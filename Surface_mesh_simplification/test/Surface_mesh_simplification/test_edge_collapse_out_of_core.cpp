@@ -0,0 +1,77 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse_out_of_core.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Kernel;
+typedef Kernel::Point_3                                       Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface_mesh;
+
+void check_output(const Surface_mesh& input, const std::string& output_filename, const double ratio)
+{
+  Surface_mesh output;
+  bool ok = CGAL::IO::read_polygon_mesh(output_filename, output);
+  assert(ok);
+  CGAL_USE(ok);
+
+  std::cout << faces(input).size() << " faces -> " << faces(output).size() << " faces" << std::endl;
+
+  // the cells have been stitched back: the output is a closed triangle mesh, as the input
+  assert(CGAL::is_valid_polygon_mesh(output) && CGAL::is_triangle_mesh(output));
+  assert(CGAL::is_closed(output));
+  assert(num_vertices(input) - num_edges(input) + num_faces(input) ==
+         num_vertices(output) - num_edges(output) + num_faces(output));
+
+  // the boundaries of the cells are not simplified, so the target might not be reached
+  assert(faces(output).size() < faces(input).size());
+  assert(faces(output).size() > 0.9 * ratio * faces(input).size());
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/femur.off";
+  const double ratio = 0.1;
+
+  Surface_mesh input;
+  if(!CGAL::IO::read_polygon_mesh(filename, input))
+  {
+    std::cerr << "Failed to read input mesh: " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // a single cell
+  bool ok = SMS::edge_collapse_out_of_core(filename, "out_of_core_1.off", ratio);
+  assert(ok);
+  check_output(input, "out_of_core_1.off", ratio);
+
+  // several cells
+  ok = SMS::edge_collapse_out_of_core(filename, "out_of_core_2.off", ratio,
+                                      CGAL::parameters::maximum_number_of_faces(faces(input).size() / 8)
+                                                       .stream_precision(17));
+  assert(ok);
+  check_output(input, "out_of_core_2.off", ratio);
+
+  // the same, from a PLY file
+  ok = CGAL::IO::write_polygon_mesh("out_of_core_input.ply", input, CGAL::parameters::use_binary_mode(true));
+  assert(ok);
+  ok = SMS::edge_collapse_out_of_core("out_of_core_input.ply", "out_of_core_3.off", ratio,
+                                      CGAL::parameters::maximum_number_of_faces(faces(input).size() / 8));
+  assert(ok);
+  check_output(input, "out_of_core_3.off", ratio);
+
+  // failures
+  ok = SMS::edge_collapse_out_of_core("does_not_exist.off", "out_of_core_4.off", ratio);
+  assert(!ok);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
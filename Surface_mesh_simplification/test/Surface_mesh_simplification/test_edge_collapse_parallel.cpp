@@ -0,0 +1,137 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Face_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Midpoint_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_normal_change_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Constrained_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Kernel;
+typedef Kernel::Point_3                                       Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface_mesh;
+typedef CGAL::Polyhedron_3<Kernel>                            Polyhedron;
+
+template <typename Mesh>
+void test_edge_count(const Mesh& input)
+{
+  const std::size_t target = num_edges(input) / 10;
+
+  Mesh sequential_mesh = input;
+  SMS::Edge_count_stop_predicate<Mesh> stop(target);
+  int r_seq = SMS::edge_collapse(sequential_mesh, stop);
+
+  Mesh parallel_mesh = input;
+  int r_par = SMS::edge_collapse(parallel_mesh, stop,
+                                 CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::cout << "sequential: " << r_seq << " edges removed, parallel: " << r_par << " edges removed" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(parallel_mesh) && CGAL::is_triangle_mesh(parallel_mesh));
+  assert(edges(parallel_mesh).size() <= target);
+  assert(r_par == int(edges(input).size() - edges(parallel_mesh).size()));
+
+  // the same edges are not necessarily collapsed, but the target is reached in both cases
+  assert(edges(sequential_mesh).size() <= target);
+}
+
+void test_policies(const Surface_mesh& input)
+{
+  // midpoint placement filtered by the normal change, and a face count ratio stop predicate
+  Surface_mesh mesh = input;
+  SMS::Face_count_ratio_stop_predicate<Surface_mesh> stop(0.2, mesh);
+  SMS::edge_collapse(mesh, stop,
+                     CGAL::parameters::get_cost(SMS::Edge_length_cost<Kernel>())
+                                      .get_placement(SMS::Bounded_normal_change_placement<SMS::Midpoint_placement<Kernel> >())
+                                      .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  assert(CGAL::is_valid_polygon_mesh(mesh) && CGAL::is_triangle_mesh(mesh));
+  assert(faces(mesh).size() <= 0.2 * faces(input).size() + 1);
+}
+
+void test_constrained_edges(const Surface_mesh& input)
+{
+  Surface_mesh mesh = input;
+
+  Surface_mesh::Property_map<Surface_mesh::Edge_index, bool> ecm =
+    mesh.add_property_map<Surface_mesh::Edge_index, bool>("e:constrained", false).first;
+
+  // constrain some edges and keep track of their endpoints
+  std::size_t nb_constrained = 0;
+  std::vector<std::pair<Point_3, Point_3> > constrained_segments;
+  for(Surface_mesh::Edge_index e : edges(mesh))
+  {
+    if(e.idx() % 13 == 0)
+    {
+      put(ecm, e, true);
+      ++nb_constrained;
+      constrained_segments.emplace_back(mesh.point(source(halfedge(e, mesh), mesh)),
+                                        mesh.point(target(halfedge(e, mesh), mesh)));
+    }
+  }
+
+  SMS::Edge_count_stop_predicate<Surface_mesh> stop(num_edges(mesh) / 4);
+  SMS::edge_collapse(mesh, stop,
+                     CGAL::parameters::edge_is_constrained_map(ecm)
+                                      .get_placement(SMS::Constrained_placement<SMS::LindstromTurk_placement<Surface_mesh>,
+                                                                                decltype(ecm)>(ecm))
+                                      .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  assert(CGAL::is_valid_polygon_mesh(mesh) && CGAL::is_triangle_mesh(mesh));
+
+  // constrained edges are never collapsed, and their endpoints are not moved
+  std::size_t nb_remaining = 0;
+  for(Surface_mesh::Edge_index e : edges(mesh))
+    if(get(ecm, e))
+      ++nb_remaining;
+  assert(nb_remaining == nb_constrained);
+
+  std::set<Point_3> points;
+  for(Surface_mesh::Vertex_index v : vertices(mesh))
+    points.insert(mesh.point(v));
+  for(const auto& s : constrained_segments)
+    assert(points.count(s.first) == 1 && points.count(s.second) == 1);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/femur.off";
+
+  Surface_mesh sm;
+  if(!CGAL::IO::read_polygon_mesh(filename, sm))
+  {
+    std::cerr << "Failed to read input mesh: " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Polyhedron poly;
+  if(!CGAL::IO::read_polygon_mesh(filename, poly))
+  {
+    std::cerr << "Failed to read input mesh: " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  test_edge_count(sm);
+  test_edge_count(poly);
+  test_policies(sm);
+  test_constrained_edges(sm);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
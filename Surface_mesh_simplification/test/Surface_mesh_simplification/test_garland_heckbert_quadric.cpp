@@ -0,0 +1,133 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_policies.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Simple_cartesian<double>                                             Kernel;
+typedef Kernel::FT                                                                 FT;
+typedef Kernel::Point_3                                                            Point_3;
+typedef CGAL::Surface_mesh<Point_3>                                                Surface_mesh;
+
+typedef SMS::internal::GarlandHeckbert_matrix_types<Kernel>                        Matrix_types;
+typedef Matrix_types::Quadric                                                      Quadric;
+typedef Matrix_types::Mat_4                                                        Mat_4;
+typedef Matrix_types::Col_4                                                        Col_4;
+
+bool approx_equal(const FT a, const FT b)
+{
+  return std::abs(a - b) <= 1e-9 * (std::max)(FT(1), (std::max)(std::abs(a), std::abs(b)));
+}
+
+// the packed representation must agree with the full (4 x 4) matrix
+void test_packed_quadric(CGAL::Random& rnd)
+{
+  for(int i=0; i<1000; ++i)
+  {
+    Mat_4 m = Mat_4::Zero();
+    for(int j=0; j<3; ++j)
+    {
+      const Col_4 plane { rnd.get_double(-1, 1), rnd.get_double(-1, 1),
+                          rnd.get_double(-1, 1), rnd.get_double(-1, 1) };
+      m += plane * plane.transpose();
+    }
+
+    // keep the (3 x 3) system well conditioned so that both solutions can be compared
+    m.block(0, 0, 3, 3) += Eigen::Matrix<FT, 3, 3>::Identity();
+
+    const Quadric q(m);
+    assert(!q.is_zero());
+    assert(q.to_matrix<Mat_4>() == m);
+
+    const Quadric q2 = q + FT(2) * q;
+    assert(q2.to_matrix<Mat_4>().isApprox(FT(3) * m));
+
+    const Col_4 p { rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1), FT(1) };
+    const Col_4 r { rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1), FT(0) };
+    assert(approx_equal(q.evaluate(p(0), p(1), p(2)), (p.transpose() * m * p)(0, 0)));
+    assert(approx_equal(q.bilinear_form(p, r), (p.transpose() * m * r)(0, 0)));
+
+    // closed-form minimizer vs. the inverse of the full matrix
+    Mat_4 x;
+    x << m.block(0, 0, 3, 4), 0, 0, 0, 1;
+    const Col_4 expected = x.inverse().col(3);
+
+    Col_4 opt;
+    const bool invertible = SMS::internal::solve_quadric_minimizer(q, opt);
+    assert(invertible);
+    CGAL_USE(invertible);
+    for(int j=0; j<4; ++j)
+      assert(approx_equal(opt(j), expected(j)));
+  }
+
+  // a singular quadric: a single plane, the optimum falls back to the segment
+  const Col_4 plane { 0, 0, 1, 0 };
+  const Quadric q(Mat_4(plane * plane.transpose()));
+  Col_4 opt;
+  assert(!SMS::internal::solve_quadric_minimizer(q, opt));
+
+  const Col_4 p0 { 0, 0, 1, 1 };
+  const Col_4 p1 { 1, 0, -1, 1 };
+  opt = SMS::internal::construct_optimal_point_singular<Kernel>(q, p0, p1);
+  assert(approx_equal(opt(0), 0.5) && approx_equal(opt(2), 0) && approx_equal(opt(3), 1));
+}
+
+template <typename Policies>
+void test_policies(const Surface_mesh& input)
+{
+  Surface_mesh mesh = input;
+
+  const Policies policies(mesh);
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(0.2);
+  const int r = SMS::edge_collapse(mesh, stop, CGAL::parameters::get_cost(policies.get_cost())
+                                                                .get_placement(policies.get_placement()));
+
+  std::cout << r << " edges removed, " << edges(mesh).size() << " edges left" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(mesh) && CGAL::is_triangle_mesh(mesh));
+  assert(edges(mesh).size() <= 0.2 * edges(input).size() + 1);
+  assert(r == int(edges(input).size() - edges(mesh).size()));
+
+  for(Surface_mesh::Vertex_index v : vertices(mesh))
+  {
+    const Point_3& p = mesh.point(v);
+    assert(std::isfinite(p.x()) && std::isfinite(p.y()) && std::isfinite(p.z()));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/femur.off";
+
+  CGAL::Random rnd = CGAL::get_default_random();
+  std::cout << "Seed: " << rnd.get_seed() << std::endl;
+
+  test_packed_quadric(rnd);
+
+  Surface_mesh mesh;
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh))
+  {
+    std::cerr << "Failed to read input mesh: " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  test_policies<SMS::GarlandHeckbert_plane_policies<Surface_mesh, Kernel> >(mesh);
+  test_policies<SMS::GarlandHeckbert_triangle_policies<Surface_mesh, Kernel> >(mesh);
+  test_policies<SMS::GarlandHeckbert_probabilistic_plane_policies<Surface_mesh, Kernel> >(mesh);
+  test_policies<SMS::GarlandHeckbert_probabilistic_triangle_policies<Surface_mesh, Kernel> >(mesh);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -172,6 +172,31 @@ template < class PointWithInfoInputIterator >
 std::ptrdiff_t
 insert(PointWithInfoInputIterator first, PointWithInfoInputIterator last);
 
+/*!
+inserts the points in the range `[first,last)`, possibly in parallel.
+Returns the number of inserted points.
+
+If the triangulation is empty and `ConcurrencyTag` is `Parallel_tag`, the points
+are sorted along the \f$ x\f$-axis and split in vertical strips that are triangulated
+independently in parallel. The faces whose circumscribing circles certainly
+do not contain points of other strips are kept, and the region between them is filled using the
+Delaunay triangulation of the vertices of the other faces.
+The triangulation obtained is the same as with `insert(first, last)`,
+including in the degenerate cases, as the same symbolic perturbation scheme is used.
+Otherwise, or if the points are too few or all collinear, this function is equivalent to `insert(first, last)`.
+
+\tparam ConcurrencyTag enables sequential versus parallel insertion.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam InputIterator must be an input iterator with the value type `Point` or `std::pair<Point,Vertex::Info>`.
+In the latter case, `Vertex` must be a model of the concept `TriangulationVertexBaseWithInfo_2`.
+
+\pre In the parallel case, the traits class must provide the functor `Construct_bbox_2`
+and the member function `construct_bbox_2_object()`, as the kernels and the projection traits classes do.
+*/
+template < typename ConcurrencyTag, class InputIterator >
+std::ptrdiff_t
+insert(InputIterator first, InputIterator last);
+
 /*!
 removes the vertex from the triangulation.
 */
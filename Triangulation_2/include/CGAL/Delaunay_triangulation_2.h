@@ -29,6 +29,14 @@
 
 #endif //CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 
+#include <CGAL/tags.h>
+#include <type_traits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <CGAL/Triangulation_2/internal/Delaunay_triangulation_2_parallel_insertion.h>
+#endif
+
 namespace CGAL {
 
 template < class Gt,
@@ -393,6 +401,44 @@ public:
   }
 #endif //CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 
+  // Same as `insert(first, last)`, but with `ConcurrencyTag == Parallel_tag`, the points
+  // are inserted using several threads if the triangulation is empty.
+  // The value type of `InputIterator` is either `Point` or `std::pair<Point, Info>`.
+  template < typename ConcurrencyTag, class InputIterator >
+  std::ptrdiff_t
+  insert(InputIterator first, InputIterator last)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    typedef typename std::iterator_traits<InputIterator>::value_type Value;
+    std::vector<Value> values(first, last);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      if(this->number_of_vertices() == 0) {
+        if constexpr (std::is_convertible<Value, Point>::value) {
+          std::vector<Point> points(values.begin(), values.end());
+          if(internal::parallel_insert_in_empty_Delaunay_triangulation_2(
+               *this, points, [](Vertex_handle, std::size_t) {}))
+            return this->number_of_vertices();
+        } else {
+          std::vector<Point> points;
+          points.reserve(values.size());
+          for(const Value& value : values)
+            points.push_back(value.first);
+          if(internal::parallel_insert_in_empty_Delaunay_triangulation_2(
+               *this, points, [&values](Vertex_handle v, std::size_t i) { v->info() = values[i].second; }))
+            return this->number_of_vertices();
+        }
+      }
+    }
+#endif
+
+    return insert(values.begin(), values.end());
+  }
+
   template <class OutputItFaces, class OutputItBoundaryEdges>
   std::pair<OutputItFaces,OutputItBoundaryEdges>
   get_conflicts_and_boundary(const Point  &p,
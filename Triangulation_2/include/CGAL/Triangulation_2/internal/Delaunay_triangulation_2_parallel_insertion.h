@@ -0,0 +1,453 @@
+// Copyright (c) 2024  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_TRIANGULATION_2_DELAUNAY_TRIANGULATION_2_PARALLEL_INSERTION_H
+#define CGAL_TRIANGULATION_2_DELAUNAY_TRIANGULATION_2_PARALLEL_INSERTION_H
+
+#include <CGAL/license/Triangulation_2.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <CGAL/Triangulation_data_structure_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Triangulation_face_base_with_info_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Bbox_2.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+template <class Gt, class Tds>
+class Delaunay_triangulation_2;
+
+namespace internal {
+
+// Inserts `points` in the empty Delaunay triangulation `dt`, using several threads.
+//
+// The points are sorted along the x-axis and split in vertical strips, whose
+// Delaunay triangulations are computed independently. A face of the triangulation
+// of a strip whose circumscribing disk certainly lies strictly between the points
+// of the previous and of the next strips (this is checked with interval arithmetic
+// on the bounding boxes of the points) is a face of the whole triangulation,
+// and is said to be final. The vertices incident to a non-final face are then
+// triangulated together: the faces of this border triangulation that lie outside
+// the union of the final faces are exactly the non-final faces of the whole triangulation.
+// They are identified combinatorially, by a traversal that starts from the infinite
+// faces and stops at the edges of final faces (frontier edges).
+// Since the conflicts are tested with the symbolic perturbation of `Delaunay_triangulation_2`,
+// the triangulation obtained is the same as the one obtained with a sequential insertion.
+//
+// `set_info(v, i)` is called for each vertex `v` created from `points[i]`.
+// Returns `false`, without modifying `dt`, if the points are too few or degenerate
+// for the strips to be triangulated independently.
+template <class Gt, class Tds, class SetInfo>
+bool
+parallel_insert_in_empty_Delaunay_triangulation_2(Delaunay_triangulation_2<Gt, Tds>& dt,
+                                                  const std::vector<typename Gt::Point_2>& points,
+                                                  const SetInfo& set_info)
+{
+  typedef typename Gt::Point_2                            Point;
+  typedef typename Tds::Vertex_handle                     Vertex_handle;
+  typedef typename Tds::Face_handle                       Face_handle;
+
+  // `in_output` is the status of the face: final face for the triangulation
+  // of a strip, face outside the final faces for the border triangulation
+  struct Face_info
+  {
+    bool in_output = false;
+    Face_handle output_face;
+  };
+
+  typedef Triangulation_vertex_base_with_info_2<std::size_t, Gt>     Local_vb;
+  typedef Triangulation_face_base_with_info_2<Face_info, Gt>         Local_fb;
+  typedef Triangulation_data_structure_2<Local_vb, Local_fb>         Local_tds;
+  typedef Delaunay_triangulation_2<Gt, Local_tds>                    Local_dt;
+  typedef typename Local_dt::Face_handle                             Local_face_handle;
+  typedef typename Local_dt::Vertex_handle                           Local_vertex_handle;
+
+  typedef std::pair<Point, std::size_t>                              Point_with_index;
+  typedef First_of_pair_property_map<Point_with_index>               Point_pmap;
+  typedef Spatial_sort_traits_adapter_2<Gt, Point_pmap>              Sort_traits;
+
+  const std::size_t min_strip_size = 1024;
+
+  CGAL_precondition(dt.number_of_vertices() == 0);
+
+  const std::size_t nb_input_points = points.size();
+  std::size_t nb_strips = (std::min)(std::size_t(4 * tbb::this_task_arena::max_concurrency()),
+                                     nb_input_points / min_strip_size);
+  if(nb_strips < 2)
+    return false;
+
+  const Gt& gt = dt.geom_traits();
+  typename Gt::Construct_bbox_2 bbox = gt.construct_bbox_2_object();
+
+  // sort the points along the x-axis, using their bounding boxes
+  struct Sort_key
+  {
+    double x, y;
+    std::size_t index;
+    bool operator<(const Sort_key& other) const
+    {
+      return x < other.x || (x == other.x && y < other.y);
+    }
+  };
+  std::vector<Sort_key> keys(nb_input_points);
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_input_points),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+  {
+    for(std::size_t i = r.begin(); i != r.end(); ++i)
+    {
+      const Bbox_2 b = bbox(points[i]);
+      keys[i] = Sort_key{ b.xmin(), b.ymin(), i };
+    }
+  });
+  tbb::parallel_sort(keys.begin(), keys.end());
+
+  // split the sorted points in strips, without separating points with the same
+  // bounding box, so that identical points are in the same strip
+  std::vector<std::size_t> strip_begin(1, 0);
+  for(std::size_t s=1; s<nb_strips; ++s)
+  {
+    std::size_t b = (std::max)(s * nb_input_points / nb_strips, strip_begin.back() + 1);
+    while(b < nb_input_points && keys[b].x == keys[b-1].x && keys[b].y == keys[b-1].y)
+      ++b;
+    if(b < nb_input_points)
+      strip_begin.push_back(b);
+  }
+  strip_begin.push_back(nb_input_points);
+  nb_strips = strip_begin.size() - 1;
+  if(nb_strips < 2)
+    return false;
+
+  // x-range of the points of each strip
+  std::vector<double> strip_xmin(nb_strips), strip_xmax(nb_strips);
+  tbb::parallel_for(std::size_t(0), nb_strips, [&](std::size_t s)
+  {
+    double xmax = -(std::numeric_limits<double>::max)();
+    for(std::size_t k = strip_begin[s]; k != strip_begin[s+1]; ++k)
+      xmax = (std::max)(xmax, bbox(points[keys[k].index]).xmax());
+    strip_xmin[s] = keys[strip_begin[s]].x;
+    strip_xmax[s] = xmax;
+  });
+
+  // the points of the other strips are either on the left of `lower[s]`
+  // or on the right of `upper[s]`
+  std::vector<double> lower(nb_strips), upper(nb_strips);
+  lower[0] = -std::numeric_limits<double>::infinity();
+  for(std::size_t s=1; s<nb_strips; ++s)
+    lower[s] = (std::max)(lower[s-1], strip_xmax[s-1]);
+  upper[nb_strips-1] = std::numeric_limits<double>::infinity();
+  for(std::size_t s=nb_strips-1; s>0; --s)
+    upper[s-1] = (std::min)(upper[s], strip_xmin[s]);
+
+  struct Frontier_edge
+  {
+    Local_face_handle final_face;
+    int final_index;
+    Local_face_handle border_face;
+    int border_index;
+  };
+
+  std::vector<Local_dt> strips(nb_strips, Local_dt(gt));
+  std::vector<std::vector<Frontier_edge> > strip_frontiers(nb_strips);
+  std::vector<std::size_t> strip_nb_final_faces(nb_strips, 0);
+  std::vector<unsigned char> on_border(nb_input_points, 0);
+  std::atomic<bool> degenerate(false);
+
+  tbb::parallel_for(std::size_t(0), nb_strips, [&](std::size_t s)
+  {
+    Local_dt& local_dt = strips[s];
+    std::vector<Point_with_index> strip_points;
+    strip_points.reserve(strip_begin[s+1] - strip_begin[s]);
+    for(std::size_t k = strip_begin[s]; k != strip_begin[s+1]; ++k)
+      strip_points.emplace_back(points[keys[k].index], keys[k].index);
+    spatial_sort(strip_points.begin(), strip_points.end(), Sort_traits(Point_pmap(), gt));
+
+    Local_face_handle hint;
+    for(const Point_with_index& p : strip_points)
+    {
+      const std::size_t nv = local_dt.number_of_vertices();
+      Local_vertex_handle v = local_dt.insert(p.first, hint);
+      if(local_dt.number_of_vertices() != nv)
+        v->info() = p.second;
+      hint = v->face();
+    }
+    if(local_dt.dimension() != 2)
+    {
+      degenerate = true;
+      return;
+    }
+
+    {
+      // The circumcenter is `a + (nx, ny) / d`. The disk is on the right of `lower[s]` if
+      // `(a.x - lower[s]) * d + nx` has the sign of `d` and its square is larger than `nx^2 + ny^2`.
+      typedef Interval_nt_advanced I;
+      Protect_FPU_rounding<true> protection;
+      const bool has_lower = s != 0, has_upper = s + 1 != nb_strips;
+      for(Local_face_handle f : local_dt.finite_face_handles())
+      {
+        const Bbox_2 ba = bbox(f->vertex(0)->point()),
+                     bb = bbox(f->vertex(1)->point()),
+                     bc = bbox(f->vertex(2)->point());
+        const I ax(ba.xmin(), ba.xmax()), ay(ba.ymin(), ba.ymax());
+        const I bx = I(bb.xmin(), bb.xmax()) - ax, by = I(bb.ymin(), bb.ymax()) - ay;
+        const I cx = I(bc.xmin(), bc.xmax()) - ax, cy = I(bc.ymin(), bc.ymax()) - ay;
+        const I b2 = square(bx) + square(by), c2 = square(cx) + square(cy);
+        const I d = 2 * (bx*cy - by*cx);
+        const I nx = cy*b2 - by*c2, ny = bx*c2 - cx*b2;
+        const I r2 = square(nx) + square(ny);
+        auto separated = [&](const I& t)
+        {
+          return ((d.inf() > 0 && t.inf() > 0) || (d.sup() < 0 && t.sup() < 0)) &&
+                 (square(t) - r2).inf() > 0;
+        };
+        f->info().in_output = (!has_lower || separated((ax - lower[s]) * d + nx)) &&
+                              (!has_upper || separated((upper[s] - ax) * d - nx));
+      }
+    }
+
+    for(Local_face_handle f : local_dt.all_face_handles())
+    {
+      if(!local_dt.is_infinite(f) && f->info().in_output)
+      {
+        ++strip_nb_final_faces[s];
+        for(int i=0; i<3; ++i)
+        {
+          Local_face_handle n = f->neighbor(i);
+          if(local_dt.is_infinite(n) || !n->info().in_output)
+            strip_frontiers[s].push_back(Frontier_edge{f, i, Local_face_handle(), 0});
+        }
+      }
+      else
+      {
+        for(int i=0; i<3; ++i)
+          if(!local_dt.is_infinite(f->vertex(i)))
+            on_border[f->vertex(i)->info()] = 1;
+      }
+    }
+  });
+
+  if(degenerate)
+    return false;
+
+  // frontier edges are indexed by their endpoints, oriented as in the final face
+  std::vector<Frontier_edge> frontier;
+  for(std::vector<Frontier_edge>& sf : strip_frontiers)
+  {
+    frontier.insert(frontier.end(), sf.begin(), sf.end());
+    std::vector<Frontier_edge>().swap(sf);
+  }
+  auto edge_key = [nb_input_points](std::size_t a, std::size_t b) { return a * nb_input_points + b; };
+  std::unordered_map<std::size_t, std::size_t> frontier_map;
+  frontier_map.reserve(frontier.size());
+  for(std::size_t i=0; i<frontier.size(); ++i)
+  {
+    const Local_face_handle f = frontier[i].final_face;
+    const int fi = frontier[i].final_index;
+    frontier_map.emplace(edge_key(f->vertex(Local_dt::ccw(fi))->info(), f->vertex(Local_dt::cw(fi))->info()), i);
+  }
+
+  // triangulation of the vertices incident to non-final faces
+  std::vector<Point_with_index> border_points;
+  for(std::size_t i=0; i<nb_input_points; ++i)
+    if(on_border[i])
+      border_points.emplace_back(points[i], i);
+  spatial_sort(border_points.begin(), border_points.end(), Sort_traits(Point_pmap(), gt));
+
+  // identical points with different bounding boxes might be in different strips,
+  // and are then on the border
+  std::vector<std::size_t> duplicates;
+  Local_dt border_dt(gt);
+  Local_face_handle hint;
+  for(const Point_with_index& p : border_points)
+  {
+    const std::size_t nv = border_dt.number_of_vertices();
+    Local_vertex_handle v = border_dt.insert(p.first, hint);
+    if(border_dt.number_of_vertices() != nv)
+      v->info() = p.second;
+    else
+      duplicates.push_back(p.second);
+    hint = v->face();
+  }
+  if(border_dt.dimension() != 2)
+    return false;
+
+  // Selects the faces of the border triangulation that are not covered by final faces,
+  // starting from the infinite faces and from the faces on the other side of frontier edges.
+  // Returns the frontier edge `(f, i)` if it is seen from the outside of the final faces.
+  auto frontier_edge_from_outside = [&](Local_face_handle f, int i) -> Frontier_edge*
+  {
+    const Local_vertex_handle a = f->vertex(Local_dt::ccw(i)), b = f->vertex(Local_dt::cw(i));
+    if(border_dt.is_infinite(a) || border_dt.is_infinite(b))
+      return nullptr;
+    auto it = frontier_map.find(edge_key(b->info(), a->info()));
+    return it == frontier_map.end() ? nullptr : &frontier[it->second];
+  };
+
+  std::vector<Local_face_handle> stack;
+  std::size_t nb_border_faces = 0;
+  for(Local_face_handle f : border_dt.all_face_handles())
+  {
+    bool seed = border_dt.is_infinite(f);
+    for(int i=0; i<3; ++i)
+    {
+      if(Frontier_edge* fe = frontier_edge_from_outside(f, i))
+      {
+        fe->border_face = f;
+        fe->border_index = i;
+        seed = true;
+      }
+    }
+    if(seed && !f->info().in_output)
+    {
+      f->info().in_output = true;
+      stack.push_back(f);
+    }
+  }
+  while(!stack.empty())
+  {
+    Local_face_handle f = stack.back();
+    stack.pop_back();
+    ++nb_border_faces;
+    for(int i=0; i<3; ++i)
+    {
+      Local_face_handle n = f->neighbor(i);
+      if(!n->info().in_output && frontier_edge_from_outside(f, i) == nullptr)
+      {
+        n->info().in_output = true;
+        stack.push_back(n);
+      }
+    }
+  }
+
+  // Gather the final faces and the selected border faces in `dt`. The vertices and faces
+  // are first created sequentially, and then filled in parallel, strip by strip.
+  Tds& tds = dt.tds();
+  const Vertex_handle infinite_vertex = dt.infinite_vertex();
+  if(infinite_vertex->face() != Face_handle()) // face of the 0-dimensional triangulation
+    tds.delete_face(infinite_vertex->face());
+
+  std::vector<std::size_t> strip_first_vertex(nb_strips + 1, 0), strip_first_face(nb_strips + 1, 0);
+  for(std::size_t s=0; s<nb_strips; ++s)
+  {
+    strip_first_vertex[s+1] = strip_first_vertex[s] + strips[s].number_of_vertices();
+    strip_first_face[s+1] = strip_first_face[s] + strip_nb_final_faces[s];
+  }
+  std::vector<Vertex_handle> new_vertices(strip_first_vertex.back());
+  for(Vertex_handle& v : new_vertices)
+    v = tds.create_vertex();
+  std::vector<Face_handle> new_faces(strip_first_face.back() + nb_border_faces);
+  for(Face_handle& f : new_faces)
+    f = tds.create_face();
+
+  std::vector<Vertex_handle> vertex_map(nb_input_points);
+  tbb::parallel_for(std::size_t(0), nb_strips, [&](std::size_t s)
+  {
+    const Local_dt& local_dt = strips[s];
+    std::size_t vi = strip_first_vertex[s];
+    for(Local_vertex_handle lv : local_dt.finite_vertex_handles())
+    {
+      Vertex_handle v = new_vertices[vi++];
+      v->set_point(lv->point());
+      set_info(v, lv->info());
+      vertex_map[lv->info()] = v;
+    }
+
+    std::size_t fi = strip_first_face[s];
+    for(Local_face_handle lf : local_dt.finite_face_handles())
+    {
+      if(!lf->info().in_output)
+        continue;
+      Face_handle f = new_faces[fi++];
+      lf->info().output_face = f;
+      for(int i=0; i<3; ++i)
+      {
+        Vertex_handle v = vertex_map[lf->vertex(i)->info()];
+        f->set_vertex(i, v);
+        v->set_face(f);
+      }
+    }
+    for(Local_face_handle lf : local_dt.finite_face_handles())
+    {
+      if(!lf->info().in_output)
+        continue;
+      for(int i=0; i<3; ++i)
+      {
+        Local_face_handle ln = lf->neighbor(i);
+        if(!local_dt.is_infinite(ln) && ln->info().in_output)
+          lf->info().output_face->set_neighbor(i, ln->info().output_face);
+      }
+    }
+  });
+
+  std::size_t fi = strip_first_face.back();
+  for(Local_face_handle lf : border_dt.all_face_handles())
+  {
+    if(!lf->info().in_output)
+      continue;
+    Face_handle f = new_faces[fi++];
+    lf->info().output_face = f;
+    for(int i=0; i<3; ++i)
+    {
+      Local_vertex_handle lv = lf->vertex(i);
+      Vertex_handle v = border_dt.is_infinite(lv) ? infinite_vertex : vertex_map[lv->info()];
+      f->set_vertex(i, v);
+      v->set_face(f);
+    }
+  }
+  for(Local_face_handle lf : border_dt.all_face_handles())
+  {
+    if(!lf->info().in_output)
+      continue;
+    for(int i=0; i<3; ++i)
+    {
+      Local_face_handle ln = lf->neighbor(i);
+      if(ln->info().in_output)
+        lf->info().output_face->set_neighbor(i, ln->info().output_face);
+    }
+  }
+  for(const Frontier_edge& fe : frontier)
+  {
+    CGAL_assertion(fe.border_face != Local_face_handle());
+    Face_handle f = fe.final_face->info().output_face, n = fe.border_face->info().output_face;
+    f->set_neighbor(fe.final_index, n);
+    n->set_neighbor(fe.border_index, f);
+  }
+
+  for(std::size_t i : duplicates)
+    tds.delete_vertex(vertex_map[i]);
+
+  tds.set_dimension(2);
+  CGAL_expensive_postcondition(dt.is_valid());
+  return true;
+}
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_LINKED_WITH_TBB
+
+#endif // CGAL_TRIANGULATION_2_DELAUNAY_TRIANGULATION_2_PARALLEL_INSERTION_H
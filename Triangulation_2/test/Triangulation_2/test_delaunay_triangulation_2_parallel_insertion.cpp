@@ -0,0 +1,130 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Projection_traits_xy_3.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel     K;
+typedef CGAL::Projection_traits_xy_3<K>                         Gt_xy;
+
+template <class Dt>
+std::set<std::array<typename Dt::Point, 3> >
+faces(const Dt& dt)
+{
+  std::set<std::array<typename Dt::Point, 3> > res;
+  for(typename Dt::Face_handle f : dt.finite_face_handles())
+  {
+    std::array<typename Dt::Point, 3> face = { f->vertex(0)->point(), f->vertex(1)->point(), f->vertex(2)->point() };
+    std::rotate(face.begin(), std::min_element(face.begin(), face.end()), face.end());
+    res.insert(face);
+  }
+  return res;
+}
+
+template <class Dt>
+void check_same(const Dt& parallel_dt, const Dt& sequential_dt)
+{
+  assert(parallel_dt.is_valid());
+  assert(parallel_dt.number_of_vertices() == sequential_dt.number_of_vertices());
+  assert(parallel_dt.number_of_faces() == sequential_dt.number_of_faces());
+  assert(faces(parallel_dt) == faces(sequential_dt));
+}
+
+template <class Dt>
+void test(const std::vector<typename Dt::Point>& points)
+{
+  Dt sequential_dt;
+  sequential_dt.insert(points.begin(), points.end());
+
+  Dt parallel_dt;
+  const std::ptrdiff_t n = parallel_dt.template insert<CGAL::Parallel_if_available_tag>(points.begin(), points.end());
+  assert(n == std::ptrdiff_t(sequential_dt.number_of_vertices()));
+  check_same(parallel_dt, sequential_dt);
+
+  Dt dt;
+  dt.template insert<CGAL::Sequential_tag>(points.begin(), points.end());
+  check_same(dt, sequential_dt);
+
+  // insertion in a triangulation that is not empty
+  if(points.size() > 10)
+  {
+    Dt dt2;
+    dt2.insert(points.begin(), points.begin() + 10);
+    dt2.template insert<CGAL::Parallel_if_available_tag>(points.begin() + 10, points.end());
+    check_same(dt2, sequential_dt);
+  }
+}
+
+void test_with_info(const std::vector<K::Point_2>& points)
+{
+  typedef CGAL::Triangulation_vertex_base_with_info_2<std::size_t, K>   Vb;
+  typedef CGAL::Triangulation_data_structure_2<Vb>                      Tds;
+  typedef CGAL::Delaunay_triangulation_2<K, Tds>                        Dt;
+
+  std::vector<std::pair<K::Point_2, std::size_t> > points_with_info;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_info.emplace_back(points[i], i);
+
+  Dt sequential_dt;
+  sequential_dt.insert(points_with_info.begin(), points_with_info.end());
+
+  Dt dt;
+  dt.insert<CGAL::Parallel_if_available_tag>(points_with_info.begin(), points_with_info.end());
+  check_same(dt, sequential_dt);
+  for(Dt::Vertex_handle v : dt.finite_vertex_handles())
+    assert(points[v->info()] == v->point());
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::cout << "Random seed: " << rnd.get_seed() << std::endl;
+
+  // random points
+  std::vector<K::Point_2> points;
+  CGAL::Random_points_in_square_2<K::Point_2> gen(1., rnd);
+  std::copy_n(gen, 50000, std::back_inserter(points));
+  test<CGAL::Delaunay_triangulation_2<K> >(points);
+  test_with_info(points);
+
+  // points on a grid, with many co-circular points and duplicates
+  std::vector<K::Point_2> grid;
+  for(int i=0; i<150; ++i)
+    for(int j=0; j<150; ++j)
+      grid.emplace_back(i, j);
+  for(int i=0; i<1000; ++i)
+    grid.push_back(grid[rnd.get_int(0, int(grid.size()))]);
+  std::shuffle(grid.begin(), grid.end(), std::mt19937(rnd.get_int(0, 1000)));
+  test<CGAL::Delaunay_triangulation_2<K> >(grid);
+  test_with_info(grid);
+
+  // collinear points
+  std::vector<K::Point_2> collinear;
+  for(int i=0; i<5000; ++i)
+    collinear.emplace_back(i, 2*i);
+  test<CGAL::Delaunay_triangulation_2<K> >(collinear);
+
+  // few points
+  test<CGAL::Delaunay_triangulation_2<K> >(std::vector<K::Point_2>(points.begin(), points.begin() + 100));
+  test<CGAL::Delaunay_triangulation_2<K> >(std::vector<K::Point_2>());
+
+  // terrain
+  std::vector<K::Point_3> terrain;
+  CGAL::Random_points_in_cube_3<K::Point_3> gen3(1., rnd);
+  std::copy_n(gen3, 20000, std::back_inserter(terrain));
+  test<CGAL::Delaunay_triangulation_2<Gt_xy> >(terrain);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}